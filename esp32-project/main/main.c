@@ -7,10 +7,16 @@
 #include "esp_system.h"
 #include "ethervox/audio.h"
 #include "ethervox/platform.h"
+#include "ethervox/wake_word.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "nvs_flash.h"
 
+static void on_wake_detected(const struct ethervox_wake_result* result, void* user_data) {
+  (void)user_data;
+  printf("Wake word detected (confidence %.2f)\n", result->confidence);
+}
+
 void app_main(void) {
   // Initialize NVS
   esp_err_t ret = nvs_flash_init();
@@ -39,10 +45,24 @@ void app_main(void) {
     return;
   }
 
+  // Wake word detection runs on core 1, fed by the core 0 capture task
+  ethervox_wake_runtime_t wake;
+  ethervox_wake_config_t wake_config = ethervox_wake_get_default_config();
+  if (ethervox_wake_init(&wake, &wake_config) != 0) {
+    printf("Failed to initialize wake word detection\n");
+    return;
+  }
+
+  if (ethervox_audio_start_capture(&audio) != 0 ||
+      ethervox_audio_esp32_start_dual_core(&audio, &wake, on_wake_detected) != 0) {
+    printf("Failed to start dual-core audio pipeline\n");
+    return;
+  }
+
   printf("EthervoxAI initialized successfully\n");
 
   // Main loop
   while (1) {
     vTaskDelay(1000 / portTICK_PERIOD_MS);
   }
-}
\ No newline at end of file
+}
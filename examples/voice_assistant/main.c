@@ -41,67 +41,27 @@ static void voice_assistant_sleep_us(unsigned int microseconds) {
 #endif
 }
 
-#include "ethervox/audio.h"
-#include "ethervox/dialogue.h"
 #include "ethervox/error.h"
-#include "ethervox/llm.h"
-#include "ethervox/model_manager.h"
-#include "ethervox/platform.h"
-#include "ethervox/stt.h"
-#include "ethervox/wake_word.h"
-
-// Pipeline state
-typedef enum {
-  STATE_LISTENING_FOR_WAKE,
-  STATE_RECORDING_SPEECH,
-  STATE_PROCESSING_INTENT,
-  STATE_GENERATING_RESPONSE
-} pipeline_state_t;
-
-typedef struct {
-  bool text_mode;
-
-  // Platform
-  ethervox_platform_t platform;
-
-  // Audio
-  ethervox_audio_runtime_t audio;
-  ethervox_audio_config_t audio_config;
-
-  // Wake word
-  ethervox_wake_runtime_t wake;
-  ethervox_wake_config_t wake_config;
-
-  // STT
-  ethervox_stt_runtime_t stt;
-  ethervox_stt_config_t stt_config;
-
-  // Dialogue
-  ethervox_dialogue_engine_t dialogue;
-  ethervox_llm_config_t llm_config;
-
-  // LLM Backend
-  ethervox_llm_backend_t* llm_backend;
-  bool llm_enabled;
-  char* model_path;
-  
-  // Model Manager
-  ethervox_model_manager_t* model_manager;
-  bool auto_download_models;
-
-  // State
-  pipeline_state_t state;
-  char* context_id;
-  bool running;
-  bool audio_ready;
-  bool wake_ready;
-  bool stt_ready;
-  char language_code[8];
-  char stt_language[16];
-} voice_pipeline_t;
+
+#include "pipeline.h"
+
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define PIPELINE_HAVE_PTHREAD 1
+#else
+#define PIPELINE_HAVE_PTHREAD 0
+#endif
 
 static voice_pipeline_t g_pipeline = {0};
 
+#if PIPELINE_HAVE_PTHREAD
+// Background model-load thread; pipeline_cleanup() joins it before tearing
+// the LLM backend down
+static pthread_t g_llm_thread;
+static bool g_llm_thread_started = false;
+static const char* g_llm_model_path = NULL;
+#endif
+
 // Signal handler for clean shutdown
 void signal_handler(int signum) {
   (void)signum;
@@ -181,6 +141,79 @@ static void pipeline_resolve_language(voice_pipeline_t* pipeline, const char* ov
   map_stt_language(pipeline->language_code, pipeline->stt_language, sizeof(pipeline->stt_language));
 }
 
+// --- Subsystem init jobs ----------------------------------------------------
+// Cold start used to be the sum of every subsystem init because they ran
+// strictly back to back. Each job below initializes one subsystem from config
+// that pipeline_init() fills in beforehand on the main thread (so the jobs
+// share nothing); with pthreads they run concurrently and pipeline_init()
+// joins them, so the audio chain costs max() of its inits instead of the sum
+// and the model load doesn't hold the microphone hostage at all.
+
+static void* pipeline_audio_init_job(void* arg) {
+  voice_pipeline_t* pipeline = (voice_pipeline_t*)arg;
+  if (ethervox_audio_init(&pipeline->audio, &pipeline->audio_config) != 0) {
+    fprintf(stderr, "Failed to initialize audio\n");
+  } else {
+    pipeline->audio_ready = true;
+    printf("✓ Audio initialized (16kHz, mono)\n");
+  }
+  return NULL;
+}
+
+static void* pipeline_wake_init_job(void* arg) {
+  voice_pipeline_t* pipeline = (voice_pipeline_t*)arg;
+  if (ethervox_wake_init(&pipeline->wake, &pipeline->wake_config) != 0) {
+    fprintf(stderr, "Failed to initialize wake word detection\n");
+  } else {
+    pipeline->wake_ready = true;
+    printf("✓ Wake word: '%s' (sensitivity: %.1f)\n", pipeline->wake_config.wake_word,
+           pipeline->wake_config.sensitivity);
+  }
+  return NULL;
+}
+
+static void* pipeline_stt_init_job(void* arg) {
+  voice_pipeline_t* pipeline = (voice_pipeline_t*)arg;
+  if (ethervox_stt_init(&pipeline->stt, &pipeline->stt_config) != 0) {
+    fprintf(stderr, "Failed to initialize STT\n");
+    return NULL;
+  }
+  pipeline->stt_ready = true;
+  printf("✓ STT initialized (%s)\n", pipeline->stt_config.language);
+
+  if (ethervox_vad_init(&pipeline->vad, &pipeline->vad_config) != 0) {
+    fprintf(stderr, "Failed to initialize VAD, feeding STT unfiltered\n");
+  } else {
+    pipeline->vad_ready = true;
+    printf("✓ VAD enabled (threshold: %.2f)\n", pipeline->vad_config.energy_threshold);
+  }
+  return NULL;
+}
+
+static void pipeline_init_llm(voice_pipeline_t* pipeline, const char* model_path);
+
+#if PIPELINE_HAVE_PTHREAD
+static void* pipeline_llm_init_job(void* arg) {
+  voice_pipeline_t* pipeline = (voice_pipeline_t*)arg;
+  pipeline_init_llm(pipeline, g_llm_model_path);
+  pipeline->llm_loading = false;
+  return NULL;
+}
+#endif
+
+// Block until a background model load settles. Upstream the transcript queue
+// keeps accepting utterances while this waits, so speech right after boot is
+// answered once the model lands instead of being lost or downgraded.
+void pipeline_wait_for_llm(voice_pipeline_t* pipeline) {
+  if (!pipeline->llm_loading) {
+    return;
+  }
+  printf("⏳ Model still loading — your request is queued...\n");
+  while (pipeline->llm_loading && pipeline->running) {
+    voice_assistant_sleep_us(50000);
+  }
+}
+
 // Initialize pipeline
 int pipeline_init(voice_pipeline_t* pipeline, const char* language_override, bool enable_audio, const char* model_path) {
   printf("=== EthervoxAI Voice Assistant ===\n\n");
@@ -197,49 +230,105 @@ int pipeline_init(voice_pipeline_t* pipeline, const char* language_override, boo
   pipeline_resolve_language(pipeline, language_override);
   printf("Language preference: %s (STT: %s)\n\n", pipeline->language_code, pipeline->stt_language);
 
-  if (enable_audio) {
-    bool audio_pipeline_ready = true;
-
-    pipeline->audio_config = (ethervox_audio_config_t){
-        .sample_rate = 16000, .channels = 1, .bits_per_sample = 16, .buffer_size = 1024};
+  // Assemble the tunables once into an immutable snapshot; environment
+  // overrides land here so every stage below reads the same resolved values
+  ethervox_config_builder_t* settings_builder = ethervox_config_builder_create();
+  if (settings_builder) {
+    ethervox_config_builder_set(settings_builder, "audio.sample_rate", "16000");
+    ethervox_config_builder_set(settings_builder, "audio.buffer_frames", "1024");
+    ethervox_config_builder_set(settings_builder, "wake.word", "hey ethervox");
+    ethervox_config_builder_set(settings_builder, "wake.sensitivity", "0.7");
+
+    const char* env_wake_word = getenv("ETHERVOX_WAKE_WORD");
+    if (env_wake_word && *env_wake_word) {
+      ethervox_config_builder_set(settings_builder, "wake.word", env_wake_word);
+    }
+    const char* env_sensitivity = getenv("ETHERVOX_WAKE_SENSITIVITY");
+    if (env_sensitivity && *env_sensitivity) {
+      ethervox_config_builder_set(settings_builder, "wake.sensitivity", env_sensitivity);
+    }
 
-    if (ethervox_audio_init(&pipeline->audio, &pipeline->audio_config) != 0) {
-      fprintf(stderr, "Failed to initialize audio\n");
-      audio_pipeline_ready = false;
-    } else {
-      pipeline->audio_ready = true;
-      printf("✓ Audio initialized (16kHz, mono)\n");
+    pipeline->settings = ethervox_config_builder_finish(settings_builder);
+  }
 
-      pipeline->wake_config = ethervox_wake_get_default_config();
-      pipeline->wake_config.wake_word = "hey ethervox";
-      pipeline->wake_config.sensitivity = 0.7f;
+  if (enable_audio) {
+    // All job config is filled in here, on this thread, before any job runs
+    pipeline->audio_config = (ethervox_audio_config_t){
+        .sample_rate = ethervox_config_snapshot_get_uint(pipeline->settings, "audio.sample_rate",
+                                                         16000),
+        .channels = 1,
+        .bits_per_sample = 16,
+        .buffer_size = ethervox_config_snapshot_get_uint(pipeline->settings,
+                                                         "audio.buffer_frames", 1024)};
+
+    pipeline->wake_config = ethervox_wake_get_default_config();
+    // The wake word string lives in the snapshot, which the pipeline holds
+    // until cleanup
+    pipeline->wake_config.wake_word =
+        ethervox_config_snapshot_get(pipeline->settings, "wake.word", "hey ethervox");
+    pipeline->wake_config.sensitivity =
+        ethervox_config_snapshot_get_float(pipeline->settings, "wake.sensitivity", 0.7f);
+
+    pipeline->stt_config = ethervox_stt_get_default_config();
+    pipeline->stt_config.language = pipeline->stt_language;
+
+    pipeline->vad_config = ethervox_vad_get_default_config();
+    pipeline->vad_config.sample_rate = pipeline->audio_config.sample_rate;
+    pipeline->vad_config.energy_threshold = pipeline->stt_config.vad_threshold;
+
+#if PIPELINE_HAVE_PTHREAD
+    // Join barrier over the audio chain; any job whose thread fails to start
+    // just runs inline on this thread
+    pthread_t audio_thread;
+    pthread_t wake_thread;
+    pthread_t stt_thread;
+    const bool audio_threaded =
+        pthread_create(&audio_thread, NULL, pipeline_audio_init_job, pipeline) == 0;
+    const bool wake_threaded =
+        pthread_create(&wake_thread, NULL, pipeline_wake_init_job, pipeline) == 0;
+    const bool stt_threaded =
+        pthread_create(&stt_thread, NULL, pipeline_stt_init_job, pipeline) == 0;
+
+    if (!audio_threaded) {
+      pipeline_audio_init_job(pipeline);
+    }
+    if (!wake_threaded) {
+      pipeline_wake_init_job(pipeline);
+    }
+    if (!stt_threaded) {
+      pipeline_stt_init_job(pipeline);
+    }
 
-      if (ethervox_wake_init(&pipeline->wake, &pipeline->wake_config) != 0) {
-        fprintf(stderr, "Failed to initialize wake word detection\n");
-        audio_pipeline_ready = false;
-      } else {
-        pipeline->wake_ready = true;
-        printf("✓ Wake word: '%s' (sensitivity: %.1f)\n", pipeline->wake_config.wake_word,
-               pipeline->wake_config.sensitivity);
+    if (audio_threaded) {
+      pthread_join(audio_thread, NULL);
+    }
+    if (wake_threaded) {
+      pthread_join(wake_thread, NULL);
+    }
+    if (stt_threaded) {
+      pthread_join(stt_thread, NULL);
+    }
+#else
+    pipeline_audio_init_job(pipeline);
+    pipeline_wake_init_job(pipeline);
+    pipeline_stt_init_job(pipeline);
+#endif
 
-        pipeline->stt_config = ethervox_stt_get_default_config();
-        pipeline->stt_config.language = pipeline->stt_language;
+    const bool audio_pipeline_ready =
+        pipeline->audio_ready && pipeline->wake_ready && pipeline->stt_ready;
 
-        if (ethervox_stt_init(&pipeline->stt, &pipeline->stt_config) != 0) {
-          fprintf(stderr, "Failed to initialize STT\n");
-          audio_pipeline_ready = false;
-        } else {
-          pipeline->stt_ready = true;
-          printf("✓ STT initialized (%s)\n", pipeline->stt_config.language);
-          printf(
-              "Tip: speak '%s' clearly near the microphone. Use --text if audio isn't "
-              "available.\n\n",
-              pipeline->wake_config.wake_word);
-        }
-      }
+    if (audio_pipeline_ready) {
+      printf(
+          "Tip: speak '%s' clearly near the microphone. Use --text if audio isn't "
+          "available.\n\n",
+          pipeline->wake_config.wake_word);
     }
 
     if (!audio_pipeline_ready) {
+      if (pipeline->vad_ready) {
+        ethervox_vad_cleanup(&pipeline->vad);
+        pipeline->vad_ready = false;
+      }
       if (pipeline->stt_ready) {
         ethervox_stt_cleanup(&pipeline->stt);
         pipeline->stt_ready = false;
@@ -270,117 +359,27 @@ int pipeline_init(voice_pipeline_t* pipeline, const char* language_override, boo
   pipeline->auto_download_models = true;
 
   if (model_path && *model_path) {
-    printf("Initializing LLM backend...\n");
-    
-    // Create LLM backend
-    pipeline->llm_backend = ethervox_llm_create_llama_backend();
-    if (!pipeline->llm_backend) {
-      fprintf(stderr, "⚠️  Failed to create LLM backend (continuing without local LLM)\n");
+#if PIPELINE_HAVE_PTHREAD
+    // Model download + load dominates cold start; push it to the background
+    // and start listening right away. pipeline_wait_for_llm() parks the
+    // dialogue worker, so the first utterance queues behind the load instead
+    // of downgrading to the simple response.
+    pipeline->llm_loading = true;
+    g_llm_model_path = model_path;
+    if (pthread_create(&g_llm_thread, NULL, pipeline_llm_init_job, pipeline) == 0) {
+      g_llm_thread_started = true;
+      printf("Initializing LLM backend in the background...\n");
     } else {
-      // Configure LLM
-      pipeline->llm_config = ethervox_dialogue_get_default_llm_config();
-      pipeline->llm_config.context_length = 2048;
-      pipeline->llm_config.max_tokens = 256;
-      pipeline->llm_config.temperature = 0.7f;
-      pipeline->llm_config.top_p = 0.9f;
-      pipeline->llm_config.use_gpu = false;  // Can be made configurable
-      pipeline->llm_config.language_code = pipeline->language_code;
-
-      // Initialize backend
-      if (ethervox_llm_backend_init(pipeline->llm_backend, &pipeline->llm_config) != 0) {
-        fprintf(stderr, "⚠️  Failed to initialize LLM backend (continuing without local LLM)\n");
-        ethervox_llm_backend_free(pipeline->llm_backend);
-        pipeline->llm_backend = NULL;
-      } else {
-        // Check if model_path is a preset name or actual path
-        const char* actual_model_path = model_path;
-        const ethervox_model_info_t* selected_model = NULL;
-        
-        // Check if user specified a preset model name
-        if (strcasecmp(model_path, "tinyllama") == 0) {
-          selected_model = &ETHERVOX_MODEL_TINYLLAMA_1B_Q4;
-        } else if (strcasecmp(model_path, "phi2") == 0) {
-          selected_model = &ETHERVOX_MODEL_PHI2_Q4;
-        } else if (strcasecmp(model_path, "mistral") == 0) {
-          selected_model = &ETHERVOX_MODEL_MISTRAL_7B_Q4;
-        } else if (strcasecmp(model_path, "llama2") == 0) {
-          selected_model = &ETHERVOX_MODEL_LLAMA2_7B_Q4;
-        }
-        
-        // If preset model selected, use model manager
-        if (selected_model && pipeline->auto_download_models) {
-          printf("Using preset model: %s\n", selected_model->name);
-          
-          // Create model manager if not exists
-          if (!pipeline->model_manager) {
-            ethervox_model_manager_config_t mm_config = ethervox_model_manager_get_default_config();
-            mm_config.auto_download = true;
-            pipeline->model_manager = ethervox_model_manager_create(&mm_config);
-          }
-          
-          if (pipeline->model_manager) {
-            // Check if model is available, download if needed
-            printf("Checking model availability...\n");
-            if (!ethervox_model_manager_is_available(pipeline->model_manager, selected_model)) {
-              printf("Model not found locally, downloading...\n");
-              printf("Size: %.2f MB\n", (float)selected_model->size_bytes / 1024.0f / 1024.0f);
-              printf("This may take several minutes depending on your connection.\n");
-              
-              int dl_result = ethervox_model_manager_ensure_available(pipeline->model_manager, selected_model);
-              if (dl_result != 0) {
-                fprintf(stderr, "⚠️  Failed to download model\n");
-                fprintf(stderr, "Please download manually from:\n%s\n", selected_model->url);
-                ethervox_llm_backend_cleanup(pipeline->llm_backend);
-                ethervox_llm_backend_free(pipeline->llm_backend);
-                pipeline->llm_backend = NULL;
-                goto skip_llm_load;
-              }
-              printf("✓ Model downloaded successfully\n");
-            } else {
-              printf("✓ Model already available locally\n");
-            }
-            
-            // Get model path from manager
-            static char model_path_buffer[1024];
-            if (ethervox_model_manager_get_path(pipeline->model_manager, selected_model, 
-                                               model_path_buffer, sizeof(model_path_buffer)) == ETHERVOX_SUCCESS) {
-              actual_model_path = model_path_buffer;
-            } else {
-              fprintf(stderr, "Failed to get model path\n");
-              actual_model_path = NULL;
-            }
-          }
-        }
-        
-        // Load model
-        if (actual_model_path) {
-          printf("Loading model: %s\n", actual_model_path);
-          if (ethervox_llm_backend_load_model(pipeline->llm_backend, actual_model_path) != 0) {
-            fprintf(stderr, "⚠️  Failed to load model (continuing without local LLM)\n");
-            ethervox_llm_backend_cleanup(pipeline->llm_backend);
-            ethervox_llm_backend_free(pipeline->llm_backend);
-            pipeline->llm_backend = NULL;
-          } else {
-            pipeline->llm_enabled = true;
-            pipeline->model_path = strdup(actual_model_path);
-            printf("✓ LLM backend initialized with model: %s\n", actual_model_path);
-            
-            // Display capabilities
-            ethervox_llm_capabilities_t caps;
-            if (pipeline->llm_backend->get_capabilities(pipeline->llm_backend, &caps) == 0) {
-              printf("  • Model format: %s\n", caps.model_format);
-              printf("  • Max context: %u tokens\n", caps.max_context_length);
-              printf("  • GPU support: %s\n", caps.supports_gpu ? "yes" : "no");
-            }
-          }
-        }
-      }
+      pipeline->llm_loading = false;
+      pipeline_init_llm(pipeline, model_path);
     }
+#else
+    pipeline_init_llm(pipeline, model_path);
+#endif
   } else {
     printf("(No LLM model specified - using simple response mode)\n");
   }
 
-skip_llm_load:
   // Initialize dialogue engine
   pipeline->llm_config = ethervox_dialogue_get_default_llm_config();
   pipeline->llm_config.language_code = pipeline->language_code;
@@ -409,8 +408,133 @@ skip_llm_load:
   return 0;
 }
 
+// Create, configure and load the LLM backend (optionally resolving a preset
+// name through the model manager). Runs on the background load thread in
+// parallel-init mode, so it only touches the llm_* fields plus the model
+// manager — never state the listening pipeline reads. The backend copies its
+// configuration values, so the config here can stay local.
+static void pipeline_init_llm(voice_pipeline_t* pipeline, const char* model_path) {
+  printf("Initializing LLM backend...\n");
+
+  // Create LLM backend
+  pipeline->llm_backend = ethervox_llm_create_llama_backend();
+  if (!pipeline->llm_backend) {
+    fprintf(stderr, "⚠️  Failed to create LLM backend (continuing without local LLM)\n");
+    return;
+  }
+
+  // Configure LLM
+  ethervox_llm_config_t llm_config = ethervox_dialogue_get_default_llm_config();
+  llm_config.context_length = 2048;
+  llm_config.max_tokens = 256;
+  llm_config.temperature = 0.7f;
+  llm_config.top_p = 0.9f;
+  llm_config.use_gpu = false;  // Can be made configurable
+  llm_config.language_code = pipeline->language_code;
+
+  // Initialize backend
+  if (ethervox_llm_backend_init(pipeline->llm_backend, &llm_config) != 0) {
+    fprintf(stderr, "⚠️  Failed to initialize LLM backend (continuing without local LLM)\n");
+    ethervox_llm_backend_free(pipeline->llm_backend);
+    pipeline->llm_backend = NULL;
+    return;
+  }
+
+  // Check if model_path is a preset name or actual path
+  const char* actual_model_path = model_path;
+  const ethervox_model_info_t* selected_model = NULL;
+
+  // Check if user specified a preset model name
+  if (strcasecmp(model_path, "tinyllama") == 0) {
+    selected_model = &ETHERVOX_MODEL_TINYLLAMA_1B_Q4;
+  } else if (strcasecmp(model_path, "phi2") == 0) {
+    selected_model = &ETHERVOX_MODEL_PHI2_Q4;
+  } else if (strcasecmp(model_path, "mistral") == 0) {
+    selected_model = &ETHERVOX_MODEL_MISTRAL_7B_Q4;
+  } else if (strcasecmp(model_path, "llama2") == 0) {
+    selected_model = &ETHERVOX_MODEL_LLAMA2_7B_Q4;
+  }
+
+  // If preset model selected, use model manager
+  if (selected_model && pipeline->auto_download_models) {
+    printf("Using preset model: %s\n", selected_model->name);
+
+    // Create model manager if not exists
+    if (!pipeline->model_manager) {
+      ethervox_model_manager_config_t mm_config = ethervox_model_manager_get_default_config();
+      mm_config.auto_download = true;
+      pipeline->model_manager = ethervox_model_manager_create(&mm_config);
+    }
+
+    if (pipeline->model_manager) {
+      // Check if model is available, download if needed
+      printf("Checking model availability...\n");
+      if (!ethervox_model_manager_is_available(pipeline->model_manager, selected_model)) {
+        printf("Model not found locally, downloading...\n");
+        printf("Size: %.2f MB\n", (float)selected_model->size_bytes / 1024.0f / 1024.0f);
+        printf("This may take several minutes depending on your connection.\n");
+
+        int dl_result = ethervox_model_manager_ensure_available(pipeline->model_manager, selected_model);
+        if (dl_result != 0) {
+          fprintf(stderr, "⚠️  Failed to download model\n");
+          fprintf(stderr, "Please download manually from:\n%s\n", selected_model->url);
+          ethervox_llm_backend_cleanup(pipeline->llm_backend);
+          ethervox_llm_backend_free(pipeline->llm_backend);
+          pipeline->llm_backend = NULL;
+          return;
+        }
+        printf("✓ Model downloaded successfully\n");
+      } else {
+        printf("✓ Model already available locally\n");
+      }
+
+      // Get model path from manager
+      static char model_path_buffer[1024];
+      if (ethervox_model_manager_get_path(pipeline->model_manager, selected_model,
+                                         model_path_buffer, sizeof(model_path_buffer)) == ETHERVOX_SUCCESS) {
+        actual_model_path = model_path_buffer;
+      } else {
+        fprintf(stderr, "Failed to get model path\n");
+        actual_model_path = NULL;
+      }
+    }
+  }
+
+  // Load model
+  if (actual_model_path) {
+    printf("Loading model: %s\n", actual_model_path);
+    if (ethervox_llm_backend_load_model(pipeline->llm_backend, actual_model_path) != 0) {
+      fprintf(stderr, "⚠️  Failed to load model (continuing without local LLM)\n");
+      ethervox_llm_backend_cleanup(pipeline->llm_backend);
+      ethervox_llm_backend_free(pipeline->llm_backend);
+      pipeline->llm_backend = NULL;
+    } else {
+      pipeline->model_path = strdup(actual_model_path);
+      printf("✓ LLM backend initialized with model: %s\n", actual_model_path);
+      pipeline->llm_enabled = true;
+
+      // Display capabilities
+      ethervox_llm_capabilities_t caps;
+      if (pipeline->llm_backend->get_capabilities(pipeline->llm_backend, &caps) == 0) {
+        printf("  • Model format: %s\n", caps.model_format);
+        printf("  • Max context: %u tokens\n", caps.max_context_length);
+        printf("  • GPU support: %s\n", caps.supports_gpu ? "yes" : "no");
+      }
+    }
+  }
+}
+
 // Cleanup pipeline
 void pipeline_cleanup(voice_pipeline_t* pipeline) {
+#if PIPELINE_HAVE_PTHREAD
+  // A still-running background load owns the llm_* fields; join it before
+  // tearing the backend down
+  if (g_llm_thread_started) {
+    pthread_join(g_llm_thread, NULL);
+    g_llm_thread_started = false;
+  }
+#endif
+
   // Cleanup LLM backend
   if (pipeline->llm_backend) {
     ethervox_llm_backend_unload_model(pipeline->llm_backend);
@@ -432,6 +556,10 @@ void pipeline_cleanup(voice_pipeline_t* pipeline) {
 
   ethervox_dialogue_cleanup(&pipeline->dialogue);
 
+  if (pipeline->vad_ready) {
+    ethervox_vad_cleanup(&pipeline->vad);
+  }
+
   if (pipeline->stt_ready) {
     ethervox_stt_cleanup(&pipeline->stt);
   }
@@ -450,13 +578,18 @@ void pipeline_cleanup(voice_pipeline_t* pipeline) {
     free(pipeline->context_id);
   }
 
+  // Last: stage configs (the wake word) borrow strings from the snapshot
+  ethervox_config_snapshot_unref(pipeline->settings);
+  pipeline->settings = NULL;
+
   printf("Pipeline cleaned up\n");
 }
 
 static void pipeline_run_text(voice_pipeline_t* pipeline);
 
-// Main processing loop
-static void pipeline_run_voice(voice_pipeline_t* pipeline) {
+// Single-threaded processing loop; also the fallback when the threaded
+// pipeline in pipeline.c has no thread support to build on
+void pipeline_run_voice(voice_pipeline_t* pipeline) {
   printf("🎤 Say '%s' to begin. Press Ctrl+C to exit.\n\n", pipeline->wake_config.wake_word);
 
   if (ethervox_audio_start_capture(&pipeline->audio) != 0) {
@@ -511,6 +644,15 @@ static void pipeline_run_voice(voice_pipeline_t* pipeline) {
         stt_session_active = true;
       }
 
+      // Drop silent buffers before they reach the STT accumulator
+      bool voice_present = true;
+      if (pipeline->vad_ready &&
+          ethervox_vad_process(&pipeline->vad, &audio_buffer, &voice_present) == 0 &&
+          !voice_present) {
+        ethervox_audio_buffer_recycle(&pipeline->audio, &audio_buffer);
+        continue;
+      }
+
       ethervox_stt_result_t stt_result = {0};
       int stt_status = ethervox_stt_process(&pipeline->stt, &audio_buffer, &stt_result);
 
@@ -521,14 +663,17 @@ static void pipeline_run_voice(voice_pipeline_t* pipeline) {
         bool should_stop = (strcasecmp(transcript, "stop") == 0);
 
         char response_text[512];
-        
-        // Generate response using LLM if available
+
+        // Generate response using LLM if available (holding for a model
+        // load that is still in flight right after boot)
+        pipeline_wait_for_llm(pipeline);
         if (pipeline->llm_enabled && pipeline->llm_backend) {
           printf("🤖 Generating LLM response...\n");
           
           ethervox_llm_response_t llm_response = {0};
-          if (ethervox_llm_backend_generate(pipeline->llm_backend, transcript, 
-                                           pipeline->language_code, &llm_response) == 0) {
+          if (ethervox_llm_backend_generate_cached(pipeline->llm_backend, transcript,
+                                                   pipeline->language_code, pipeline->context_id,
+                                                   &llm_response) == 0) {
             snprintf(response_text, sizeof(response_text), "%s", llm_response.text);
             printf("💬 LLM response (%u tokens, %ums): %s\n", 
                    llm_response.token_count, llm_response.processing_time_ms, response_text);
@@ -550,7 +695,7 @@ static void pipeline_run_voice(voice_pipeline_t* pipeline) {
         ethervox_audio_buffer_t tts_output = {0};
         if (ethervox_tts_synthesize(&pipeline->audio, &tts_request, &tts_output) == 0) {
           printf("🔊 TTS ready (%u samples)\n", tts_output.size);
-          ethervox_audio_buffer_free(&tts_output);
+          ethervox_audio_buffer_recycle(&pipeline->audio, &tts_output);
         } else {
           printf("⚠️  TTS synthesis failed\n");
         }
@@ -560,7 +705,7 @@ static void pipeline_run_voice(voice_pipeline_t* pipeline) {
         if (should_stop) {
           printf("🛑 Stop command received. Exiting loop.\n");
           pipeline->running = false;
-          ethervox_audio_buffer_free(&audio_buffer);
+          ethervox_audio_buffer_recycle(&pipeline->audio, &audio_buffer);
           break;
         }
 
@@ -575,7 +720,7 @@ static void pipeline_run_voice(voice_pipeline_t* pipeline) {
       }
     }
 
-    ethervox_audio_buffer_free(&audio_buffer);
+    ethervox_audio_buffer_recycle(&pipeline->audio, &audio_buffer);
   }
 
   if (stt_session_active) {
@@ -630,6 +775,9 @@ static void pipeline_run_text(voice_pipeline_t* pipeline) {
       break;
     }
 
+    // Strings from the previous turn are no longer referenced; reclaim them
+    ethervox_dialogue_reset_turn_arena(&pipeline->dialogue);
+
     ethervox_intent_t intent = {0};
   ethervox_dialogue_intent_request_t intent_request = {
     .text = input,
@@ -639,11 +787,14 @@ static void pipeline_run_text(voice_pipeline_t* pipeline) {
       continue;
     }
 
-    // Generate response using LLM if available
+    // Generate response using LLM if available (holding for a model load
+    // that is still in flight right after boot)
+    pipeline_wait_for_llm(pipeline);
     if (pipeline->llm_enabled && pipeline->llm_backend) {
       ethervox_llm_response_t llm_response = {0};
-      if (ethervox_llm_backend_generate(pipeline->llm_backend, input, 
-                                       pipeline->language_code, &llm_response) == 0) {
+      if (ethervox_llm_backend_generate_cached(pipeline->llm_backend, input,
+                                               pipeline->language_code, pipeline->context_id,
+                                               &llm_response) == 0) {
         printf("Assistant> %s\n", llm_response.text);
         printf("  [%u tokens, %ums, confidence: %.2f]\n", 
                llm_response.token_count, llm_response.processing_time_ms, llm_response.confidence);
@@ -676,7 +827,7 @@ void pipeline_run(voice_pipeline_t* pipeline) {
     return;
   }
 
-  pipeline_run_voice(pipeline);
+  pipeline_run_voice_threaded(pipeline);
 }
 
 int main(int argc, char** argv) {
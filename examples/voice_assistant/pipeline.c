@@ -0,0 +1,411 @@
+/**
+ * @file pipeline.c
+ * @brief Threaded voice pipeline: capture -> wake/STT -> dialogue/LLM
+ *
+ * The single-threaded loop in main.c stalls the microphone whenever the LLM
+ * is generating, so follow-up speech lands in a full ALSA buffer and is
+ * dropped. This file is the deployment reference architecture instead:
+ *
+ *   capture thread --SPSC audio queue--> recognition worker
+ *   recognition worker --transcript queue--> dialogue/LLM worker
+ *
+ * The audio queue is a bounded single-producer/single-consumer ring with
+ * monotonic cursors (same shape as the capture ring in audio_core.c); when
+ * it is full the capture thread recycles the buffer and counts an overrun
+ * rather than blocking the device. The transcript queue is mutex/cond
+ * based — the recognition worker blocks there, which is the backpressure
+ * point: audio keeps flowing while at most a few utterances queue up.
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ * Licensed under CC BY-NC-SA 4.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#if !defined(strcasecmp)
+#define strcasecmp _stricmp
+#endif
+#else
+#include <strings.h>
+#include <unistd.h>
+#endif
+
+#include "pipeline.h"
+
+#if __has_include(<pthread.h>)
+
+#include <pthread.h>
+
+// Capture periods buffered between the mic and the recognition worker.
+// 16 periods of 1024 frames at 16kHz is ~1 second of slack
+#define PIPELINE_AUDIO_QUEUE_SLOTS 16u
+
+// Utterances buffered between recognition and the dialogue worker; the
+// recognition worker blocks here when the LLM falls this far behind
+#define PIPELINE_TRANSCRIPT_QUEUE_SLOTS 4u
+
+// Release/acquire pairs for the lock-free audio queue cursors; volatile alone
+// does not stop the slot stores reordering past the cursor advance on ARM
+#if defined(__GNUC__) || defined(__clang__)
+#define pipeline_cursor_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define pipeline_cursor_store(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#else
+#define pipeline_cursor_load(ptr) (*(ptr))
+#define pipeline_cursor_store(ptr, val) (*(ptr) = (val))
+#endif
+
+static void pipeline_sleep_us(unsigned int microseconds) {
+#if defined(_WIN32)
+  DWORD millis = (DWORD)((microseconds + 999U) / 1000U);
+  if (millis == 0U) {
+    millis = 1U;
+  }
+  Sleep(millis);
+#else
+  usleep(microseconds);
+#endif
+}
+
+typedef struct {
+  voice_pipeline_t* pipeline;
+
+  // Audio queue: SPSC ring, monotonic cursors, index = pos & (slots - 1).
+  // Only the capture thread writes write_pos, only the recognition worker
+  // writes read_pos; cursors are published with release stores and read with
+  // acquire loads so the slot write is visible before the cursor advance
+  ethervox_audio_buffer_t audio_slots[PIPELINE_AUDIO_QUEUE_SLOTS];
+  uint32_t audio_write_pos;
+  uint32_t audio_read_pos;
+
+  // Transcript queue: small mutex/cond ring of heap strings
+  char* transcripts[PIPELINE_TRANSCRIPT_QUEUE_SLOTS];
+  uint32_t transcript_count;
+  uint32_t transcript_head;
+  pthread_mutex_t transcript_lock;
+  pthread_cond_t transcript_pushed;
+  pthread_cond_t transcript_popped;
+
+  // Counters (each written by exactly one thread, read after the joins)
+  uint64_t buffers_captured;
+  uint64_t buffers_dropped;  // Queue-full overruns at the capture thread
+  uint64_t read_failures;
+  uint32_t audio_queue_peak;
+  uint64_t transcripts_produced;
+  uint64_t responses_spoken;
+} pipeline_threads_t;
+
+// --- Capture thread: device -> audio queue, never blocks on downstream ---
+
+static void* pipeline_capture_thread(void* arg) {
+  pipeline_threads_t* ctx = (pipeline_threads_t*)arg;
+  voice_pipeline_t* pipeline = ctx->pipeline;
+
+  while (pipeline->running) {
+    ethervox_audio_buffer_t audio_buffer = {0};
+    if (ethervox_audio_read(&pipeline->audio, &audio_buffer) != 0) {
+      ctx->read_failures++;
+      pipeline_sleep_us(10000);
+      continue;
+    }
+
+    ctx->buffers_captured++;
+
+    const uint32_t write_pos = ctx->audio_write_pos;  // Only this thread writes it
+    const uint32_t depth = write_pos - pipeline_cursor_load(&ctx->audio_read_pos);
+    if (depth >= PIPELINE_AUDIO_QUEUE_SLOTS) {
+      // Downstream is saturated; dropping the newest period keeps the mic
+      // draining so the device ring itself never overruns
+      ctx->buffers_dropped++;
+      ethervox_audio_buffer_recycle(&pipeline->audio, &audio_buffer);
+      continue;
+    }
+
+    if (depth + 1 > ctx->audio_queue_peak) {
+      ctx->audio_queue_peak = depth + 1;
+    }
+
+    ctx->audio_slots[write_pos & (PIPELINE_AUDIO_QUEUE_SLOTS - 1)] = audio_buffer;
+    pipeline_cursor_store(&ctx->audio_write_pos, write_pos + 1);
+  }
+
+  return NULL;
+}
+
+// --- Recognition worker: audio queue -> wake -> VAD -> STT -> transcripts ---
+
+// Blocks until there is a free transcript slot (this is the backpressure
+// point), then hands ownership of the heap string to the dialogue worker
+static void pipeline_push_transcript(pipeline_threads_t* ctx, char* text) {
+  pthread_mutex_lock(&ctx->transcript_lock);
+  while (ctx->transcript_count == PIPELINE_TRANSCRIPT_QUEUE_SLOTS && ctx->pipeline->running) {
+    pthread_cond_wait(&ctx->transcript_popped, &ctx->transcript_lock);
+  }
+
+  if (ctx->transcript_count == PIPELINE_TRANSCRIPT_QUEUE_SLOTS) {
+    free(text);  // Shutting down with a full queue
+  } else {
+    const uint32_t slot =
+        (ctx->transcript_head + ctx->transcript_count) % PIPELINE_TRANSCRIPT_QUEUE_SLOTS;
+    ctx->transcripts[slot] = text;
+    ctx->transcript_count++;
+    ctx->transcripts_produced++;
+    pthread_cond_signal(&ctx->transcript_pushed);
+  }
+  pthread_mutex_unlock(&ctx->transcript_lock);
+}
+
+static void* pipeline_recognition_thread(void* arg) {
+  pipeline_threads_t* ctx = (pipeline_threads_t*)arg;
+  voice_pipeline_t* pipeline = ctx->pipeline;
+
+  bool conversation_active = false;
+  bool stt_session_active = false;
+
+  for (;;) {
+    const uint32_t read_pos = ctx->audio_read_pos;  // Only this thread writes it
+    if (read_pos == pipeline_cursor_load(&ctx->audio_write_pos)) {
+      if (!pipeline->running) {
+        break;  // Capture thread has stopped and the queue is drained
+      }
+      pipeline_sleep_us(2000);
+      continue;
+    }
+
+    ethervox_audio_buffer_t audio_buffer =
+        ctx->audio_slots[read_pos & (PIPELINE_AUDIO_QUEUE_SLOTS - 1)];
+    pipeline_cursor_store(&ctx->audio_read_pos, read_pos + 1);
+
+    if (!conversation_active) {
+      ethervox_wake_result_t wake_result = {0};
+      if (ethervox_wake_process(&pipeline->wake, &audio_buffer, &wake_result) == 0 &&
+          wake_result.detected) {
+        printf("\n🔔 Wake word detected! Listening for speech...\n");
+        ethervox_wake_reset(&pipeline->wake);
+        if (!stt_session_active) {
+          ethervox_stt_start(&pipeline->stt);
+          stt_session_active = true;
+        }
+        conversation_active = true;
+        printf("🗣️  Speak now (say 'stop' to end).\n");
+      }
+    } else {
+      if (!stt_session_active) {
+        ethervox_stt_start(&pipeline->stt);
+        stt_session_active = true;
+      }
+
+      // Drop silent buffers before they reach the STT accumulator
+      bool voice_present = true;
+      if (pipeline->vad_ready &&
+          ethervox_vad_process(&pipeline->vad, &audio_buffer, &voice_present) == 0 &&
+          !voice_present) {
+        ethervox_audio_buffer_recycle(&pipeline->audio, &audio_buffer);
+        continue;
+      }
+
+      ethervox_stt_result_t stt_result = {0};
+      int stt_status = ethervox_stt_process(&pipeline->stt, &audio_buffer, &stt_result);
+
+      if (stt_status == 0 && stt_result.is_final) {
+        const char* transcript = stt_result.text ? stt_result.text : "";
+        printf("\n📝 Heard: \"%s\"\n", transcript);
+
+        const bool should_stop = (strcasecmp(transcript, "stop") == 0);
+
+        pipeline_push_transcript(ctx, strdup(transcript));
+        ethervox_stt_result_free(&stt_result);
+
+        if (should_stop) {
+          printf("🛑 Stop command received. Draining pipeline.\n");
+          pipeline->running = false;
+          ethervox_audio_buffer_recycle(&pipeline->audio, &audio_buffer);
+          continue;  // Keep looping to drain and recycle queued buffers
+        }
+
+        ethervox_stt_stop(&pipeline->stt);
+        ethervox_stt_start(&pipeline->stt);
+        printf("🗣️  Ready for your next phrase.\n");
+      } else if (stt_status == 0) {
+        ethervox_stt_result_free(&stt_result);
+      }
+    }
+
+    ethervox_audio_buffer_recycle(&pipeline->audio, &audio_buffer);
+  }
+
+  if (stt_session_active) {
+    ethervox_stt_stop(&pipeline->stt);
+  }
+
+  // Unblock the dialogue worker so it notices running == false
+  pthread_mutex_lock(&ctx->transcript_lock);
+  pthread_cond_broadcast(&ctx->transcript_pushed);
+  pthread_mutex_unlock(&ctx->transcript_lock);
+
+  return NULL;
+}
+
+// --- Dialogue worker: transcripts -> LLM -> TTS ---
+
+static void* pipeline_dialogue_thread(void* arg) {
+  pipeline_threads_t* ctx = (pipeline_threads_t*)arg;
+  voice_pipeline_t* pipeline = ctx->pipeline;
+
+  for (;;) {
+    pthread_mutex_lock(&ctx->transcript_lock);
+    while (ctx->transcript_count == 0 && pipeline->running) {
+      pthread_cond_wait(&ctx->transcript_pushed, &ctx->transcript_lock);
+    }
+
+    if (ctx->transcript_count == 0) {
+      pthread_mutex_unlock(&ctx->transcript_lock);
+      break;  // Shutdown with the queue drained
+    }
+
+    char* transcript = ctx->transcripts[ctx->transcript_head];
+    ctx->transcripts[ctx->transcript_head] = NULL;
+    ctx->transcript_head = (ctx->transcript_head + 1) % PIPELINE_TRANSCRIPT_QUEUE_SLOTS;
+    ctx->transcript_count--;
+    pthread_cond_signal(&ctx->transcript_popped);
+    pthread_mutex_unlock(&ctx->transcript_lock);
+
+    char response_text[512];
+
+    // Generate response using LLM if available; the mic keeps capturing
+    // (and the recognition worker keeps transcribing) while this runs.
+    // Right after boot the model may still be loading in the background —
+    // hold here so the first utterance is answered by the LLM, queued
+    // rather than lost
+    pipeline_wait_for_llm(pipeline);
+    if (pipeline->llm_enabled && pipeline->llm_backend) {
+      printf("🤖 Generating LLM response...\n");
+
+      ethervox_llm_response_t llm_response = {0};
+      if (ethervox_llm_backend_generate_cached(pipeline->llm_backend, transcript,
+                                               pipeline->language_code, pipeline->context_id,
+                                               &llm_response) == 0) {
+        snprintf(response_text, sizeof(response_text), "%s", llm_response.text);
+        printf("💬 LLM response (%u tokens, %ums): %s\n", llm_response.token_count,
+               llm_response.processing_time_ms, response_text);
+        ethervox_llm_response_free(&llm_response);
+      } else {
+        printf("⚠️  LLM generation failed, using simple response\n");
+        snprintf(response_text, sizeof(response_text), "I heard you say: %s", transcript);
+      }
+    } else {
+      snprintf(response_text, sizeof(response_text), "I heard you say: %s", transcript);
+    }
+
+    ethervox_tts_request_t tts_request = {.text = response_text,
+                                          .language_code = pipeline->language_code,
+                                          .speech_rate = 1.0f,
+                                          .pitch = 0.0f,
+                                          .voice_id = "default"};
+
+    ethervox_audio_buffer_t tts_output = {0};
+    if (ethervox_tts_synthesize(&pipeline->audio, &tts_request, &tts_output) == 0) {
+      printf("🔊 TTS ready (%u samples)\n", tts_output.size);
+      ethervox_audio_buffer_recycle(&pipeline->audio, &tts_output);
+    } else {
+      printf("⚠️  TTS synthesis failed\n");
+    }
+
+    ctx->responses_spoken++;
+    free(transcript);
+  }
+
+  return NULL;
+}
+
+void pipeline_run_voice_threaded(voice_pipeline_t* pipeline) {
+  printf("🎤 Say '%s' to begin. Press Ctrl+C to exit.\n\n", pipeline->wake_config.wake_word);
+
+  if (ethervox_audio_start_capture(&pipeline->audio) != 0) {
+    // The single-threaded loop owns the capture-failure fallback to text mode
+    pipeline_run_voice(pipeline);
+    return;
+  }
+
+  pipeline_threads_t ctx = {0};
+  ctx.pipeline = pipeline;
+  pthread_mutex_init(&ctx.transcript_lock, NULL);
+  pthread_cond_init(&ctx.transcript_pushed, NULL);
+  pthread_cond_init(&ctx.transcript_popped, NULL);
+
+  pthread_t capture_thread;
+  pthread_t recognition_thread;
+  pthread_t dialogue_thread;
+
+  if (pthread_create(&capture_thread, NULL, pipeline_capture_thread, &ctx) != 0) {
+    fprintf(stderr, "Failed to start capture thread, using single-threaded loop\n");
+    pthread_mutex_destroy(&ctx.transcript_lock);
+    pthread_cond_destroy(&ctx.transcript_pushed);
+    pthread_cond_destroy(&ctx.transcript_popped);
+    ethervox_audio_stop_capture(&pipeline->audio);
+    pipeline_run_voice(pipeline);
+    return;
+  }
+
+  if (pthread_create(&recognition_thread, NULL, pipeline_recognition_thread, &ctx) != 0) {
+    fprintf(stderr, "Failed to start recognition thread, using single-threaded loop\n");
+    pipeline->running = false;
+    pthread_join(capture_thread, NULL);
+    pipeline->running = true;
+    pthread_mutex_destroy(&ctx.transcript_lock);
+    pthread_cond_destroy(&ctx.transcript_pushed);
+    pthread_cond_destroy(&ctx.transcript_popped);
+    ethervox_audio_stop_capture(&pipeline->audio);
+    pipeline_run_voice(pipeline);
+    return;
+  }
+
+  if (pthread_create(&dialogue_thread, NULL, pipeline_dialogue_thread, &ctx) != 0) {
+    fprintf(stderr, "Failed to start dialogue thread, shutting down\n");
+    pipeline->running = false;
+  }
+
+  // Capture stops first so the recognition worker can drain the audio queue,
+  // then the recognition worker's broadcast releases the dialogue worker
+  pthread_join(capture_thread, NULL);
+  pthread_join(recognition_thread, NULL);
+  pthread_join(dialogue_thread, NULL);
+
+  // Recycle anything still parked in the audio queue
+  while (ctx.audio_read_pos != ctx.audio_write_pos) {
+    ethervox_audio_buffer_recycle(
+        &pipeline->audio, &ctx.audio_slots[ctx.audio_read_pos & (PIPELINE_AUDIO_QUEUE_SLOTS - 1)]);
+    ctx.audio_read_pos++;
+  }
+
+  for (uint32_t i = 0; i < PIPELINE_TRANSCRIPT_QUEUE_SLOTS; i++) {
+    if (ctx.transcripts[i]) {
+      free(ctx.transcripts[i]);
+    }
+  }
+
+  pthread_mutex_destroy(&ctx.transcript_lock);
+  pthread_cond_destroy(&ctx.transcript_pushed);
+  pthread_cond_destroy(&ctx.transcript_popped);
+
+  ethervox_audio_stop_capture(&pipeline->audio);
+
+  printf("\nPipeline stats: %llu buffers captured, %llu dropped (overrun), "
+         "%llu read failures, queue peak %u/%u, %llu transcripts, %llu responses\n",
+         (unsigned long long)ctx.buffers_captured, (unsigned long long)ctx.buffers_dropped,
+         (unsigned long long)ctx.read_failures, ctx.audio_queue_peak, PIPELINE_AUDIO_QUEUE_SLOTS,
+         (unsigned long long)ctx.transcripts_produced, (unsigned long long)ctx.responses_spoken);
+}
+
+#else  // !__has_include(<pthread.h>)
+
+// Without a threading primitive to build on, the reference pipeline degrades
+// to the single-threaded loop in main.c
+void pipeline_run_voice_threaded(voice_pipeline_t* pipeline) {
+  pipeline_run_voice(pipeline);
+}
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * @file pipeline.h
+ * @brief Shared pipeline state for the voice assistant demo
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ * Licensed under CC BY-NC-SA 4.0
+ */
+
+#ifndef VOICE_ASSISTANT_PIPELINE_H
+#define VOICE_ASSISTANT_PIPELINE_H
+
+#include <stdbool.h>
+
+#include "ethervox/audio.h"
+#include "ethervox/config_snapshot.h"
+#include "ethervox/dialogue.h"
+#include "ethervox/llm.h"
+#include "ethervox/model_manager.h"
+#include "ethervox/platform.h"
+#include "ethervox/stt.h"
+#include "ethervox/vad.h"
+#include "ethervox/wake_word.h"
+
+// Pipeline state
+typedef enum {
+  STATE_LISTENING_FOR_WAKE,
+  STATE_RECORDING_SPEECH,
+  STATE_PROCESSING_INTENT,
+  STATE_GENERATING_RESPONSE
+} pipeline_state_t;
+
+typedef struct {
+  bool text_mode;
+
+  // Immutable tunables snapshot built in pipeline_init; strings handed to
+  // stage configs (e.g. the wake word) point into it, so it is held for the
+  // pipeline's lifetime and unref'd in pipeline_cleanup
+  ethervox_config_snapshot_t* settings;
+
+  // Platform
+  ethervox_platform_t platform;
+
+  // Audio
+  ethervox_audio_runtime_t audio;
+  ethervox_audio_config_t audio_config;
+
+  // Wake word
+  ethervox_wake_runtime_t wake;
+  ethervox_wake_config_t wake_config;
+
+  // STT
+  ethervox_stt_runtime_t stt;
+  ethervox_stt_config_t stt_config;
+
+  // Voice activity detection
+  ethervox_vad_runtime_t vad;
+  ethervox_vad_config_t vad_config;
+
+  // Dialogue
+  ethervox_dialogue_engine_t dialogue;
+  ethervox_llm_config_t llm_config;
+
+  // LLM Backend
+  ethervox_llm_backend_t* llm_backend;
+  bool llm_enabled;
+  volatile bool llm_loading;  // Background model load still in flight
+  char* model_path;
+
+  // Model Manager
+  ethervox_model_manager_t* model_manager;
+  bool auto_download_models;
+
+  // State
+  pipeline_state_t state;
+  char* context_id;
+  volatile bool running;
+  bool audio_ready;
+  bool wake_ready;
+  bool stt_ready;
+  bool vad_ready;
+  char language_code[8];
+  char stt_language[16];
+} voice_pipeline_t;
+
+// Single-threaded loop (main.c); used directly on platforms without threads
+void pipeline_run_voice(voice_pipeline_t* pipeline);
+
+// Block until the background model load (if any) settles (main.c). Callers
+// generating a response check llm_enabled after this returns
+void pipeline_wait_for_llm(voice_pipeline_t* pipeline);
+
+// Threaded pipeline (pipeline.c): capture thread -> bounded SPSC queue ->
+// wake/STT worker -> transcript queue -> dialogue/LLM worker, with overrun
+// counters. This is the deployment reference architecture.
+void pipeline_run_voice_threaded(voice_pipeline_t* pipeline);
+
+#endif  // VOICE_ASSISTANT_PIPELINE_H
@@ -33,6 +33,8 @@ typedef struct {
   uint32_t buffer_size;
   bool enable_noise_suppression;
   bool enable_echo_cancellation;
+  bool use_mmap_capture;  // Linux: mmap'd kernel ring + poll wakeups instead of
+                          // blocking reads (falls back if the device refuses)
 } ethervox_audio_config_t;
 
 // Audio buffer structure
@@ -50,6 +52,23 @@ typedef struct {
   bool is_ambient;  // True if detected without wake word
 } ethervox_language_detect_t;
 
+// Incremental language identifier. Callers feed capture frames as they
+// arrive; the detector accumulates lightweight phonotactic features
+// (zero-crossing rate, spectral tilt, energy modulation per 10 ms frame)
+// against per-language profiles and decides as soon as one language's
+// posterior clears the confidence threshold, or after ~500 ms of audio.
+// Per-frame cost is a fixed handful of ops per sample and drops to a single
+// branch once a decision is made.
+typedef struct {
+  float scores[ETHERVOX_MAX_LANGUAGES];  // Accumulated per-language log-likelihood
+  float prev_energy;                     // For the modulation feature
+  uint32_t frames_seen;
+  uint32_t samples_seen;
+  bool decided;
+  char language_code[ETHERVOX_LANG_CODE_LEN];
+  float confidence;
+} ethervox_language_detector_t;
+
 // Forward declaration to avoid circular dependency with stt.h
 struct ethervox_stt_result;
 typedef struct ethervox_stt_result ethervox_stt_result_t;
@@ -61,8 +80,36 @@ typedef struct {
   float speech_rate;
   float pitch;
   const char* voice_id;
+  uint64_t trace_id;  // Turn trace id carried from the LLM response (0 =
+                      // untraced); see ethervox/trace.h
 } ethervox_tts_request_t;
 
+// Fixed-capacity buffer pool: one slab carved into equally sized slots with a
+// per-slot in-use flag. All memory is allocated once at init so steady-state
+// acquire/release never touches the heap; the API lives in audio_buffer.h.
+typedef struct {
+  uint8_t* slab;
+  bool* in_use;
+  uint32_t slot_count;
+  uint32_t slot_bytes;
+  uint32_t peak_in_use;  // High-water mark for sizing diagnostics
+  bool is_initialized;
+} ethervox_audio_buffer_pool_t;
+
+// Pre-allocated capture slot ring (single producer / single consumer).
+// The capture driver acquires slots, fills them in place and hands them to the
+// caller through ethervox_audio_read(); the caller returns them with
+// ethervox_audio_buffer_recycle(). Counters are only ever advanced by one side
+// each, so no locking is needed as long as the SPSC discipline is respected.
+typedef struct {
+  int16_t* slab;          // slot_count * slot_samples int16 samples
+  uint32_t* free_slots;   // circular queue of free slot indices
+  uint32_t slot_count;
+  uint32_t slot_samples;  // samples per slot (frames * channels)
+  uint32_t acquire_pos;  // advanced by the capture side only (release/acquire)
+  uint32_t recycle_pos;  // advanced by the consumer side only (release/acquire)
+} ethervox_audio_capture_ring_t;
+
 // Audio runtime interface
 typedef struct ethervox_audio_runtime ethervox_audio_runtime_t;
 
@@ -82,6 +129,8 @@ typedef struct {
 struct ethervox_audio_runtime {
   ethervox_audio_config_t config;
   ethervox_audio_driver_t driver;
+  ethervox_audio_capture_ring_t capture_ring;
+  ethervox_audio_buffer_pool_t playback_pool;
   void* platform_data;
   bool is_initialized;
   bool is_capturing;
@@ -107,19 +156,84 @@ int ethervox_audio_start_capture(ethervox_audio_runtime_t* runtime);
 int ethervox_audio_stop_capture(ethervox_audio_runtime_t* runtime);
 int ethervox_audio_read(ethervox_audio_runtime_t* runtime, ethervox_audio_buffer_t* buffer);
 
+// Sample format conversion and resampling (SIMD-dispatched where available).
+// Capture buffers carry raw device-rate int16 PCM; these helpers normalize
+// them once per buffer to the 16 kHz float stream the recognition paths
+// expect, instead of every consumer re-interpreting the samples itself.
+int ethervox_audio_convert_int16_to_float(const int16_t* input, float* output,
+                                          uint32_t sample_count);
+int ethervox_audio_resample(const float* input, uint32_t input_count, uint32_t input_rate,
+                            float* output, uint32_t output_capacity, uint32_t* output_count,
+                            uint32_t output_rate);
+int ethervox_audio_capture_to_float(const ethervox_audio_buffer_t* capture, uint32_t capture_rate,
+                                    float* output, uint32_t output_capacity,
+                                    uint32_t* output_count);
+
 // Speech processing functions
 int ethervox_tts_synthesize(ethervox_audio_runtime_t* runtime,
                             const ethervox_tts_request_t* request, ethervox_audio_buffer_t* output);
+
+// Chunk callback for streaming synthesis. The chunk's data lives in the
+// playback pool and is only valid for the duration of the call — consume it
+// (typically by writing it to the output device) before returning. is_last
+// marks the final chunk. Return 0 to continue, non-zero to abort synthesis.
+typedef int (*ethervox_tts_chunk_callback_t)(const ethervox_audio_buffer_t* chunk, bool is_last,
+                                             void* user_data);
+
+// Streaming variant of ethervox_tts_synthesize(): emits fixed-size PCM
+// chunks through on_chunk as they are generated, so playback can begin
+// after the first chunk instead of after the whole utterance. chunk_samples
+// of 0 picks a default (100 ms at the configured sample rate).
+int ethervox_tts_synthesize_stream(ethervox_audio_runtime_t* runtime,
+                                   const ethervox_tts_request_t* request, uint32_t chunk_samples,
+                                   ethervox_tts_chunk_callback_t on_chunk, void* user_data);
 int ethervox_language_detect(const ethervox_audio_buffer_t* buffer,
                              ethervox_language_detect_t* result);
 
+// Incremental language identification over successive capture buffers.
+// Returns 1 once a language is decided (result is filled; further calls are
+// no-ops until reset), 0 while more audio is needed, -1 on error.
+void ethervox_language_detector_reset(ethervox_language_detector_t* detector);
+int ethervox_language_detector_feed(ethervox_language_detector_t* detector,
+                                    const ethervox_audio_buffer_t* buffer, uint32_t sample_rate,
+                                    ethervox_language_detect_t* result);
+
 // Utility functions
 ethervox_audio_config_t ethervox_audio_get_default_config(void);
 void ethervox_audio_buffer_free(ethervox_audio_buffer_t* buffer);
+void ethervox_audio_buffer_recycle(ethervox_audio_runtime_t* runtime,
+                                   ethervox_audio_buffer_t* buffer);
+
+// Capture ring helpers (used by platform drivers; ring lifetime is managed by
+// ethervox_audio_init()/ethervox_audio_cleanup())
+int ethervox_audio_capture_ring_init(ethervox_audio_capture_ring_t* ring, uint32_t slot_count,
+                                     uint32_t slot_samples);
+void ethervox_audio_capture_ring_cleanup(ethervox_audio_capture_ring_t* ring);
+int16_t* ethervox_audio_capture_ring_acquire(ethervox_audio_capture_ring_t* ring);
 
 // Platform-specific driver registration
 int ethervox_audio_register_platform_driver(ethervox_audio_runtime_t* runtime);
 
+// Forward declarations to avoid a circular include with wake_word.h
+struct ethervox_wake_runtime;
+struct ethervox_wake_result;
+typedef void (*ethervox_wake_detected_callback_t)(const struct ethervox_wake_result* result,
+                                                  void* user_data);
+
+// ESP32 only: split capture and wake-word processing across the two cores.
+// An I2S capture task pinned to core 0 feeds fixed-size frames into a FreeRTOS
+// stream buffer; a processing task pinned to core 1 drains it, runs the wake
+// detector and delivers frames through runtime->on_audio_data. When the buffer
+// backlog crosses the high watermark the processing task skips detection and
+// drains until the low watermark, so capture never blocks on a slow detection
+// pass. on_wake fires (with runtime->user_data) whenever the wake word is
+// spotted. Replaces the polling ethervox_audio_read() loop; stop with
+// ethervox_audio_esp32_stop_dual_core() before cleanup.
+int ethervox_audio_esp32_start_dual_core(ethervox_audio_runtime_t* runtime,
+                                         struct ethervox_wake_runtime* wake_runtime,
+                                         ethervox_wake_detected_callback_t on_wake);
+int ethervox_audio_esp32_stop_dual_core(ethervox_audio_runtime_t* runtime);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,68 @@
+/**
+ * @file audio_buffer.h
+ * @brief Fixed-capacity audio buffer pool for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_AUDIO_BUFFER_H
+#define ETHERVOX_AUDIO_BUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The pool type itself lives in audio.h (the runtime embeds one); this header
+// only adds the operations on it
+#include "ethervox/audio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initialize a pool of slot_count buffers of slot_bytes each
+ *
+ * @return 0 on success, -1 on error
+ */
+int ethervox_audio_buffer_pool_init(ethervox_audio_buffer_pool_t* pool, uint32_t slot_count,
+                                    uint32_t slot_bytes);
+
+/**
+ * Acquire a buffer of at most slot_bytes bytes
+ *
+ * Fills buffer->data/size; fails (returns -1) if the request exceeds the slot
+ * size or every slot is in flight, in which case callers may fall back to the
+ * heap and release through the same API.
+ */
+int ethervox_audio_buffer_pool_acquire(ethervox_audio_buffer_pool_t* pool, uint32_t bytes,
+                                       ethervox_audio_buffer_t* buffer);
+
+/**
+ * Return a buffer to the pool; heap-allocated buffers are freed instead
+ */
+void ethervox_audio_buffer_pool_release(ethervox_audio_buffer_pool_t* pool,
+                                        ethervox_audio_buffer_t* buffer);
+
+/**
+ * Check whether the buffer data points into the pool slab
+ */
+bool ethervox_audio_buffer_pool_owns(const ethervox_audio_buffer_pool_t* pool, const float* data);
+
+/**
+ * Release the slab; all outstanding buffers become invalid
+ */
+void ethervox_audio_buffer_pool_cleanup(ethervox_audio_buffer_pool_t* pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_AUDIO_BUFFER_H
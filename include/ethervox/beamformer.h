@@ -0,0 +1,105 @@
+/**
+ * @file beamformer.h
+ * @brief Delay-and-sum microphone array beamformer for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_BEAMFORMER_H
+#define ETHERVOX_BEAMFORMER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ethervox/audio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Beamformer configuration. The array is modeled as uniform and linear with
+// channel 0 at the reference end; steering delays are derived from spacing,
+// sample rate and the steering angle (0 = broadside, positive towards the
+// higher-numbered mics).
+typedef struct {
+  uint32_t channel_count;     // 2..ETHERVOX_PLATFORM_MIC_COUNT
+  uint32_t sample_rate;
+  uint32_t max_frames;        // Largest per-channel frame count per buffer
+  float mic_spacing_m;        // Distance between adjacent mics
+  float steering_angle_deg;   // -90..90, 0 = broadside
+} ethervox_beamformer_config_t;
+
+// Beamformer runtime state. Per-channel scratch keeps the tail of the
+// previous buffer so steering delays stay continuous across buffer
+// boundaries.
+typedef struct {
+  ethervox_beamformer_config_t config;
+  uint32_t delays[ETHERVOX_PLATFORM_MIC_COUNT];  // Per-channel delay in samples
+  float weights[ETHERVOX_PLATFORM_MIC_COUNT];    // Per-channel gain (sums to 1)
+  uint32_t max_delay;
+  float* scratch;        // channel_count * (max_delay + max_frames) floats
+  uint32_t scratch_stride;
+  bool is_initialized;
+} ethervox_beamformer_runtime_t;
+
+/**
+ * Get default beamformer configuration (full 8-mic array, broadside)
+ */
+ethervox_beamformer_config_t ethervox_beamformer_get_default_config(void);
+
+/**
+ * Initialize beamformer state and allocate per-channel scratch
+ *
+ * @param runtime Beamformer runtime structure
+ * @param config Configuration (NULL for defaults)
+ * @return 0 on success, -1 on error
+ */
+int ethervox_beamformer_init(ethervox_beamformer_runtime_t* runtime,
+                             const ethervox_beamformer_config_t* config);
+
+/**
+ * Re-aim the beam without resetting channel history
+ *
+ * @param angle_deg New steering angle (-90..90, 0 = broadside)
+ * @return 0 on success, -1 on error
+ */
+int ethervox_beamformer_steer(ethervox_beamformer_runtime_t* runtime, float angle_deg);
+
+/**
+ * Combine one multi-channel capture buffer into a single enhanced channel
+ *
+ * The input carries interleaved int16 PCM with buffer->channels channels and
+ * size in bytes (see platform read); output receives one normalized float
+ * sample per frame, ready for ethervox_wake_process()/ethervox_stt_process().
+ *
+ * @param output Caller-provided array of at least frames floats
+ * @param frames_out Receives the number of output samples written
+ * @return 0 on success, -1 on error
+ */
+int ethervox_beamformer_process(ethervox_beamformer_runtime_t* runtime,
+                                const ethervox_audio_buffer_t* audio_buffer, float* output,
+                                uint32_t* frames_out);
+
+/**
+ * Clear channel history (e.g. after a capture restart)
+ */
+void ethervox_beamformer_reset(ethervox_beamformer_runtime_t* runtime);
+
+/**
+ * Release scratch memory
+ */
+void ethervox_beamformer_cleanup(ethervox_beamformer_runtime_t* runtime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_BEAMFORMER_H
@@ -0,0 +1,161 @@
+/**
+ * @file config_snapshot.h
+ * @brief Immutable, refcounted configuration snapshots for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_CONFIG_SNAPSHOT_H
+#define ETHERVOX_CONFIG_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Immutable key/value configuration snapshot
+ *
+ * Every subsystem init today strdups its own config strings and owns the
+ * fragments separately, so re-configuration means tearing whole runtimes
+ * down. A snapshot packs all keys and values into one arena block (values
+ * are interned: equal strings share storage), is immutable after build, and
+ * is refcounted: holders read it without any locking because nothing ever
+ * mutates it, and the last unref frees the single block. Swapping the
+ * published snapshot in a store is a pointer exchange, not a re-init.
+ */
+typedef struct ethervox_config_snapshot ethervox_config_snapshot_t;
+
+/**
+ * @brief Mutable builder used to assemble a snapshot
+ */
+typedef struct ethervox_config_builder ethervox_config_builder_t;
+
+/**
+ * @brief Create an empty builder
+ * @return Builder handle, or NULL on allocation failure
+ */
+ethervox_config_builder_t* ethervox_config_builder_create(void);
+
+/**
+ * @brief Create a builder pre-filled with a snapshot's entries
+ *
+ * The cheap way to derive "the current config with one key changed".
+ */
+ethervox_config_builder_t* ethervox_config_builder_from(
+    const ethervox_config_snapshot_t* snapshot);
+
+/**
+ * @brief Set a key (replacing any existing value); NULL value removes the key
+ * @return 0 on success, -1 on error
+ */
+int ethervox_config_builder_set(ethervox_config_builder_t* builder, const char* key,
+                                const char* value);
+
+/**
+ * @brief Pack the builder into an immutable snapshot and destroy the builder
+ *
+ * The returned snapshot starts with one reference owned by the caller.
+ *
+ * @return Snapshot, or NULL on error (the builder is destroyed either way)
+ */
+ethervox_config_snapshot_t* ethervox_config_builder_finish(ethervox_config_builder_t* builder);
+
+/**
+ * @brief Destroy a builder without producing a snapshot
+ */
+void ethervox_config_builder_destroy(ethervox_config_builder_t* builder);
+
+/**
+ * @brief Take an additional reference
+ * @return snapshot, for convenient assignment
+ */
+ethervox_config_snapshot_t* ethervox_config_snapshot_ref(ethervox_config_snapshot_t* snapshot);
+
+/**
+ * @brief Drop a reference; the last one frees the snapshot
+ */
+void ethervox_config_snapshot_unref(ethervox_config_snapshot_t* snapshot);
+
+/**
+ * @brief Look up a key
+ *
+ * The returned string lives inside the snapshot's arena and stays valid for
+ * as long as the caller holds a reference — no copy, no per-call allocation.
+ *
+ * @return The value, or default_value when the key is absent
+ */
+const char* ethervox_config_snapshot_get(const ethervox_config_snapshot_t* snapshot,
+                                         const char* key, const char* default_value);
+
+/** @brief Typed lookups parsing on top of ethervox_config_snapshot_get() */
+bool ethervox_config_snapshot_get_bool(const ethervox_config_snapshot_t* snapshot,
+                                       const char* key, bool default_value);
+uint32_t ethervox_config_snapshot_get_uint(const ethervox_config_snapshot_t* snapshot,
+                                           const char* key, uint32_t default_value);
+float ethervox_config_snapshot_get_float(const ethervox_config_snapshot_t* snapshot,
+                                         const char* key, float default_value);
+
+/**
+ * @brief Number of entries in the snapshot
+ */
+uint32_t ethervox_config_snapshot_count(const ethervox_config_snapshot_t* snapshot);
+
+/**
+ * @brief Entry access by index (sorted by key), for builder_from and dumps
+ * @return 0 on success, -1 when index is out of range
+ */
+int ethervox_config_snapshot_at(const ethervox_config_snapshot_t* snapshot, uint32_t index,
+                                const char** key, const char** value);
+
+/**
+ * @brief Published-configuration store with atomic snapshot swap
+ *
+ * Holds the "current" snapshot. Readers acquire a referenced snapshot with
+ * load() and then read it with zero synchronization (it is immutable);
+ * writers publish a replacement with swap(), which is a pointer exchange —
+ * subsystems pick the new config up on their next load instead of being
+ * restarted. Acquire/publish are guarded internally; without pthreads the
+ * store degrades to plain (single-threaded) pointer handling.
+ */
+typedef struct ethervox_config_store ethervox_config_store_t;
+
+/**
+ * @brief Create a store publishing initial (the store takes over the
+ *        caller's reference; initial may be NULL)
+ */
+ethervox_config_store_t* ethervox_config_store_create(ethervox_config_snapshot_t* initial);
+
+/**
+ * @brief Get the current snapshot with a reference the caller must unref
+ * @return Referenced snapshot, or NULL when none is published
+ */
+ethervox_config_snapshot_t* ethervox_config_store_load(ethervox_config_store_t* store);
+
+/**
+ * @brief Publish a new snapshot (taking over the caller's reference) and
+ *        release the previously published one
+ */
+void ethervox_config_store_swap(ethervox_config_store_t* store,
+                                ethervox_config_snapshot_t* snapshot);
+
+/**
+ * @brief Destroy the store, releasing its published snapshot
+ */
+void ethervox_config_store_destroy(ethervox_config_store_t* store);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_CONFIG_SNAPSHOT_H
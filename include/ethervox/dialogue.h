@@ -69,7 +69,11 @@ typedef struct {
   float confidence;
   ethervox_entity_t* entities;
   uint32_t entity_count;
-  void* context;  // Additional context data
+  void* context;       // Additional context data
+  bool arena_backed;   // Strings owned by the engine's turn arena; freed by
+                       // ethervox_dialogue_reset_turn_arena(), not per-field
+  uint64_t trace_id;   // Turn trace id carried from the intent request (0 =
+                       // untraced); see ethervox/trace.h
 } ethervox_intent_t;
 
 // LLM model configuration
@@ -83,6 +87,18 @@ typedef struct {
   uint32_t seed;
   bool use_gpu;
   uint32_t gpu_layers;
+  bool use_mmap;   // Map model weights instead of buffered reads (fast cold
+                   // start, near-instant warm restart via the page cache)
+  bool use_mlock;  // Pin mapped weights so they can't be paged out
+  bool use_speculative;    // Draft/verify decoding: a small draft model
+                           // proposes tokens the main model verifies in one
+                           // batched pass. Output is identical (only tokens
+                           // the main model sampled itself are emitted);
+                           // decode throughput improves whenever drafts are
+                           // accepted. Requires draft_model_path.
+  char* draft_model_path;  // GGUF path of the draft model (TinyLlama class;
+                           // must share the main model's vocabulary)
+  uint32_t draft_tokens;   // Tokens drafted per verify pass (0 = default 4)
   char* language_code;
 } ethervox_llm_config_t;
 
@@ -99,6 +115,9 @@ typedef struct {
   bool truncated;
   char* finish_reason;
   size_t tokens_used;  // Add if missing
+  bool arena_backed;   // Strings owned by the engine's turn arena; freed by
+                       // ethervox_dialogue_reset_turn_arena(), not per-field
+  uint64_t trace_id;   // Turn trace id carried from the intent (0 = untraced)
 } ethervox_llm_response_t;
 
 // Dialogue context
@@ -106,9 +125,10 @@ typedef struct {
   char* conversation_id;
   char* user_id;
   char current_language[ETHERVOX_LANG_CODE_LEN];
-  ethervox_intent_t* conversation_history;
+  ethervox_intent_t* conversation_history;  // Fixed ring buffer of max_history slots
   uint32_t history_count;
   uint32_t max_history;
+  uint32_t history_head;  // Oldest entry; advances when a full ring wraps
   void* user_preferences;
   uint64_t last_interaction_time;
 } ethervox_dialogue_context_t;
@@ -133,6 +153,17 @@ typedef struct {
   // Intent parsing patterns
   void* intent_patterns;  // Platform-specific pattern storage
 
+  // Internal O(1) context bookkeeping: open-addressed hash of conversation_id
+  // to contexts index, plus a LIFO of free slots for allocation
+  uint32_t* context_index;
+  uint32_t context_index_capacity;
+  uint32_t* context_free_slots;
+  uint32_t context_free_count;
+  uint32_t context_index_tombstones;  // Triggers a rebuild when they pile up
+
+  // Bump allocator for turn-scoped strings (internal)
+  void* turn_arena;
+
   // Callbacks
   void (*on_intent_detected)(const ethervox_intent_t* intent, void* user_data);
   void (*on_response_ready)(const ethervox_llm_response_t* response, void* user_data);
@@ -145,6 +176,7 @@ typedef struct {
 typedef struct {
   const char* text;
   const char* language_code;
+  uint64_t trace_id;  // From ethervox_trace_begin(); 0 leaves the turn untraced
 } ethervox_dialogue_intent_request_t;
 
 typedef struct {
@@ -166,6 +198,20 @@ int ethervox_dialogue_process_llm(ethervox_dialogue_engine_t* engine,
                                   const ethervox_intent_t* intent, const char* context_id,
                                   ethervox_llm_response_t* response);
 
+// Incremental token callback for streaming responses; is_final is set on the
+// last chunk of the response
+typedef void (*ethervox_dialogue_token_callback_t)(const char* token, bool is_final,
+                                                   void* user_data);
+
+// Streaming variant of ethervox_dialogue_process_llm(): forwards the response
+// to on_token in clause-sized chunks as it becomes available, so TTS can begin
+// speaking the first clause while the rest generates. The complete response is
+// still returned in response, and on_response_ready fires after the last chunk.
+int ethervox_dialogue_process_llm_stream(ethervox_dialogue_engine_t* engine,
+                                         const ethervox_intent_t* intent, const char* context_id,
+                                         ethervox_dialogue_token_callback_t on_token,
+                                         void* user_data, ethervox_llm_response_t* response);
+
 // Context management
 int ethervox_dialogue_create_context(ethervox_dialogue_engine_t* engine,
                                      const ethervox_dialogue_context_request_t* request,
@@ -174,6 +220,20 @@ int ethervox_dialogue_get_context(ethervox_dialogue_engine_t* engine, const char
                                   ethervox_dialogue_context_t** context);
 void ethervox_dialogue_destroy_context(ethervox_dialogue_engine_t* engine, const char* context_id);
 
+// Grow the number of simultaneous conversations the engine supports (default
+// 16). Existing contexts are preserved; shrinking is not supported.
+int ethervox_dialogue_set_max_contexts(ethervox_dialogue_engine_t* engine, uint32_t max_contexts);
+
+// Append a deep copy of intent to the context's history ring. O(1) and never
+// moves existing entries: once the ring is full the oldest entry is freed and
+// its slot reused in place, so history memory per context is a hard constant.
+int ethervox_dialogue_context_add_history(ethervox_dialogue_context_t* context,
+                                          const ethervox_intent_t* intent);
+
+// Read a history entry by age (0 = most recent turn); NULL when out of range
+const ethervox_intent_t* ethervox_dialogue_context_history_at(
+    const ethervox_dialogue_context_t* context, uint32_t age);
+
 int ethervox_dialogue_set_language(ethervox_dialogue_engine_t* engine, const char* language_code);
 const char* ethervox_dialogue_get_language(const ethervox_dialogue_engine_t* engine);
 
@@ -187,6 +247,12 @@ ethervox_llm_config_t ethervox_dialogue_get_default_llm_config(void);
 const char* ethervox_dialogue_detect_system_language(void);
 void ethervox_intent_free(ethervox_intent_t* intent);
 void ethervox_llm_response_free(ethervox_llm_response_t* response);
+
+// Releases every turn-scoped string the engine handed out (intent and
+// response strings from parse_intent/process_llm) in one O(1) step. Call once
+// per conversational turn after the turn's results have been consumed; the
+// per-object free functions are no-ops for arena-backed objects.
+void ethervox_dialogue_reset_turn_arena(ethervox_dialogue_engine_t* engine);
 const char* ethervox_intent_type_to_string(ethervox_intent_type_t type);
 const char* ethervox_entity_type_to_string(ethervox_entity_type_t type);
 
@@ -0,0 +1,142 @@
+/**
+ * @file echo_cancel.h
+ * @brief Partitioned-block frequency-domain acoustic echo canceller for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_ECHO_CANCEL_H
+#define ETHERVOX_ECHO_CANCEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ethervox/audio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Echo canceller configuration. The adaptive filter models the speaker-to-mic
+// path as block_size * partition_count samples of impulse response; at 16 kHz
+// the defaults cover 192 ms of room echo, enough for a tabletop device.
+typedef struct {
+  uint32_t sample_rate;
+  uint32_t block_size;       // Samples per processed block; power of two
+  uint32_t partition_count;  // Filter tail in blocks (1..ETHERVOX_ECHO_CANCEL_MAX_PARTITIONS)
+  float learning_rate;       // Normalized adaptation step, (0..1]
+} ethervox_echo_cancel_config_t;
+
+#define ETHERVOX_ECHO_CANCEL_MAX_PARTITIONS 32
+
+// Echo canceller runtime state. Reference and capture meet block-by-block in
+// the frequency domain: spectra of the last partition_count playback blocks
+// are kept in a ring, and one complex multiply-accumulate across the ring
+// replaces a time-domain convolution over the whole filter tail.
+typedef struct {
+  ethervox_echo_cancel_config_t config;
+  uint32_t fft_size;  // 2 * block_size (overlap-save)
+
+  // Precomputed FFT tables
+  float* twiddle_cos;
+  float* twiddle_sin;
+  uint32_t* bit_reverse;
+
+  // Frequency-domain state, planar complex (re/im in separate arrays so the
+  // per-bin arithmetic vectorizes): partition ring of reference spectra, the
+  // adaptive weights, and the smoothed per-bin reference power
+  float* ref_spectra_re;  // partition_count * fft_size
+  float* ref_spectra_im;
+  float* weights_re;      // partition_count * fft_size
+  float* weights_im;
+  float* ref_power;       // fft_size
+  uint32_t spectra_head;  // Ring slot holding the newest reference block
+
+  // Time-domain staging
+  float* ref_window;   // Last fft_size reference samples
+  float* ref_fifo;     // Playback samples queued ahead of capture
+  uint32_t ref_fifo_capacity;
+  uint32_t ref_fifo_head;
+  uint32_t ref_fifo_count;
+
+  // Per-block scratch (FFT work buffers and the per-bin adaptation gain)
+  float* scratch_re;
+  float* scratch_im;
+  float* error_re;
+  float* error_im;
+  float* gain;
+
+  bool is_initialized;
+} ethervox_echo_cancel_runtime_t;
+
+/**
+ * Get default echo canceller configuration (256-sample blocks, 192 ms tail)
+ */
+ethervox_echo_cancel_config_t ethervox_echo_cancel_get_default_config(void);
+
+/**
+ * Initialize echo canceller state and allocate filter memory
+ *
+ * This is the stage behind ethervox_audio_config_t.enable_echo_cancellation:
+ * the application feeds every buffer it sends to write_audio() into
+ * ethervox_echo_cancel_feed_playback() and runs capture through
+ * ethervox_echo_cancel_process() before wake word / STT, so the mic stream
+ * stays usable while TTS is playing and "stop!" can interrupt playback.
+ *
+ * @param runtime Echo canceller runtime structure
+ * @param config Configuration (NULL for defaults)
+ * @return 0 on success, -1 on error
+ */
+int ethervox_echo_cancel_init(ethervox_echo_cancel_runtime_t* runtime,
+                              const ethervox_echo_cancel_config_t* config);
+
+/**
+ * Queue playback samples as the echo reference
+ *
+ * Call with the same mono float samples handed to the playback path, in
+ * order. Playback and capture are assumed to share a clock (one ALSA card);
+ * queued reference that overflows the internal FIFO drops oldest-first.
+ *
+ * @param samples Mono float samples, as played
+ * @return 0 on success, -1 on error
+ */
+int ethervox_echo_cancel_feed_playback(ethervox_echo_cancel_runtime_t* runtime,
+                                       const float* samples, uint32_t sample_count);
+
+/**
+ * Remove the estimated echo from one capture buffer, in place
+ *
+ * sample_count must be a multiple of block_size (the standard capture buffer
+ * sizes all are). When no reference is queued the stage passes capture
+ * through unchanged and the filter does not adapt.
+ *
+ * @param capture Mono float capture samples; echo-reduced on return
+ * @return 0 on success, -1 on error
+ */
+int ethervox_echo_cancel_process(ethervox_echo_cancel_runtime_t* runtime, float* capture,
+                                 uint32_t sample_count);
+
+/**
+ * Clear the adaptive filter and all queued reference (e.g. after a device
+ * restart, when the echo path has changed)
+ */
+void ethervox_echo_cancel_reset(ethervox_echo_cancel_runtime_t* runtime);
+
+/**
+ * Release filter memory
+ */
+void ethervox_echo_cancel_cleanup(ethervox_echo_cancel_runtime_t* runtime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_ECHO_CANCEL_H
@@ -128,12 +128,35 @@ void ethervox_error_set_context(
     const char* function
 );
 
+/**
+ * @brief Nested causes kept per thread (preallocated, no heap)
+ */
+#ifndef ETHERVOX_ERROR_CHAIN_DEPTH
+#define ETHERVOX_ERROR_CHAIN_DEPTH 4
+#endif
+
 /**
  * @brief Get last error context
  * @return Pointer to error context (may be NULL if no error set)
  */
 const ethervox_error_context_t* ethervox_error_get_context(void);
 
+/**
+ * @brief Walk the current thread's error chain
+ *
+ * Each ethervox_error_set_context() call pushes on top of the previous one,
+ * so a failure recorded deep in a driver stays visible as the cause of the
+ * error the caller reports. Depth 0 is the most recent context.
+ * @param depth Steps back through the chain
+ * @return Context at that depth, or NULL past the end of the chain
+ */
+const ethervox_error_context_t* ethervox_error_get_cause(uint32_t depth);
+
+/**
+ * @brief Number of contexts currently in this thread's chain
+ */
+uint32_t ethervox_error_chain_length(void);
+
 /**
  * @brief Clear error context
  */
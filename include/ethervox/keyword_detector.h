@@ -0,0 +1,86 @@
+/**
+ * @file keyword_detector.h
+ * @brief MFCC/DTW keyword spotting front-end for wake word detection
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_KEYWORD_DETECTOR_H
+#define ETHERVOX_KEYWORD_DETECTOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ethervox/wake_word.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque detector state (MFCC front-end + DTW matcher)
+typedef struct ethervox_keyword_detector ethervox_keyword_detector_t;
+
+/**
+ * Create a keyword detector for the configured wake word(s)
+ *
+ * If a keyword has a template file (raw float32 MFCC frames recorded with the
+ * same front-end, 13 coefficients per frame; config->model_path for the single
+ * keyword, config->model_paths entries in multi-keyword mode), detection runs
+ * DTW against it. Without a template the matcher falls back to a
+ * speech-shaped segment gate derived from that keyword's syllable count,
+ * which still rejects broadband noise and taps that fooled the old
+ * energy-only threshold.
+ *
+ * The framing/FFT/MFCC front-end is shared: it runs once per buffer
+ * regardless of how many keywords are configured, and only the cheap
+ * per-segment matchers multiply with the keyword count.
+ *
+ * @return Detector handle, or NULL on error
+ */
+ethervox_keyword_detector_t* ethervox_keyword_detector_create(const ethervox_wake_config_t* config);
+
+/**
+ * Feed captured int16 samples to the detector
+ *
+ * @param detector Detector handle
+ * @param samples Raw int16 PCM at the configured sample rate
+ * @param sample_count Number of samples
+ * @param confidence Detection confidence for a completed utterance (output)
+ * @param keyword_index Index of the best-matching configured keyword on
+ *                      detection (output, may be NULL)
+ * @return 1 if a wake word was detected, 0 if not, -1 on error
+ */
+int ethervox_keyword_detector_process(ethervox_keyword_detector_t* detector,
+                                      const int16_t* samples, uint32_t sample_count,
+                                      float* confidence, uint32_t* keyword_index);
+
+/**
+ * Keyword string for an index reported by ethervox_keyword_detector_process()
+ * (borrowed from the creating config); NULL when out of range
+ */
+const char* ethervox_keyword_detector_keyword_at(const ethervox_keyword_detector_t* detector,
+                                                 uint32_t index);
+
+/**
+ * Reset segment tracking (e.g., after a detection was consumed)
+ */
+void ethervox_keyword_detector_reset(ethervox_keyword_detector_t* detector);
+
+/**
+ * Destroy the detector and free all state
+ */
+void ethervox_keyword_detector_destroy(ethervox_keyword_detector_t* detector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_KEYWORD_DETECTOR_H
@@ -48,6 +48,8 @@ typedef struct {
   const char* model_format;  // "GGUF", "GGML", "API", etc.
 } ethervox_llm_capabilities_t;
 
+struct ethervox_llm_batch_request;
+
 // LLM backend interface
 typedef struct ethervox_llm_backend {
   ethervox_llm_backend_type_t type;
@@ -75,11 +77,46 @@ typedef struct ethervox_llm_backend {
                         const char* language_code,
                         void (*callback)(const char* token, void* user_data),
                         void* user_data);
-  
+
+  // Optional cross-turn context caching: the backend keeps the KV cache for
+  // conversation_id resident and only prefills tokens not seen last turn
+  int (*generate_cached)(struct ethervox_llm_backend* backend,
+                        const char* prompt,
+                        const char* language_code,
+                        const char* conversation_id,
+                        ethervox_llm_response_t* response);
+
+  // Optional batched generation: every request decodes in the same forward
+  // passes, so N concurrent sessions share the model's batch dimension
+  // instead of serializing (see ethervox_llm_batch_request_t)
+  int (*generate_batch)(struct ethervox_llm_backend* backend,
+                        struct ethervox_llm_batch_request* requests,
+                        uint32_t request_count);
+
+  // Optional raw tokenization (no BOS/special tokens added). Returns the
+  // number of tokens written, or the negated required count when capacity is
+  // too small (so callers can size a retry), or another negative error.
+  int (*tokenize)(struct ethervox_llm_backend* backend,
+                  const char* text,
+                  int32_t* tokens,
+                  uint32_t capacity);
+
   bool is_loaded;
   bool is_initialized;
 } ethervox_llm_backend_t;
 
+// One session's slice of a batched generation. Token callbacks interleave
+// across the batch in round-robin order as the shared decode loop advances;
+// status carries the per-request outcome once the batch returns.
+typedef struct ethervox_llm_batch_request {
+  const char* prompt;
+  const char* language_code;
+  const char* conversation_id;  // Optional KV-cache key (NULL = uncached)
+  void (*on_token)(const char* token, void* user_data);
+  void* user_data;
+  int status;  // ETHERVOX_SUCCESS or an error code, set per request
+} ethervox_llm_batch_request_t;
+
 // Backend creation functions
 ethervox_llm_backend_t* ethervox_llm_create_llama_backend(void);
 ethervox_llm_backend_t* ethervox_llm_create_tinyllama_backend(void);
@@ -100,10 +137,147 @@ int ethervox_llm_backend_generate(ethervox_llm_backend_t* backend,
                                  const char* language_code,
                                  ethervox_llm_response_t* response);
 
+// Streaming generation: callback is invoked per decoded token, before the
+// next decode step, so downstream consumers (e.g. TTS) can start early.
+// Returns ETHERVOX_ERROR_NOT_IMPLEMENTED if the backend has no streaming.
+int ethervox_llm_backend_generate_stream(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        void (*callback)(const char* token, void* user_data),
+                                        void* user_data);
+
+// Generation with per-conversation KV-cache reuse. Falls back to the plain
+// generate path when the backend has no context caching or conversation_id
+// is NULL, so callers can pass their dialogue context id unconditionally.
+int ethervox_llm_backend_generate_cached(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        const char* conversation_id,
+                                        ethervox_llm_response_t* response);
+
+// Batched generation across concurrent sessions. Requests are chunked to the
+// backend's advertised max_batch_size; backends without generate_batch fall
+// back to serial streaming per request. Each request's status field is filled
+// individually, and the return value is the first failure (or success).
+int ethervox_llm_backend_generate_batch(ethervox_llm_backend_t* backend,
+                                       ethervox_llm_batch_request_t* requests,
+                                       uint32_t request_count);
+
+// Fair batch scheduler: concurrently-arriving submissions are coalesced for a
+// short window, then dispatched as one generate_batch call. Within a batch at
+// most one request per conversation is admitted before remaining slots fill
+// FIFO, so a chatty session cannot starve the others. submit() blocks the
+// calling thread until its request completes and returns its status; without
+// pthreads the scheduler runs each submission inline.
+typedef struct ethervox_llm_batch_scheduler ethervox_llm_batch_scheduler_t;
+
+ethervox_llm_batch_scheduler_t* ethervox_llm_batch_scheduler_create(
+    ethervox_llm_backend_t* backend, uint32_t coalesce_window_ms);
+int ethervox_llm_batch_scheduler_submit(ethervox_llm_batch_scheduler_t* scheduler,
+                                        const ethervox_llm_batch_request_t* request);
+void ethervox_llm_batch_scheduler_destroy(ethervox_llm_batch_scheduler_t* scheduler);
+
+// Warm-standby failover pool: the fallback backend is created and initialized
+// once at startup and kept idle, so handing a request over costs one function
+// call instead of a cold backend init on the request that was already slow.
+// generate_stream races the primary against a first-token deadline (0 = the
+// 2000 ms default): if the local model has not produced its first token in
+// time, the request is handed to the standby and late primary tokens are
+// dropped. The blocking generate path fails over on error or when the primary
+// sets requires_external_llm on its response. Without pthreads there is no
+// race; the standby is tried after the primary fails.
+typedef struct ethervox_llm_failover_pool ethervox_llm_failover_pool_t;
+
+// standby is owned by the pool after creation (freed on destroy); it must
+// already be initialized and loaded. primary stays caller-owned.
+ethervox_llm_failover_pool_t* ethervox_llm_failover_pool_create(
+    ethervox_llm_backend_t* primary, ethervox_llm_backend_t* standby);
+
+int ethervox_llm_failover_pool_generate(ethervox_llm_failover_pool_t* pool,
+                                       const char* prompt,
+                                       const char* language_code,
+                                       ethervox_llm_response_t* response);
+
+int ethervox_llm_failover_pool_generate_stream(ethervox_llm_failover_pool_t* pool,
+                                              const char* prompt,
+                                              const char* language_code,
+                                              uint32_t first_token_deadline_ms,
+                                              void (*callback)(const char* token, void* user_data),
+                                              void* user_data);
+
+void ethervox_llm_failover_pool_destroy(ethervox_llm_failover_pool_t* pool);
+
+// Pre-tokenized prompt template: the fixed prompt segments (system prompt and
+// role separators) are tokenized once at create time, and history turns are
+// tokenized on first sight and cached, so assembling a turn's prompt costs
+// tokenizing only the new utterance plus memcpy splices of cached token runs.
+// Long histories otherwise re-tokenize in full on every single interaction.
+// Requires a backend with the tokenize hook.
+typedef struct ethervox_prompt_template ethervox_prompt_template_t;
+
+// Any of the segment strings may be NULL (treated as empty). The template
+// keeps its own copies; language or system-prompt changes mean recreating it.
+ethervox_prompt_template_t* ethervox_prompt_template_create(
+    ethervox_llm_backend_t* backend,
+    const char* system_prompt,
+    const char* user_prefix,
+    const char* assistant_prefix);
+
+// Assembles system prompt + (user_prefix + turn) per history entry +
+// user_prefix + utterance + assistant_prefix as one token run. The returned
+// buffer is owned by the template and valid until the next build or destroy,
+// so the steady state allocates nothing. Returns ETHERVOX_SUCCESS or an error.
+int ethervox_prompt_template_build(ethervox_prompt_template_t* tmpl,
+                                  const char* const* history_turns,
+                                  uint32_t history_count,
+                                  const char* utterance,
+                                  const int32_t** tokens_out,
+                                  uint32_t* token_count_out);
+
+void ethervox_prompt_template_destroy(ethervox_prompt_template_t* tmpl);
+
 // Utility functions
 const char* ethervox_llm_backend_type_to_string(ethervox_llm_backend_type_t type);
 bool ethervox_llm_backend_is_available(ethervox_llm_backend_type_t type);
 
+// Model residency pool: keeps several loaded backends alive under a RAM
+// budget so switching the active model (e.g. per language) is a hot swap
+// instead of a full unload/load cycle. Least recently used models are
+// evicted when the budget or the resident cap would be exceeded.
+typedef struct ethervox_llm_model_pool ethervox_llm_model_pool_t;
+
+typedef struct {
+  uint32_t ram_budget_mb;  // 0 = half of ethervox_platform_capabilities_t.ram_size_mb
+  uint32_t max_resident;   // Hard cap on simultaneously loaded models
+} ethervox_llm_model_pool_config_t;
+
+ethervox_llm_model_pool_config_t ethervox_llm_model_pool_get_default_config(void);
+
+// llm_config is the template used to initialize backends created by the pool
+ethervox_llm_model_pool_t* ethervox_llm_model_pool_create(
+    const ethervox_llm_model_pool_config_t* config, const ethervox_llm_config_t* llm_config);
+
+// Returns a loaded backend for model_path, loading it (and evicting LRU
+// residents to fit) on first use. The pool owns the backend; callers must
+// not free or unload it. Every successful acquire pins the entry against
+// eviction and must be paired with ethervox_llm_model_pool_release once the
+// caller is done generating. NULL on load failure, or when every resident
+// slot is pinned by an in-flight generation.
+ethervox_llm_backend_t* ethervox_llm_model_pool_acquire(ethervox_llm_model_pool_t* pool,
+                                                        ethervox_llm_backend_type_t type,
+                                                        const char* model_path);
+
+// Drops the pin taken by a successful acquire; the backend may be evicted
+// any time after this returns
+void ethervox_llm_model_pool_release(ethervox_llm_model_pool_t* pool,
+                                     const ethervox_llm_backend_t* backend);
+
+// Drop one model from residency (e.g. after a failed generation). Deferred
+// if the model is still pinned by an outstanding acquire.
+void ethervox_llm_model_pool_evict(ethervox_llm_model_pool_t* pool, const char* model_path);
+
+void ethervox_llm_model_pool_destroy(ethervox_llm_model_pool_t* pool);
+
 #ifdef __cplusplus
 }
 #endif
@@ -3,6 +3,7 @@
 #define ETHERVOX_LOGGING_H
 
 #include "ethervox/error.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <stdarg.h>
 
@@ -20,6 +21,17 @@ typedef enum {
     ETHERVOX_LOG_LEVEL_OFF = 6
 } ethervox_log_level_t;
 
+// Preprocessor-visible duplicates of the enum values (identical numbers) so
+// ETHERVOX_LOG_COMPILE_LEVEL comparisons work in #if; C treats the literals
+// as compatible with the enum everywhere else
+#define ETHERVOX_LOG_LEVEL_TRACE 0
+#define ETHERVOX_LOG_LEVEL_DEBUG 1
+#define ETHERVOX_LOG_LEVEL_INFO 2
+#define ETHERVOX_LOG_LEVEL_WARN 3
+#define ETHERVOX_LOG_LEVEL_ERROR 4
+#define ETHERVOX_LOG_LEVEL_FATAL 5
+#define ETHERVOX_LOG_LEVEL_OFF 6
+
 /**
  * @brief Set global log level
  * @param level Minimum log level to output
@@ -32,6 +44,13 @@ void ethervox_log_set_level(ethervox_log_level_t level);
  */
 ethervox_log_level_t ethervox_log_get_level(void);
 
+/**
+ * @brief Current runtime level, exposed for the macros' inline pre-check
+ *
+ * Read-only outside logging.c; change it via ethervox_log_set_level()
+ */
+extern ethervox_log_level_t ethervox_g_log_level;
+
 /**
  * @brief Log formatted message
  * @param level Log level
@@ -49,24 +68,88 @@ void ethervox_log(ethervox_log_level_t level, const char* file, int line,
  */
 void ethervox_log_error_context(const ethervox_error_context_t* ctx);
 
+/**
+ * @brief Switch ethervox_log() to async mode
+ *
+ * Producers format into a lock-free ring and a background thread does the
+ * I/O, so logging can never stall a real-time caller; records are dropped
+ * (and counted) when the ring is full. Idempotent.
+ * @return 0 on success, -1 without thread support
+ */
+int ethervox_log_async_start(void);
+
+/**
+ * @brief Drain remaining records and return to synchronous logging
+ */
+void ethervox_log_async_stop(void);
+
+/**
+ * @brief Total records dropped because the async ring was full
+ */
+uint32_t ethervox_log_async_dropped(void);
+
+/**
+ * @brief Minimum level compiled into the binary
+ *
+ * Macros below this level expand to nothing: no call, no argument
+ * evaluation, and the format strings never reach flash. Defaults keep
+ * everything on desktop and drop TRACE/DEBUG on embedded targets; override
+ * with -DETHERVOX_LOG_COMPILE_LEVEL=ETHERVOX_LOG_LEVEL_WARN etc.
+ */
+#ifndef ETHERVOX_LOG_COMPILE_LEVEL
+#if defined(ETHERVOX_PLATFORM_ESP32) || defined(TARGET_ESP32)
+#define ETHERVOX_LOG_COMPILE_LEVEL ETHERVOX_LOG_LEVEL_INFO
+#else
+#define ETHERVOX_LOG_COMPILE_LEVEL ETHERVOX_LOG_LEVEL_TRACE
+#endif
+#endif
+
+// Kept levels still pre-check the runtime level inline, so a filtered
+// message costs one predictable branch instead of a call with argument
+// evaluation behind it
+#define ETHERVOX_LOG_AT(level, ...) \
+    do { \
+        if ((level) >= ethervox_g_log_level) { \
+            ethervox_log((level), __FILE__, __LINE__, __func__, __VA_ARGS__); \
+        } \
+    } while (0)
+
 // Convenience macros
-#define ETHERVOX_LOG_TRACE(...) \
-    ethervox_log(ETHERVOX_LOG_LEVEL_TRACE, __FILE__, __LINE__, __func__, __VA_ARGS__)
-    
-#define ETHERVOX_LOG_DEBUG(...) \
-    ethervox_log(ETHERVOX_LOG_LEVEL_DEBUG, __FILE__, __LINE__, __func__, __VA_ARGS__)
-    
-#define ETHERVOX_LOG_INFO(...) \
-    ethervox_log(ETHERVOX_LOG_LEVEL_INFO, __FILE__, __LINE__, __func__, __VA_ARGS__)
-    
-#define ETHERVOX_LOG_WARN(...) \
-    ethervox_log(ETHERVOX_LOG_LEVEL_WARN, __FILE__, __LINE__, __func__, __VA_ARGS__)
-    
-#define ETHERVOX_LOG_ERROR(...) \
-    ethervox_log(ETHERVOX_LOG_LEVEL_ERROR, __FILE__, __LINE__, __func__, __VA_ARGS__)
-
-#define ETHERVOX_LOG_FATAL(...) \
-    ethervox_log(ETHERVOX_LOG_LEVEL_FATAL, __FILE__, __LINE__, __func__, __VA_ARGS__)
+#if ETHERVOX_LOG_COMPILE_LEVEL <= ETHERVOX_LOG_LEVEL_TRACE
+#define ETHERVOX_LOG_TRACE(...) ETHERVOX_LOG_AT(ETHERVOX_LOG_LEVEL_TRACE, __VA_ARGS__)
+#else
+#define ETHERVOX_LOG_TRACE(...) ((void)0)
+#endif
+
+#if ETHERVOX_LOG_COMPILE_LEVEL <= ETHERVOX_LOG_LEVEL_DEBUG
+#define ETHERVOX_LOG_DEBUG(...) ETHERVOX_LOG_AT(ETHERVOX_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define ETHERVOX_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if ETHERVOX_LOG_COMPILE_LEVEL <= ETHERVOX_LOG_LEVEL_INFO
+#define ETHERVOX_LOG_INFO(...) ETHERVOX_LOG_AT(ETHERVOX_LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define ETHERVOX_LOG_INFO(...) ((void)0)
+#endif
+
+#if ETHERVOX_LOG_COMPILE_LEVEL <= ETHERVOX_LOG_LEVEL_WARN
+#define ETHERVOX_LOG_WARN(...) ETHERVOX_LOG_AT(ETHERVOX_LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define ETHERVOX_LOG_WARN(...) ((void)0)
+#endif
+
+#if ETHERVOX_LOG_COMPILE_LEVEL <= ETHERVOX_LOG_LEVEL_ERROR
+#define ETHERVOX_LOG_ERROR(...) ETHERVOX_LOG_AT(ETHERVOX_LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define ETHERVOX_LOG_ERROR(...) ((void)0)
+#endif
+
+#if ETHERVOX_LOG_COMPILE_LEVEL <= ETHERVOX_LOG_LEVEL_FATAL
+#define ETHERVOX_LOG_FATAL(...) ETHERVOX_LOG_AT(ETHERVOX_LOG_LEVEL_FATAL, __VA_ARGS__)
+#else
+#define ETHERVOX_LOG_FATAL(...) ((void)0)
+#endif
 
 /**
  * @brief Macro to log and return error
@@ -47,8 +47,19 @@ typedef struct {
   const char* description;
   const char* url;
   const char* filename;
-  const char* sha256;  // Optional checksum
+  const char* sha256;  // Optional checksum (always of the uncompressed file)
   uint64_t size_bytes;
+  // Optional zstd-compressed artifact (.gguf.zst). When set and zstd is
+  // available, downloads fetch compressed_url and decompress in-stream while
+  // writing, so the file lands in models_dir already uncompressed with no
+  // temp copy or post-pass; otherwise url is fetched as before.
+  const char* compressed_url;
+  uint64_t compressed_size_bytes;  // Transfer size of compressed_url
+  // Optional chunk-hash manifest enabling delta updates (see
+  // ethervox_model_manager_update): a small text file listing the chunk size
+  // and one SHA256 per fixed-size chunk of the file behind url, so a refresh
+  // fetches only the chunks that actually changed.
+  const char* manifest_url;
   const char* format;  // "GGUF", "GGML", etc.
   const char* quantization;  // "Q4_K_M", "Q5_K_M", etc.
   bool recommended_for_embedded;
@@ -72,10 +83,22 @@ typedef struct ethervox_model_manager ethervox_model_manager_t;
 
 // Predefined model registry
 extern const ethervox_model_info_t ETHERVOX_MODEL_TINYLLAMA_1B_Q4;
+extern const ethervox_model_info_t ETHERVOX_MODEL_TINYLLAMA_1B_Q8;
 extern const ethervox_model_info_t ETHERVOX_MODEL_PHI2_Q4;
 extern const ethervox_model_info_t ETHERVOX_MODEL_MISTRAL_7B_Q4;
+extern const ethervox_model_info_t ETHERVOX_MODEL_MISTRAL_7B_Q5;
 extern const ethervox_model_info_t ETHERVOX_MODEL_LLAMA2_7B_Q4;
 
+// Model families group the registry's quantization/size variants of one base
+// model so a variant can be picked automatically per device
+typedef enum {
+  ETHERVOX_MODEL_FAMILY_TINYLLAMA = 0,
+  ETHERVOX_MODEL_FAMILY_PHI2,
+  ETHERVOX_MODEL_FAMILY_MISTRAL_7B,
+  ETHERVOX_MODEL_FAMILY_LLAMA2_7B,
+  ETHERVOX_MODEL_FAMILY_COUNT
+} ethervox_model_family_t;
+
 // Initialize model manager
 ethervox_model_manager_t* ethervox_model_manager_create(
     const ethervox_model_manager_config_t* config);
@@ -94,6 +117,27 @@ int ethervox_model_manager_download(
     ethervox_model_manager_t* manager,
     const ethervox_model_info_t* model_info);
 
+// Refresh an already-downloaded model as a binary delta. Fetches the model's
+// chunk-hash manifest (manifest_url), hashes the local file chunk by chunk,
+// and downloads only the changed chunks as ranged requests against url
+// (consecutive changed chunks coalesce into one range), reconstructing the
+// file in place. The result is verified against the manifest's whole-file
+// SHA256; on mismatch the file is quarantined like any corrupted download.
+// Falls back to a full re-download when the model is not present locally, has
+// no manifest, or SHA256/libcurl support is unavailable.
+//
+// Manifest format (text):
+//   ethervox-chunks 1
+//   chunk-size <bytes>
+//   file-size <bytes>
+//   sha256 <hex of the whole new file>
+//   <hex of chunk 0>
+//   <hex of chunk 1>
+//   ...
+int ethervox_model_manager_update(
+    ethervox_model_manager_t* manager,
+    const ethervox_model_info_t* model_info);
+
 int ethervox_model_manager_get_path(
     ethervox_model_manager_t* manager,
     const ethervox_model_info_t* model_info,
@@ -108,6 +152,30 @@ int ethervox_model_manager_ensure_available(
     ethervox_model_manager_t* manager,
     const ethervox_model_info_t* model_info);
 
+// Automatic variant selection: returns the highest-quality variant of family
+// whose min_ram_mb fits within ram_mb minus headroom_mb (0 = default 512 MB,
+// reserved for the rest of the pipeline), or NULL when even the smallest
+// variant would swap. A swapping model turns per-token latencies from
+// milliseconds into seconds, so no model beats a too-big model.
+const ethervox_model_info_t* ethervox_model_manager_select_variant(
+    ethervox_model_family_t family,
+    uint32_t ram_mb,
+    uint32_t headroom_mb);
+
+// Same selection against the running device's detected RAM size
+const ethervox_model_info_t* ethervox_model_manager_select_for_platform(
+    ethervox_model_family_t family,
+    uint32_t headroom_mb);
+
+// ensure_available for a family: selects the best-fitting variant for this
+// device and downloads it if missing. The chosen entry is returned through
+// selected (optional) so the caller can load it.
+int ethervox_model_manager_ensure_family_available(
+    ethervox_model_manager_t* manager,
+    ethervox_model_family_t family,
+    uint32_t headroom_mb,
+    const ethervox_model_info_t** selected);
+
 // Model discovery
 int ethervox_model_manager_list_available(
     ethervox_model_manager_t* manager,
@@ -46,6 +46,7 @@ typedef struct {
   uint32_t gpio_pin_count;
   uint32_t ram_size_mb;
   uint32_t flash_size_mb;
+  uint32_t cpu_core_count;  // 0 when the probe cannot tell
 } ethervox_platform_capabilities_t;
 
 // GPIO configuration
@@ -119,6 +120,17 @@ typedef struct {
 
 } ethervox_platform_hal_t;
 
+// Volatile hardware telemetry. The HAL getters behind these values read
+// sysfs/procfs and can block for tens of milliseconds on SD-card storage;
+// the snapshot is refreshed off the hot path so metrics loops read plain
+// struct fields instead of doing file I/O per sample.
+typedef struct {
+  float cpu_temperature_c;
+  uint32_t free_heap_kb;
+  uint32_t cpu_frequency_mhz;
+  uint64_t sampled_at_us;  // 0 until the first sample lands
+} ethervox_platform_telemetry_t;
+
 // Main platform structure
 typedef struct {
   ethervox_platform_info_t info;
@@ -127,6 +139,12 @@ typedef struct {
   uint64_t boot_time;
   uint32_t error_count;
   char last_error[ETHERVOX_PLATFORM_ERROR_LEN];
+
+  // Telemetry cache (see ethervox_platform_start_telemetry)
+  ethervox_platform_telemetry_t telemetry;
+  uint32_t telemetry_period_ms;
+  volatile bool telemetry_running;
+  void* telemetry_thread;  // pthread_t storage, opaque to keep this header portable
 } ethervox_platform_t;
 
 // Public API functions
@@ -144,6 +162,16 @@ int ethervox_gpio_configure_pin(ethervox_platform_t* platform,
 int ethervox_gpio_write_pin(ethervox_platform_t* platform, uint32_t pin, bool state);
 bool ethervox_gpio_read_pin(ethervox_platform_t* platform, uint32_t pin);
 
+// Telemetry cache. ethervox_platform_init() takes one synchronous sample so
+// the snapshot is never empty; start_telemetry() spawns a refresher that
+// re-samples the volatile values every period_ms (0 picks the default).
+// get_telemetry() is a plain struct read — safe to call at any rate. Without
+// pthreads start_telemetry() fails and each get_telemetry() falls back to
+// sampling inline when the snapshot is older than the period.
+int ethervox_platform_start_telemetry(ethervox_platform_t* platform, uint32_t period_ms);
+int ethervox_platform_stop_telemetry(ethervox_platform_t* platform);
+ethervox_platform_telemetry_t ethervox_platform_get_telemetry(ethervox_platform_t* platform);
+
 // System utilities
 uint64_t ethervox_platform_get_uptime_ms(ethervox_platform_t* platform);
 uint32_t ethervox_platform_get_memory_usage(ethervox_platform_t* platform);
@@ -92,6 +92,7 @@ typedef struct ethervox_plugin {
   char description[256];
   ethervox_plugin_type_t type;
   ethervox_plugin_status_t status;
+  int priority;  // Higher dispatches first within a type (default 0)
   void* handle;  // Dynamic library handle
   int (*execute)(const void* input, void* output);
   void* user_data;
@@ -100,6 +101,13 @@ typedef struct ethervox_plugin {
   time_t load_time;
   time_t last_used;
   uint32_t usage_count;
+
+  // RCU-style hot reload state: each dispatch counts itself into the
+  // inflight bucket for the current epoch; reload swaps the dispatch
+  // pointers, flips the epoch, and waits for the old bucket to drain before
+  // closing the old library handle (see ethervox_plugin_reload)
+  volatile uint32_t reload_epoch;
+  volatile uint32_t inflight[2];
 } ethervox_plugin_t;
 
 // External LLM plugin specifics
@@ -123,6 +131,16 @@ typedef struct ethervox_plugin_manager {
   uint32_t max_plugins;
   bool is_initialized;
   uint32_t loaded_plugins;
+
+  // Per-type dispatch index, rebuilt whenever the plugin set changes: slot
+  // numbers sorted by descending priority per type, plus an open-addressed
+  // name hash (slot + 1; 0 = empty) so lookups never scan the full array
+  uint8_t dispatch_lists[ETHERVOX_PLUGIN_COUNT][ETHERVOX_MAX_PLUGINS];
+  uint8_t dispatch_counts[ETHERVOX_PLUGIN_COUNT];
+  uint8_t name_index[ETHERVOX_MAX_PLUGINS * 2];
+
+  // Async worker pool for off-hot-path plugin execution (internal)
+  void* executor;
 } ethervox_plugin_manager_t;
 
 // Public API functions
@@ -147,6 +165,58 @@ int ethervox_plugin_list_loaded(ethervox_plugin_manager_t* manager, char*** plug
 int ethervox_plugin_execute(ethervox_plugin_t* plugin, const void* input, void* output);
 int ethervox_plugin_configure(ethervox_plugin_t* plugin, const char* config_json);
 
+// Outcome reported to an async execution callback
+typedef enum {
+  ETHERVOX_PLUGIN_EXEC_OK = 0,
+  ETHERVOX_PLUGIN_EXEC_FAILED,     // Plugin ran and returned an error
+  ETHERVOX_PLUGIN_EXEC_TIMEOUT,    // timeout_ms elapsed before completion
+  ETHERVOX_PLUGIN_EXEC_CANCELLED   // Cancelled before a result was delivered
+} ethervox_plugin_exec_status_t;
+
+// Completion callback for asynchronous plugin execution. Runs on an executor
+// thread; result is the plugin's return value (only meaningful for OK/FAILED).
+typedef void (*ethervox_plugin_exec_callback_t)(ethervox_plugin_t* plugin,
+                                                ethervox_plugin_exec_status_t status, int result,
+                                                void* output, void* user_data);
+
+// Start the manager's async executor. Execution runs on the process-wide
+// shared scheduler (see ethervox/scheduler.h), so worker_count is ignored
+// and kept only for source compatibility. Safe to call more than once;
+// later calls are no-ops while the executor runs.
+int ethervox_plugin_executor_start(ethervox_plugin_manager_t* manager, uint32_t worker_count);
+void ethervox_plugin_executor_stop(ethervox_plugin_manager_t* manager);
+
+// Queue a plugin execution on the worker pool and return a job id (> 0), or
+// -1 when the queue is full. The pool is started on first use if needed.
+// timeout_ms > 0 enforces a deadline: the callback fires with
+// ETHERVOX_PLUGIN_EXEC_TIMEOUT and the result is discarded when the plugin
+// eventually returns. A timed-out or cancelled plugin call keeps running in
+// the background and may still write to output, so the output buffer must
+// stay valid until the executor is stopped.
+// Platforms without pthreads fall back to synchronous execution: the callback
+// fires before this returns and timeouts are not enforced.
+int64_t ethervox_plugin_execute_async(ethervox_plugin_manager_t* manager,
+                                      ethervox_plugin_t* plugin, const void* input, void* output,
+                                      uint32_t timeout_ms,
+                                      ethervox_plugin_exec_callback_t callback, void* user_data);
+
+// Cancel a queued or running job; its callback fires with CANCELLED. Returns
+// -1 when the job already completed (or was never queued).
+int ethervox_plugin_cancel(ethervox_plugin_manager_t* manager, int64_t job_id);
+
+// Priority-ordered per-type dispatch (highest priority first). Walking a
+// type's plugins is an O(1) indexed access per step, not an array scan.
+uint32_t ethervox_plugin_count_of_type(const ethervox_plugin_manager_t* manager,
+                                       ethervox_plugin_type_t type);
+ethervox_plugin_t* ethervox_plugin_of_type_at(ethervox_plugin_manager_t* manager,
+                                              ethervox_plugin_type_t type, uint32_t index);
+ethervox_plugin_t* ethervox_plugin_first_of_type(ethervox_plugin_manager_t* manager,
+                                                 ethervox_plugin_type_t type);
+
+// Change a plugin's dispatch priority and re-sort its type list
+int ethervox_plugin_set_priority(ethervox_plugin_manager_t* manager, const char* plugin_name,
+                                 int priority);
+
 // External LLM integrations
 int ethervox_llm_plugin_openai(const ethervox_llm_request_t* request,
                                ethervox_llm_response_t* response, void* user_data);
@@ -0,0 +1,95 @@
+/**
+ * @file scheduler.h
+ * @brief Shared work-stealing task scheduler for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_SCHEDULER_H
+#define ETHERVOX_SCHEDULER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Process-wide worker pool shared by all subsystems
+ *
+ * Several subsystems want background workers (async plugin execution, model
+ * refreshes, housekeeping). Giving each its own pool oversubscribes the four
+ * cores of a Pi the moment two of them are busy at once, so they all submit
+ * to this single scheduler instead: one pool sized from the platform's core
+ * count, with per-worker work-stealing deques so a briefly idle worker takes
+ * load from a busy one instead of sleeping.
+ *
+ * Priority classes order dequeue, not preemption: a realtime task jumps
+ * every queue but a background task already running is not interrupted, so
+ * long background work (downloads, file scans) should be submitted as
+ * chunked tasks rather than one multi-second call. Long-running service
+ * loops (audio capture, the STT streaming worker, log draining) are NOT
+ * tasks and must keep their dedicated threads; parking a permanent loop in
+ * the pool would pin a worker forever.
+ */
+typedef struct ethervox_scheduler ethervox_scheduler_t;
+
+// Dequeue order: REALTIME drains before INTERACTIVE drains before BACKGROUND
+typedef enum {
+  ETHERVOX_SCHED_PRIORITY_REALTIME = 0,  // Audio-adjacent work (VAD, wake word follow-up)
+  ETHERVOX_SCHED_PRIORITY_INTERACTIVE,   // User-visible work (plugin calls, STT post-passes)
+  ETHERVOX_SCHED_PRIORITY_BACKGROUND,    // Downloads, cache maintenance, telemetry
+  ETHERVOX_SCHED_PRIORITY_COUNT
+} ethervox_sched_priority_t;
+
+typedef void (*ethervox_sched_task_fn_t)(void* arg);
+
+/**
+ * @brief Get the shared scheduler, creating it on first use
+ *
+ * Refcounted: every acquire must be paired with a release, and the pool is
+ * torn down when the last holder releases it. Worker count is derived from
+ * ethervox_platform_get_capabilities() (cores minus one, leaving headroom
+ * for the realtime audio path). Returns NULL on allocation or thread
+ * creation failure. On single-threaded toolchains a stub is returned whose
+ * submit runs tasks inline.
+ */
+ethervox_scheduler_t* ethervox_scheduler_acquire(void);
+
+void ethervox_scheduler_release(ethervox_scheduler_t* scheduler);
+
+/**
+ * @brief Queue a task for execution on the shared pool
+ *
+ * Safe from any thread. A task submitted from inside another task lands on
+ * the submitting worker's own deque (cheap, no lock); external submissions
+ * go through a per-priority injection queue. Returns 0 on success, -1 when
+ * the queues are full (callers may retry or run the work inline).
+ */
+int ethervox_scheduler_submit(ethervox_scheduler_t* scheduler,
+                              ethervox_sched_priority_t priority,
+                              ethervox_sched_task_fn_t fn, void* arg);
+
+/**
+ * @brief Block until every queued and running task has finished
+ *
+ * Must not be called from inside a task. Tasks submitted while draining
+ * extend the wait.
+ */
+void ethervox_scheduler_drain(ethervox_scheduler_t* scheduler);
+
+uint32_t ethervox_scheduler_worker_count(const ethervox_scheduler_t* scheduler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_SCHEDULER_H
@@ -48,6 +48,9 @@ typedef struct ethervox_stt_result {
   float confidence;        // Overall confidence (0.0 - 1.0)
   bool is_partial;         // Partial result (not final)
   bool is_final;           // Final result
+  bool text_is_view;       // text borrows a backend-owned transcript buffer
+                           // (valid until the next process/finalize/start
+                           // call); ethervox_stt_result_free() won't free it
   uint64_t start_time_us;  // Start timestamp
   uint64_t end_time_us;    // End timestamp
   const char* language;    // Detected language
@@ -62,10 +65,13 @@ typedef struct {
   bool is_initialized;
   bool is_processing;
 
-  // Audio buffering for streaming
+  // Audio buffering for streaming: power-of-two circular buffer with
+  // monotonic cursors (index = pos & (accumulator_size - 1)); the capture
+  // side only ever advances write, backends only advance read
   float* audio_accumulator;
-  uint32_t accumulator_size;
-  uint32_t accumulator_write_pos;
+  uint32_t accumulator_size;       // Always a power of two
+  uint32_t accumulator_write_pos;  // Monotonic producer cursor
+  uint32_t accumulator_read_pos;   // Monotonic consumer cursor
 
   // Platform-specific
   void* platform_data;
@@ -99,6 +105,12 @@ int ethervox_stt_start(ethervox_stt_runtime_t* runtime);
  * @param runtime STT runtime
  * @param audio_buffer Audio buffer from ethervox_audio_read()
  * @param result Recognition result (output, can be partial)
+ *
+ * Partial results are zero-copy: text_is_view is set and text points into a
+ * backend-owned transcript buffer that stays valid until the next process,
+ * finalize or start call. Callers that need partial text longer must copy it;
+ * final results from ethervox_stt_finalize() are always owned copies.
+ *
  * @return 0 on success, -1 on error, 1 if no result yet
  */
 int ethervox_stt_process(ethervox_stt_runtime_t* runtime,
@@ -120,7 +132,7 @@ int ethervox_stt_finalize(ethervox_stt_runtime_t* runtime, ethervox_stt_result_t
 void ethervox_stt_stop(ethervox_stt_runtime_t* runtime);
 
 /**
- * Free STT result
+ * Free STT result (no-op for the text of view results, see text_is_view)
  */
 void ethervox_stt_result_free(ethervox_stt_result_t* result);
 
@@ -129,6 +141,27 @@ void ethervox_stt_result_free(ethervox_stt_result_t* result);
  */
 void ethervox_stt_cleanup(ethervox_stt_runtime_t* runtime);
 
+/*
+ * Accumulator access for backends: peek returns the longest contiguous
+ * unconsumed chunk (no copy, no shift); consume advances the read cursor
+ * after the backend has processed it.
+ */
+uint32_t ethervox_stt_accumulator_available(const ethervox_stt_runtime_t* runtime);
+uint32_t ethervox_stt_accumulator_peek(ethervox_stt_runtime_t* runtime, const float** chunk);
+void ethervox_stt_accumulator_consume(ethervox_stt_runtime_t* runtime, uint32_t sample_count);
+
+/*
+ * Whisper backend hooks (implemented in whisper_backend.c). stt_core routes
+ * ETHERVOX_STT_BACKEND_WHISPER through these; apps use the generic API above.
+ */
+int ethervox_stt_whisper_init(ethervox_stt_runtime_t* runtime);
+void ethervox_stt_whisper_start(ethervox_stt_runtime_t* runtime);
+int ethervox_stt_whisper_feed(ethervox_stt_runtime_t* runtime, const int16_t* samples,
+                              uint32_t sample_count);
+int ethervox_stt_whisper_poll(ethervox_stt_runtime_t* runtime, ethervox_stt_result_t* result);
+int ethervox_stt_whisper_finalize(ethervox_stt_runtime_t* runtime, ethervox_stt_result_t* result);
+void ethervox_stt_whisper_cleanup(ethervox_stt_runtime_t* runtime);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: CC-BY-NC-SA-4.0
+#ifndef ETHERVOX_TRACE_H
+#define ETHERVOX_TRACE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Pipeline stages a turn passes through, in order
+ */
+typedef enum {
+    ETHERVOX_TRACE_STAGE_CAPTURE = 0,
+    ETHERVOX_TRACE_STAGE_WAKE,
+    ETHERVOX_TRACE_STAGE_STT,
+    ETHERVOX_TRACE_STAGE_INTENT,
+    ETHERVOX_TRACE_STAGE_LLM,
+    ETHERVOX_TRACE_STAGE_TTS,
+    ETHERVOX_TRACE_STAGE_COUNT
+} ethervox_trace_stage_t;
+
+/**
+ * @brief One stage span within a turn
+ *
+ * trace_id links every span of a turn back to the capture buffer that
+ * started it; origin_us is that buffer's timestamp, so end_us - origin_us is
+ * the end-to-end latency up to this stage.
+ */
+typedef struct {
+    uint64_t trace_id;
+    ethervox_trace_stage_t stage;
+    uint64_t origin_us;
+    uint64_t start_us;
+    uint64_t end_us;
+} ethervox_trace_span_t;
+
+/**
+ * @brief Sink invoked for every emitted span (e.g. SDK diagnostics)
+ *
+ * Called on the thread that ran the stage; keep it cheap.
+ */
+typedef void (*ethervox_trace_sink_t)(const ethervox_trace_span_t* span, void* user_data);
+
+/**
+ * @brief Start a turn: allocate a fresh trace id
+ * @param origin_timestamp_us Capture buffer timestamp the turn began with
+ * @return Non-zero trace id
+ */
+uint64_t ethervox_trace_begin(uint64_t origin_timestamp_us);
+
+/**
+ * @brief Emit a span for one stage of a turn
+ *
+ * A trace_id of 0 (untraced call) is silently ignored, so instrumented code
+ * costs nothing when tracing isn't wired up.
+ */
+void ethervox_trace_span(uint64_t trace_id, ethervox_trace_stage_t stage, uint64_t start_us,
+                         uint64_t end_us);
+
+/**
+ * @brief Install the span sink (NULL disables emission)
+ */
+void ethervox_trace_set_sink(ethervox_trace_sink_t sink, void* user_data);
+
+/**
+ * @brief Monotonic microsecond clock used for span timestamps
+ */
+uint64_t ethervox_trace_now_us(void);
+
+/**
+ * @brief Stage name for reports ("capture", "stt", ...)
+ */
+const char* ethervox_trace_stage_to_string(ethervox_trace_stage_t stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ETHERVOX_TRACE_H
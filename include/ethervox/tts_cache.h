@@ -0,0 +1,110 @@
+/**
+ * @file tts_cache.h
+ * @brief LRU cache of synthesized TTS audio for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_TTS_CACHE_H
+#define ETHERVOX_TTS_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ethervox/audio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One cached utterance: key is the canonical form of the request fields that
+// affect the output (text, voice, language, rate, pitch)
+typedef struct ethervox_tts_cache_entry {
+  char* key;
+  uint64_t hash;
+  float* samples;
+  uint32_t sample_count;
+  size_t bytes;  // Entry footprint charged against the budget
+  struct ethervox_tts_cache_entry* lru_prev;  // Towards most recent
+  struct ethervox_tts_cache_entry* lru_next;  // Towards least recent
+} ethervox_tts_cache_entry_t;
+
+// LRU cache with a hard memory budget. Assistants speak a small phrase set
+// thousands of times a day; a hit skips synthesis entirely. Optionally
+// persists entries as PCM files so the cache survives restarts.
+typedef struct {
+  ethervox_tts_cache_entry_t** buckets;  // Open-addressed by hash
+  uint32_t bucket_count;                 // Power of two
+  ethervox_tts_cache_entry_t* lru_head;  // Most recently used
+  ethervox_tts_cache_entry_t* lru_tail;  // Eviction candidate
+  uint32_t entry_count;
+  size_t budget_bytes;
+  size_t used_bytes;
+  char persist_dir[512];  // Empty = memory only
+  uint64_t hits;
+  uint64_t misses;
+  bool is_initialized;
+} ethervox_tts_cache_t;
+
+/**
+ * Initialize a cache with the given memory budget
+ *
+ * @param persist_dir Directory for on-disk copies of cached phrases
+ *                    (typically the model manager's cache_dir); NULL keeps
+ *                    the cache memory-only
+ * @return 0 on success, -1 on error
+ */
+int ethervox_tts_cache_init(ethervox_tts_cache_t* cache, size_t budget_bytes,
+                            const char* persist_dir);
+
+/**
+ * Look up synthesized audio for a request
+ *
+ * On a hit, fills output with a heap copy of the cached PCM (free with
+ * ethervox_audio_buffer_free). Misses fall through to disk when persistence
+ * is enabled and promote the entry into memory.
+ *
+ * @return 0 on hit, 1 on miss, -1 on error
+ */
+int ethervox_tts_cache_lookup(ethervox_tts_cache_t* cache, const ethervox_tts_request_t* request,
+                              ethervox_audio_buffer_t* output);
+
+/**
+ * Store synthesized audio for a request, evicting least-recently-used
+ * entries until the budget holds. Utterances larger than the whole budget
+ * are not cached.
+ *
+ * @return 0 on success, -1 on error
+ */
+int ethervox_tts_cache_store(ethervox_tts_cache_t* cache, const ethervox_tts_request_t* request,
+                             const ethervox_audio_buffer_t* pcm);
+
+/**
+ * Convenience wrapper: serve from cache, or synthesize and cache the result
+ *
+ * @return 0 on success, -1 on error
+ */
+int ethervox_tts_synthesize_cached(ethervox_audio_runtime_t* runtime,
+                                   ethervox_tts_cache_t* cache,
+                                   const ethervox_tts_request_t* request,
+                                   ethervox_audio_buffer_t* output);
+
+/**
+ * Release all entries (on-disk copies are kept)
+ */
+void ethervox_tts_cache_cleanup(ethervox_tts_cache_t* cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_TTS_CACHE_H
@@ -0,0 +1,84 @@
+/**
+ * @file vad.h
+ * @brief Voice activity detection for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#ifndef ETHERVOX_VAD_H
+#define ETHERVOX_VAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ethervox/audio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// VAD configuration
+typedef struct {
+  uint32_t sample_rate;
+  uint32_t frame_size;        // Samples per analysis frame (power of two)
+  float energy_threshold;     // Normalized RMS threshold (0.0 - 1.0 full scale)
+  float flatness_threshold;   // Spectral flatness below this counts as voiced
+  uint32_t hangover_frames;   // Frames to keep reporting voice after last hit
+} ethervox_vad_config_t;
+
+// VAD runtime state
+typedef struct {
+  ethervox_vad_config_t config;
+  float noise_floor;          // Adaptive noise floor (normalized RMS)
+  uint32_t hangover_counter;
+  bool is_initialized;
+} ethervox_vad_runtime_t;
+
+/**
+ * Get default VAD configuration
+ */
+ethervox_vad_config_t ethervox_vad_get_default_config(void);
+
+/**
+ * Initialize VAD state
+ *
+ * @param runtime VAD runtime structure
+ * @param config Configuration (NULL for defaults)
+ * @return 0 on success, -1 on error
+ */
+int ethervox_vad_init(ethervox_vad_runtime_t* runtime, const ethervox_vad_config_t* config);
+
+/**
+ * Classify a captured buffer as voice or silence
+ *
+ * @param runtime VAD runtime
+ * @param audio_buffer Audio buffer from ethervox_audio_read()
+ * @param is_voice Set to true if voice activity was detected (output)
+ * @return 0 on success, -1 on error
+ */
+int ethervox_vad_process(ethervox_vad_runtime_t* runtime,
+                         const ethervox_audio_buffer_t* audio_buffer, bool* is_voice);
+
+/**
+ * Reset adaptive state (noise floor, hangover)
+ */
+void ethervox_vad_reset(ethervox_vad_runtime_t* runtime);
+
+/**
+ * Cleanup VAD state
+ */
+void ethervox_vad_cleanup(ethervox_vad_runtime_t* runtime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ETHERVOX_VAD_H
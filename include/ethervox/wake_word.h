@@ -32,31 +32,40 @@ typedef enum {
  */
 typedef struct {
   ethervox_wake_method_t method;
-  const char* wake_word;      // e.g., "hey ethervox"
+  const char* wake_word;      // e.g., "hey ethervox" (used when wake_words is NULL)
   float sensitivity;          // 0.0 - 1.0 (higher = more sensitive)
   uint32_t sample_rate;       // Audio sample rate (16000 Hz recommended)
   uint32_t frame_length;      // Samples per frame (512 recommended)
   const char* model_path;     // Path to wake word model (if using NN)
   bool continuous_listening;  // Keep listening after wake word
   uint32_t timeout_ms;        // Timeout after wake word detected
+
+  // Optional multi-keyword mode: listen for several keywords (e.g. per-room
+  // custom names) in one runtime. The acoustic front-end runs once per buffer
+  // and every keyword shares it, so N keywords cost one feature pass plus N
+  // cheap matchers instead of N full runtimes. Overrides wake_word when set.
+  const char* const* wake_words;   // Keyword strings (borrowed, not copied)
+  const char* const* model_paths;  // Optional per-keyword templates, parallel
+                                   // to wake_words (NULL entries allowed)
+  uint32_t wake_word_count;        // Entries in wake_words
 } ethervox_wake_config_t;
 
 /**
  * Wake word detection result
  */
-typedef struct {
+typedef struct ethervox_wake_result {
   bool detected;          // Wake word detected
   float confidence;       // Detection confidence (0.0 - 1.0)
   uint64_t timestamp_us;  // Detection timestamp (microseconds)
   uint32_t start_index;   // Audio buffer start index
   uint32_t end_index;     // Audio buffer end index
-  const char* wake_word;  // Detected wake word
+  const char* wake_word;  // Which configured keyword fired (borrowed)
 } ethervox_wake_result_t;
 
 /**
  * Wake word detection runtime
  */
-typedef struct {
+typedef struct ethervox_wake_runtime {
   ethervox_wake_config_t config;
   void* detector_context;  // Internal detector state
   bool is_initialized;
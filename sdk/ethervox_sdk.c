@@ -15,12 +15,90 @@
  */
 #include "ethervox_sdk.h"
 
+#include <ctype.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
+#include "ethervox/platform.h"
+#include "ethervox/trace.h"
+
+#if defined(__has_include)
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#define ETHERVOX_SDK_HAVE_UNISTD 1
+#endif
+#endif
+#ifndef ETHERVOX_SDK_HAVE_UNISTD
+#define ETHERVOX_SDK_HAVE_UNISTD 0
+#endif
+
+// Hedged requests need a second thread; without pthreads routing stays
+// sequential and hedging is silently unavailable
+#if defined(__has_include)
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define ETHERVOX_SDK_HEDGING_AVAILABLE 1
+#endif
+#endif
+#ifndef ETHERVOX_SDK_HEDGING_AVAILABLE
+#define ETHERVOX_SDK_HEDGING_AVAILABLE 0
+#endif
+
+// The background metrics sampler needs a thread of its own as well; without
+// one, ethervox_sdk_get_system_metrics samples inline at the same rate limit
+#if defined(__has_include)
+#if __has_include(<pthread.h>)
+#define ETHERVOX_SDK_METRICS_THREAD_AVAILABLE 1
+#endif
+#endif
+#ifndef ETHERVOX_SDK_METRICS_THREAD_AVAILABLE
+#define ETHERVOX_SDK_METRICS_THREAD_AVAILABLE 0
+#endif
+
+// OS metric sources (/proc, sysfs, statvfs) are Linux-shaped; elsewhere the
+// sampler publishes zeros for the OS-sourced fields
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/statvfs.h>
+#define ETHERVOX_SDK_METRICS_PROCFS 1
+#else
+#define ETHERVOX_SDK_METRICS_PROCFS 0
+#endif
+
+// Relaxed atomic helpers for the lock-free latency histograms; plain
+// operations on compilers without the __atomic builtins
+#if defined(__GNUC__) || defined(__clang__)
+#define sdk_atomic_add_u64(ptr, val) (void)__atomic_add_fetch((ptr), (val), __ATOMIC_RELAXED)
+#define sdk_atomic_load_u64(ptr) __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#else
+#define sdk_atomic_add_u64(ptr, val) (void)(*(ptr) += (val))
+#define sdk_atomic_load_u64(ptr) (*(ptr))
+#endif
+
+// Seqlock primitives for the metrics publish path: the writer brackets its
+// field writes between enter (odd) and exit (even) increments, readers retry
+// the copy until they see the same even value on both sides. The two bumps
+// need fences on opposite sides: enter must be visible before the field
+// writes start, exit must not become visible until they have finished. Plain
+// operations on compilers without the __atomic builtins, where the sampler
+// thread doesn't exist anyway.
+#if defined(__GNUC__) || defined(__clang__)
+#define sdk_seq_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define sdk_seq_write_enter(ptr) \
+  do { \
+    __atomic_store_n((ptr), *(ptr) + 1u, __ATOMIC_RELAXED); \
+    __atomic_thread_fence(__ATOMIC_SEQ_CST); \
+  } while (0)
+#define sdk_seq_write_exit(ptr) __atomic_store_n((ptr), *(ptr) + 1u, __ATOMIC_RELEASE)
+#else
+#define sdk_seq_load(ptr) (*(ptr))
+#define sdk_seq_write_enter(ptr) (void)(++*(ptr))
+#define sdk_seq_write_exit(ptr) (void)(++*(ptr))
+#endif
+
 // Global SDK instance for single-instance usage
 static ethervox_sdk_t* g_sdk_instance = NULL;
 
@@ -40,6 +118,34 @@ bool ethervox_sdk_is_compatible(uint32_t major, uint32_t minor) {
   return (major == ETHERVOX_SDK_VERSION_MAJOR) && (minor <= ETHERVOX_SDK_VERSION_MINOR);
 }
 
+// Intent result cache: telemetry shows the same few dozen commands make up
+// most traffic, so parsed results are kept keyed by (normalized text,
+// language) and a repeat skips the whole plugin chain. Capacity is small and
+// fixed; a linear scan with a hash pre-compare costs microseconds, which is
+// the point - no table bookkeeping needed.
+#define INTENT_CACHE_CAPACITY 64
+#define INTENT_CACHE_KEY_BYTES 1048  // Normalized text plus language tag
+
+static const uint32_t kIntentCacheDefaultTtlMs = 5u * 60u * 1000u;
+
+static uint64_t router_monotonic_ms(void);  // Defined with the model router below
+
+typedef struct {
+  char key[INTENT_CACHE_KEY_BYTES];
+  uint64_t hash;
+  ethervox_intent_result_t result;
+  char plugin_name[64];     // Producer, for targeted invalidation
+  uint64_t expires_at_ms;   // Monotonic deadline; 0 marks the slot free
+  uint64_t last_used_seq;   // LRU victim selection
+} intent_cache_entry_t;
+
+struct ethervox_intent_cache_t {
+  intent_cache_entry_t entries[INTENT_CACHE_CAPACITY];
+  uint64_t use_seq;
+  uint64_t hits;
+  uint64_t misses;
+};
+
 // Initialize SDK
 int ethervox_sdk_init(ethervox_sdk_t* sdk) {
   if (!sdk)
@@ -78,6 +184,15 @@ int ethervox_sdk_init(ethervox_sdk_t* sdk) {
   sdk->device_profile->bit_depth = 16;
   sdk->device_profile->mic_array_channels = 1;
 
+  // Intent result cache (all slots start free)
+  sdk->intent_cache = (ethervox_intent_cache_t*)calloc(1, sizeof(ethervox_intent_cache_t));
+  if (!sdk->intent_cache) {
+    free(sdk->device_profile);
+    free(sdk->diagnostics);
+    snprintf(sdk->last_error, sizeof(sdk->last_error), "%s", "Failed to allocate intent cache");
+    return -1;
+  }
+
   sdk->initialization_time = time(NULL);
   sdk->is_initialized = true;
 
@@ -94,6 +209,9 @@ void ethervox_sdk_cleanup(ethervox_sdk_t* sdk) {
   if (!sdk || !sdk->is_initialized)
     return;
 
+  // Stop the metrics sampler before its diagnostics target goes away
+  ethervox_sdk_stop_metrics_sampler(sdk);
+
   // Cleanup intent plugins
   for (uint32_t i = 0; i < sdk->intent_plugin_count; i++) {
     if (sdk->intent_plugins[i] && sdk->intent_plugins[i]->cleanup) {
@@ -113,6 +231,12 @@ void ethervox_sdk_cleanup(ethervox_sdk_t* sdk) {
     sdk->device_profile = NULL;
   }
 
+  // Cleanup intent cache
+  if (sdk->intent_cache) {
+    free(sdk->intent_cache);
+    sdk->intent_cache = NULL;
+  }
+
   // Cleanup model router
   if (sdk->model_router) {
     free(sdk->model_router);
@@ -128,6 +252,122 @@ void ethervox_sdk_cleanup(ethervox_sdk_t* sdk) {
   printf("EtherVox SDK cleaned up\n");
 }
 
+// Canonical key: lowercased text with whitespace runs collapsed, edges
+// trimmed and trailing punctuation dropped, so "Turn on the lights!" and
+// "turn on the lights " share an entry. Returns -1 when the normalized text
+// is empty or does not fit (such inputs are simply not cached).
+static int intent_cache_build_key(const ethervox_stt_input_t* input, char* key, size_t key_size) {
+  size_t out = 0;
+  bool pending_space = false;
+
+  for (const char* p = input->text; *p; p++) {
+    const unsigned char c = (unsigned char)*p;
+    if (isspace(c)) {
+      pending_space = out > 0;
+      continue;
+    }
+    if (pending_space) {
+      if (out + 1 >= key_size) {
+        return -1;
+      }
+      key[out++] = ' ';
+      pending_space = false;
+    }
+    if (out + 1 >= key_size) {
+      return -1;
+    }
+    key[out++] = (char)tolower(c);
+  }
+
+  while (out > 0 &&
+         (key[out - 1] == '.' || key[out - 1] == '!' || key[out - 1] == '?' ||
+          key[out - 1] == ',')) {
+    out--;
+  }
+  if (out == 0) {
+    return -1;
+  }
+
+  const int written =
+      snprintf(key + out, key_size - out, "|%s", input->language);
+  if (written < 0 || (size_t)written >= key_size - out) {
+    return -1;
+  }
+  return 0;
+}
+
+// FNV-1a, same scheme the TTS cache and dialogue indexes use
+static uint64_t intent_cache_hash(const char* key) {
+  uint64_t hash = 1469598103934665603ULL;
+  for (const unsigned char* p = (const unsigned char*)key; *p; p++) {
+    hash ^= *p;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+static intent_cache_entry_t* intent_cache_find(ethervox_intent_cache_t* cache, uint64_t hash,
+                                               const char* key) {
+  for (int i = 0; i < INTENT_CACHE_CAPACITY; i++) {
+    intent_cache_entry_t* entry = &cache->entries[i];
+    if (entry->expires_at_ms != 0 && entry->hash == hash && strcmp(entry->key, key) == 0) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static void intent_cache_store(ethervox_intent_cache_t* cache, uint64_t hash, const char* key,
+                               const ethervox_intent_result_t* result,
+                               const ethervox_intent_plugin_t* plugin) {
+  const uint32_t ttl_ms = plugin->cache_ttl_ms != 0 ? plugin->cache_ttl_ms
+                                                    : kIntentCacheDefaultTtlMs;
+
+  // Reuse an existing entry for this key, else a free slot, else the
+  // least-recently-used entry
+  intent_cache_entry_t* slot = intent_cache_find(cache, hash, key);
+  if (!slot) {
+    for (int i = 0; i < INTENT_CACHE_CAPACITY; i++) {
+      intent_cache_entry_t* entry = &cache->entries[i];
+      if (entry->expires_at_ms == 0) {
+        slot = entry;
+        break;
+      }
+      if (!slot || entry->last_used_seq < slot->last_used_seq) {
+        slot = entry;
+      }
+    }
+  }
+
+  snprintf(slot->key, sizeof(slot->key), "%s", key);
+  slot->hash = hash;
+  slot->result = *result;
+  snprintf(slot->plugin_name, sizeof(slot->plugin_name), "%s", plugin->name);
+  slot->expires_at_ms = router_monotonic_ms() + ttl_ms;
+  slot->last_used_seq = ++cache->use_seq;
+}
+
+void ethervox_sdk_intent_cache_invalidate(ethervox_sdk_t* sdk, const char* plugin_name) {
+  if (!sdk || !sdk->intent_cache)
+    return;
+
+  for (int i = 0; i < INTENT_CACHE_CAPACITY; i++) {
+    intent_cache_entry_t* entry = &sdk->intent_cache->entries[i];
+    if (entry->expires_at_ms != 0 &&
+        (!plugin_name || strcmp(entry->plugin_name, plugin_name) == 0)) {
+      entry->expires_at_ms = 0;
+    }
+  }
+}
+
+void ethervox_sdk_intent_cache_stats(const ethervox_sdk_t* sdk, uint64_t* hits,
+                                     uint64_t* misses) {
+  if (hits)
+    *hits = (sdk && sdk->intent_cache) ? sdk->intent_cache->hits : 0;
+  if (misses)
+    *misses = (sdk && sdk->intent_cache) ? sdk->intent_cache->misses : 0;
+}
+
 // Intent Plugin Management
 int ethervox_sdk_register_intent_plugin(ethervox_sdk_t* sdk, ethervox_intent_plugin_t* plugin) {
   if (!sdk || !plugin || sdk->intent_plugin_count >= 16)
@@ -150,6 +390,9 @@ int ethervox_sdk_register_intent_plugin(ethervox_sdk_t* sdk, ethervox_intent_plu
   plugin->successful_requests = 0;
   plugin->average_processing_time_ms = 0.0f;
 
+  // A new plugin may out-rank earlier parses for texts already cached
+  ethervox_sdk_intent_cache_invalidate(sdk, NULL);
+
   printf("Registered intent plugin: %s v%s\n", plugin->name, plugin->version);
 
   return 0;
@@ -172,6 +415,10 @@ int ethervox_sdk_unregister_intent_plugin(ethervox_sdk_t* sdk, const char* plugi
       }
       sdk->intent_plugin_count--;
 
+      // Results the departing plugin produced must not outlive it; other
+      // plugins' entries stay valid (removal cannot change their outcome)
+      ethervox_sdk_intent_cache_invalidate(sdk, plugin_name);
+
       printf("Unregistered intent plugin: %s\n", plugin_name);
       return 0;
     }
@@ -204,7 +451,28 @@ int ethervox_sdk_process_intent(ethervox_sdk_t* sdk, const ethervox_stt_input_t*
   result->type = ETHERVOX_INTENT_UNKNOWN;
   result->confidence = 0.0f;
   result->timestamp = time(NULL);
-  snprintf(result->language, sizeof(result->language), "%s", input->language ? input->language : "");
+  snprintf(result->language, sizeof(result->language), "%s", input->language);
+
+  // Serve repeats from the cache before touching any plugin
+  char cache_key[INTENT_CACHE_KEY_BYTES];
+  uint64_t cache_hash = 0;
+  const bool cacheable =
+      sdk->intent_cache && intent_cache_build_key(input, cache_key, sizeof(cache_key)) == 0;
+  if (cacheable) {
+    cache_hash = intent_cache_hash(cache_key);
+    intent_cache_entry_t* entry = intent_cache_find(sdk->intent_cache, cache_hash, cache_key);
+    if (entry) {
+      if (router_monotonic_ms() < entry->expires_at_ms) {
+        *result = entry->result;
+        result->timestamp = time(NULL);  // This occurrence, not the cached one
+        entry->last_used_seq = ++sdk->intent_cache->use_seq;
+        sdk->intent_cache->hits++;
+        return 0;
+      }
+      entry->expires_at_ms = 0;  // Expired; free the slot
+    }
+    sdk->intent_cache->misses++;
+  }
 
   // Try each intent plugin until one succeeds
   for (uint32_t i = 0; i < sdk->intent_plugin_count; i++) {
@@ -239,6 +507,9 @@ int ethervox_sdk_process_intent(ethervox_sdk_t* sdk, const ethervox_stt_input_t*
 
     if (ret == 0 && result->type != ETHERVOX_INTENT_UNKNOWN) {
       plugin->successful_requests++;
+      if (cacheable) {
+        intent_cache_store(sdk->intent_cache, cache_hash, cache_key, result, plugin);
+      }
       return 0;  // Successfully parsed intent
     }
   }
@@ -293,6 +564,306 @@ int ethervox_sdk_add_model_config(ethervox_sdk_t* sdk, const ethervox_model_conf
   return 0;
 }
 
+// Adaptive routing: EWMA decay factor and the error rate above which a model
+// stops being eligible (it still gets occasional probes as rates decay)
+static const float kRouterEwmaAlpha = 0.2f;
+static const float kRouterMaxErrorRate = 0.5f;
+static const uint32_t kRouterDefaultHedgeDelayMs = 250;
+
+static uint64_t router_monotonic_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)(ts.tv_nsec / 1000000L);
+}
+
+static void router_update_stats(ethervox_model_router_t* router, uint32_t index, bool success,
+                                float latency_ms) {
+  ethervox_model_stats_t* stats = &router->model_stats[index];
+
+  if (stats->requests == 0) {
+    stats->ewma_latency_ms = latency_ms;
+    stats->ewma_error_rate = success ? 0.0f : 1.0f;
+  } else {
+    stats->ewma_latency_ms += kRouterEwmaAlpha * (latency_ms - stats->ewma_latency_ms);
+    stats->ewma_error_rate += kRouterEwmaAlpha * ((success ? 0.0f : 1.0f) - stats->ewma_error_rate);
+  }
+  stats->requests++;
+  if (!success) {
+    stats->failures++;
+  }
+
+  // Keep the legacy global average in sync for existing dashboards
+  if (success) {
+    router->average_response_time_ms =
+        (router->average_response_time_ms * (float)router->successful_requests + latency_ms) /
+        (float)(router->successful_requests + 1);
+  }
+}
+
+// Effective cost of routing to a model: EWMA latency inflated by its error
+// rate. Untried models score 0 so each gets probed once before steady state.
+static float router_model_score(const ethervox_model_router_t* router, uint32_t index) {
+  const ethervox_model_stats_t* stats = &router->model_stats[index];
+  return stats->ewma_latency_ms * (1.0f + 4.0f * stats->ewma_error_rate);
+}
+
+static bool router_model_eligible(const ethervox_model_router_t* router, uint32_t index) {
+  return router->model_stats[index].ewma_error_rate < kRouterMaxErrorRate;
+}
+
+// Pick the lowest-scoring eligible model, skipping indices marked in
+// skip_mask. Falls back to ineligible models when nothing else remains.
+static int router_pick_model(const ethervox_model_router_t* router, uint32_t skip_mask) {
+  int best = -1;
+  int best_any = -1;
+  float best_score = 0.0f;
+  float best_any_score = 0.0f;
+
+  for (uint32_t i = 0; i < router->model_count && i < 16; i++) {
+    if (skip_mask & (1U << i))
+      continue;
+
+    const float score = router_model_score(router, i);
+    if (best_any < 0 || score < best_any_score) {
+      best_any = (int)i;
+      best_any_score = score;
+    }
+    if (router_model_eligible(router, i) && (best < 0 || score < best_score)) {
+      best = (int)i;
+      best_score = score;
+    }
+  }
+
+  return best >= 0 ? best : best_any;
+}
+
+static int router_find_local_llm(const ethervox_model_router_t* router, uint32_t skip_mask) {
+  for (uint32_t i = 0; i < router->model_count && i < 16; i++) {
+    if ((skip_mask & (1U << i)) == 0 && router->models[i].type == ETHERVOX_MODEL_TYPE_LOCAL_LLM &&
+        router->models[i].is_local) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+#if ETHERVOX_SDK_HEDGING_AVAILABLE
+
+// State shared between the caller and the remote worker during a hedged
+// request. Refcounted so whichever side finishes last frees it; the caller
+// never blocks on a hung remote once the local hedge has answered.
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t done_cond;
+  ethervox_model_route_fn route;
+  ethervox_llm_request_t request;
+  ethervox_model_config_t config;
+  ethervox_llm_response_t response;
+  int result;
+  bool done;
+  bool abandoned;  // Caller took the hedge; worker updates stats and frees
+  uint64_t started_ms;
+  float latency_ms;
+  ethervox_model_router_t* router;
+  uint32_t model_index;
+} router_hedge_ctx_t;
+
+static void router_hedge_ctx_release(router_hedge_ctx_t* ctx, bool last) {
+  if (last) {
+    pthread_mutex_destroy(&ctx->lock);
+    pthread_cond_destroy(&ctx->done_cond);
+    free(ctx);
+  }
+}
+
+static void* router_hedge_worker(void* arg) {
+  router_hedge_ctx_t* ctx = (router_hedge_ctx_t*)arg;
+
+  const int result = ctx->route(&ctx->request, &ctx->response, &ctx->config);
+  const float latency_ms = (float)(router_monotonic_ms() - ctx->started_ms);
+
+  pthread_mutex_lock(&ctx->lock);
+  ctx->result = result;
+  ctx->latency_ms = latency_ms;
+  ctx->done = true;
+  const bool abandoned = ctx->abandoned;
+  pthread_cond_signal(&ctx->done_cond);
+  pthread_mutex_unlock(&ctx->lock);
+
+  if (abandoned) {
+    // Caller already returned with the hedge result; record our outcome so
+    // the EWMA still learns how slow the remote really was
+    router_update_stats(ctx->router, ctx->model_index, result == 0, latency_ms);
+    router_hedge_ctx_release(ctx, true);
+  }
+  return NULL;
+}
+
+#endif  // ETHERVOX_SDK_HEDGING_AVAILABLE
+
+int ethervox_sdk_route_llm_request(ethervox_sdk_t* sdk, const ethervox_llm_request_t* request,
+                                   ethervox_llm_response_t* response) {
+  if (!sdk || !request || !response)
+    return -1;
+
+  ethervox_model_router_t* router = sdk->model_router;
+  if (!router || router->model_count == 0 || !router->route) {
+    snprintf(sdk->last_error, sizeof(sdk->last_error), "%s", "No model router configured");
+    return -1;
+  }
+
+  router->total_requests++;
+
+  // Try models in adaptive score order until one succeeds
+  uint32_t skip_mask = 0;
+  for (uint32_t attempt = 0; attempt < router->model_count; attempt++) {
+    const int index = router_pick_model(router, skip_mask);
+    if (index < 0)
+      break;
+    skip_mask |= 1U << index;
+    router->active_model_index = (uint32_t)index;
+
+    const ethervox_model_config_t* config = &router->models[index];
+
+#if ETHERVOX_SDK_HEDGING_AVAILABLE
+    const int local_index =
+        (router->enable_hedging && !config->is_local) ? router_find_local_llm(router, skip_mask) : -1;
+
+    if (local_index >= 0) {
+      router_hedge_ctx_t* ctx = (router_hedge_ctx_t*)calloc(1, sizeof(router_hedge_ctx_t));
+      if (ctx) {
+        pthread_mutex_init(&ctx->lock, NULL);
+        pthread_cond_init(&ctx->done_cond, NULL);
+        ctx->route = router->route;
+        ctx->request = *request;
+        ctx->config = *config;
+        ctx->router = router;
+        ctx->model_index = (uint32_t)index;
+        ctx->started_ms = router_monotonic_ms();
+
+        pthread_t worker;
+        if (pthread_create(&worker, NULL, router_hedge_worker, ctx) == 0) {
+          pthread_detach(worker);
+
+          // Give the remote hedge_delay_ms before firing the local model
+          struct timespec deadline;
+          clock_gettime(CLOCK_REALTIME, &deadline);
+          const uint32_t delay =
+              router->hedge_delay_ms ? router->hedge_delay_ms : kRouterDefaultHedgeDelayMs;
+          deadline.tv_sec += delay / 1000;
+          deadline.tv_nsec += (long)(delay % 1000) * 1000000L;
+          if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+          }
+
+          pthread_mutex_lock(&ctx->lock);
+          while (!ctx->done) {
+            if (pthread_cond_timedwait(&ctx->done_cond, &ctx->lock, &deadline) != 0)
+              break;
+          }
+
+          if (ctx->done) {
+            // Remote answered within the hedge window
+            const int result = ctx->result;
+            const float latency_ms = ctx->latency_ms;
+            if (result == 0)
+              *response = ctx->response;
+            pthread_mutex_unlock(&ctx->lock);
+            router_hedge_ctx_release(ctx, true);
+
+            router_update_stats(router, (uint32_t)index, result == 0, latency_ms);
+            if (result == 0) {
+              router->successful_requests++;
+              return 0;
+            }
+            continue;  // Remote failed fast; try the next model
+          }
+          pthread_mutex_unlock(&ctx->lock);
+
+          // Remote is slow: fire the local model and take the first completion
+          router->hedged_requests++;
+          const ethervox_model_config_t* local = &router->models[local_index];
+          const uint64_t local_start = router_monotonic_ms();
+          const int local_result = router->route(request, response, local);
+          const float local_latency = (float)(router_monotonic_ms() - local_start);
+          router_update_stats(router, (uint32_t)local_index, local_result == 0, local_latency);
+
+          pthread_mutex_lock(&ctx->lock);
+          if (ctx->done) {
+            // Remote finished while the local model ran; it was first
+            const int result = ctx->result;
+            const float latency_ms = ctx->latency_ms;
+            if (result == 0 && local_result != 0)
+              *response = ctx->response;
+            pthread_mutex_unlock(&ctx->lock);
+            router_hedge_ctx_release(ctx, true);
+            router_update_stats(router, (uint32_t)index, result == 0, latency_ms);
+
+            if (local_result == 0 || result == 0) {
+              router->successful_requests++;
+              return 0;
+            }
+            skip_mask |= 1U << local_index;
+            continue;
+          }
+
+          // Local won; the worker cleans up after the remote returns
+          ctx->abandoned = true;
+          pthread_mutex_unlock(&ctx->lock);
+
+          if (local_result == 0) {
+            router->hedge_wins++;
+            router->active_model_index = (uint32_t)local_index;
+            router->successful_requests++;
+            return 0;
+          }
+          skip_mask |= 1U << local_index;
+          continue;
+        }
+
+        // Thread creation failed; fall through to the sequential path
+        router_hedge_ctx_release(ctx, true);
+      }
+    }
+#endif  // ETHERVOX_SDK_HEDGING_AVAILABLE
+
+    const uint64_t start_ms = router_monotonic_ms();
+    const int result = router->route(request, response, config);
+    const float latency_ms = (float)(router_monotonic_ms() - start_ms);
+
+    router_update_stats(router, (uint32_t)index, result == 0, latency_ms);
+    if (result == 0) {
+      router->successful_requests++;
+      return 0;
+    }
+  }
+
+  snprintf(sdk->last_error, sizeof(sdk->last_error), "%s", "All models failed to serve request");
+  return -1;
+}
+
+int ethervox_sdk_set_hedging(ethervox_sdk_t* sdk, bool enable, uint32_t hedge_delay_ms) {
+  if (!sdk || !sdk->model_router)
+    return -1;
+
+#if ETHERVOX_SDK_HEDGING_AVAILABLE
+  sdk->model_router->enable_hedging = enable;
+  if (hedge_delay_ms > 0) {
+    sdk->model_router->hedge_delay_ms = hedge_delay_ms;
+  } else if (sdk->model_router->hedge_delay_ms == 0) {
+    sdk->model_router->hedge_delay_ms = kRouterDefaultHedgeDelayMs;
+  }
+  return 0;
+#else
+  (void)enable;
+  (void)hedge_delay_ms;
+  snprintf(sdk->last_error, sizeof(sdk->last_error), "%s",
+           "Hedged requests need thread support on this platform");
+  return -1;
+#endif
+}
+
 // Diagnostics Management
 int ethervox_sdk_set_log_callback(ethervox_sdk_t* sdk, ethervox_log_callback_fn callback,
                                   void* user_data) {
@@ -342,6 +913,590 @@ void ethervox_sdk_log(ethervox_sdk_t* sdk, ethervox_log_level_t level, const cha
   printf("[%s] %s: %s\n", ethervox_log_level_to_string(level), component, entry.message);
 }
 
+// Auto-tuner: startup micro-calibration plus profile-driven derivation of
+// runtime knobs, so heterogeneous deployments don't hand-maintain configs
+static const uint32_t kTuneCopyBytes = 4u * 1024u * 1024u;
+static const uint32_t kTuneCopyPasses = 8;
+static const uint32_t kTuneFlopIterations = 4u * 1024u * 1024u;
+
+static uint64_t tune_monotonic_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000L);
+}
+
+static uint32_t tune_detect_core_count(void) {
+#if ETHERVOX_SDK_HAVE_UNISTD && defined(_SC_NPROCESSORS_ONLN)
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  if (cores > 0)
+    return (uint32_t)cores;
+#endif
+  return 2;  // Conservative guess when the platform can't tell us
+}
+
+static float tune_measure_membw_mb_s(void) {
+  uint8_t* src = (uint8_t*)malloc(kTuneCopyBytes);
+  uint8_t* dst = (uint8_t*)malloc(kTuneCopyBytes);
+  if (!src || !dst) {
+    free(src);
+    free(dst);
+    return 0.0f;
+  }
+  memset(src, 0xA5, kTuneCopyBytes);
+
+  const uint64_t start = tune_monotonic_us();
+  for (uint32_t pass = 0; pass < kTuneCopyPasses; pass++) {
+    memcpy(dst, src, kTuneCopyBytes);
+    src[0] = dst[kTuneCopyBytes - 1];  // Keep the copies ordered and observable
+  }
+  const uint64_t elapsed_us = tune_monotonic_us() - start;
+
+  free(src);
+  free(dst);
+  if (elapsed_us == 0)
+    return 0.0f;
+  const float bytes = (float)kTuneCopyBytes * (float)kTuneCopyPasses;
+  return (bytes / (1024.0f * 1024.0f)) / ((float)elapsed_us / 1000000.0f);
+}
+
+static float tune_measure_single_core_gflops(void) {
+  // Eight independent accumulators keep the FPU pipeline busy; two ops each
+  // per iteration. Relative ordering across devices is what matters here.
+  float acc[8] = {0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 0.8f};
+
+  const uint64_t start = tune_monotonic_us();
+  for (uint32_t i = 0; i < kTuneFlopIterations; i++) {
+    for (uint32_t j = 0; j < 8; j++) {
+      acc[j] = acc[j] * 1.0000001f + 0.0000001f;
+    }
+  }
+  const uint64_t elapsed_us = tune_monotonic_us() - start;
+
+  volatile float sink = acc[0] + acc[1] + acc[2] + acc[3] + acc[4] + acc[5] + acc[6] + acc[7];
+  (void)sink;
+  if (elapsed_us == 0)
+    return 0.0f;
+  const float flops = (float)kTuneFlopIterations * 8.0f * 2.0f;
+  return flops / ((float)elapsed_us * 1000.0f);
+}
+
+int ethervox_sdk_auto_tune(ethervox_sdk_t* sdk, ethervox_tuning_t* tuning) {
+  if (!sdk || !tuning)
+    return -1;
+
+  memset(tuning, 0, sizeof(*tuning));
+
+  const ethervox_platform_capabilities_t caps = ethervox_platform_get_capabilities();
+  const ethervox_device_profile_t* profile = sdk->device_profile;
+  const uint32_t cores = tune_detect_core_count();
+
+  tuning->measured_membw_mb_s = tune_measure_membw_mb_s();
+  tuning->measured_gflops = tune_measure_single_core_gflops();
+
+  // Inference threads: leave one core for the audio path on multi-core
+  // parts, and don't oversubscribe when the profile promises concurrent
+  // streams (each stream gets its own slice of the cores)
+  uint32_t threads = (cores > 1) ? cores - 1 : 1;
+  if (profile && profile->max_concurrent_streams > 1) {
+    uint32_t per_stream = cores / profile->max_concurrent_streams;
+    if (per_stream < 1)
+      per_stream = 1;
+    if (per_stream < threads)
+      threads = per_stream;
+  }
+  tuning->llm_thread_count = threads;
+
+  // Audio period: fast memory can afford small periods (lower latency);
+  // slow parts need headroom to avoid overruns
+  if (tuning->measured_membw_mb_s >= 4000.0f) {
+    tuning->audio_buffer_size = 256;
+  } else if (tuning->measured_membw_mb_s >= 1000.0f) {
+    tuning->audio_buffer_size = 512;
+  } else {
+    tuning->audio_buffer_size = 1024;
+  }
+
+  // STT chunk (samples at 16 kHz): quicker cores decode shorter chunks for
+  // snappier partial results; slow ones amortize decoder overhead
+  if (tuning->measured_gflops >= 4.0f) {
+    tuning->stt_chunk_samples = 8000;  // 0.5 s
+  } else if (tuning->measured_gflops >= 1.0f) {
+    tuning->stt_chunk_samples = 16000;  // 1.0 s
+  } else {
+    tuning->stt_chunk_samples = 24000;  // 1.5 s
+  }
+
+  // Quantization by available RAM; unknown RAM gets the middle ground. A
+  // profile that rules out edge inference gets the smallest footprint since
+  // any local model there is a fallback at best.
+  const uint32_t ram_mb = caps.ram_size_mb;
+  const char* quant = "Q4_K_M";
+  if (profile && !profile->supports_edge_inference) {
+    quant = "Q4_0";
+  } else if (ram_mb >= 4096) {
+    quant = "Q5_K_M";
+  } else if (ram_mb > 0 && ram_mb < 1024) {
+    quant = "Q4_0";
+  }
+  snprintf(tuning->quantization, sizeof(tuning->quantization), "%s", quant);
+
+  if (profile && profile->preferred_model[0] != '\0') {
+    snprintf(tuning->model_name, sizeof(tuning->model_name), "%s", profile->preferred_model);
+  }
+
+  ethervox_sdk_log(sdk, ETHERVOX_LOG_INFO, "tuner",
+                   "membw=%.0f MB/s gflops=%.2f -> threads=%u buffer=%u chunk=%u quant=%s",
+                   (double)tuning->measured_membw_mb_s, (double)tuning->measured_gflops,
+                   tuning->llm_thread_count, tuning->audio_buffer_size, tuning->stt_chunk_samples,
+                   tuning->quantization);
+  return 0;
+}
+
+// Latency histograms
+static uint32_t histogram_bucket_for(uint64_t latency_us) {
+  // Bucket i covers [2^i, 2^(i+1)) us; bucket 0 also takes 0
+  uint32_t bucket = 0;
+  while (latency_us > 1 && bucket < ETHERVOX_PERF_BUCKETS - 1) {
+    latency_us >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+void ethervox_sdk_record_latency(ethervox_sdk_t* sdk, ethervox_perf_stage_t stage,
+                                 uint64_t latency_us) {
+  if (!sdk || !sdk->diagnostics || stage >= ETHERVOX_PERF_STAGE_COUNT)
+    return;
+  if (!sdk->diagnostics->enable_performance_tracking)
+    return;
+
+  ethervox_latency_histogram_t* hist = &sdk->diagnostics->latency_histograms[stage];
+  sdk_atomic_add_u64(&hist->buckets[histogram_bucket_for(latency_us)], 1);
+  sdk_atomic_add_u64(&hist->count, 1);
+  sdk_atomic_add_u64(&hist->sum_us, latency_us);
+
+  // max is advisory; a racy overwrite loses at most one concurrent peak
+  if (latency_us > sdk_atomic_load_u64(&hist->max_us)) {
+    hist->max_us = latency_us;
+  }
+}
+
+// Bridge from the core tracing hooks into the latency histograms. The trace
+// stage enum matches ethervox_perf_stage_t member for member.
+static void sdk_trace_sink(const ethervox_trace_span_t* span, void* user_data) {
+  ethervox_sdk_t* sdk = (ethervox_sdk_t*)user_data;
+  if (span->stage >= ETHERVOX_TRACE_STAGE_COUNT) {
+    return;
+  }
+  ethervox_sdk_record_latency(sdk, (ethervox_perf_stage_t)span->stage,
+                              span->end_us - span->start_us);
+}
+
+int ethervox_sdk_enable_tracing(ethervox_sdk_t* sdk) {
+  if (!sdk || !sdk->diagnostics)
+    return -1;
+
+  ethervox_trace_set_sink(sdk_trace_sink, sdk);
+  return 0;
+}
+
+int ethervox_sdk_get_latency_snapshot(ethervox_sdk_t* sdk, ethervox_perf_stage_t stage,
+                                      ethervox_latency_histogram_t* snapshot) {
+  if (!sdk || !sdk->diagnostics || stage >= ETHERVOX_PERF_STAGE_COUNT || !snapshot)
+    return -1;
+
+  const ethervox_latency_histogram_t* hist = &sdk->diagnostics->latency_histograms[stage];
+  for (uint32_t i = 0; i < ETHERVOX_PERF_BUCKETS; i++) {
+    snapshot->buckets[i] = sdk_atomic_load_u64(&hist->buckets[i]);
+  }
+  snapshot->count = sdk_atomic_load_u64(&hist->count);
+  snapshot->sum_us = sdk_atomic_load_u64(&hist->sum_us);
+  snapshot->max_us = sdk_atomic_load_u64(&hist->max_us);
+  return 0;
+}
+
+uint64_t ethervox_latency_histogram_percentile_us(const ethervox_latency_histogram_t* histogram,
+                                                  float percentile) {
+  if (!histogram || histogram->count == 0)
+    return 0;
+  if (percentile < 0.0f)
+    percentile = 0.0f;
+  if (percentile > 100.0f)
+    percentile = 100.0f;
+
+  uint64_t rank = (uint64_t)((percentile / 100.0f) * (float)(histogram->count - 1)) + 1;
+  uint64_t seen = 0;
+  for (uint32_t i = 0; i < ETHERVOX_PERF_BUCKETS; i++) {
+    seen += histogram->buckets[i];
+    if (seen >= rank) {
+      // Report the bucket's upper bound so the estimate never undershoots
+      return (i >= 63) ? UINT64_MAX : (((uint64_t)1 << (i + 1)) - 1);
+    }
+  }
+  return histogram->max_us;
+}
+
+const char* ethervox_perf_stage_to_string(ethervox_perf_stage_t stage) {
+  switch (stage) {
+    case ETHERVOX_PERF_STAGE_CAPTURE:
+      return "capture";
+    case ETHERVOX_PERF_STAGE_WAKE:
+      return "wake";
+    case ETHERVOX_PERF_STAGE_STT:
+      return "stt";
+    case ETHERVOX_PERF_STAGE_INTENT:
+      return "intent";
+    case ETHERVOX_PERF_STAGE_LLM:
+      return "llm";
+    case ETHERVOX_PERF_STAGE_TTS:
+      return "tts";
+    default:
+      return "unknown";
+  }
+}
+
+// --- System metrics sampler ------------------------------------------------
+// One pass batches every metric source: a single pread of /proc/stat,
+// /proc/meminfo and /proc/net/dev plus the thermal zone over fds opened once
+// and kept, and one statvfs — instead of a dozen open/read/close cycles per
+// interval. The pass runs on a background thread rate-limited by
+// metrics_update_interval_ms and publishes through the seqlock above, so
+// readers copy a consistent struct without ever blocking the sampler (or
+// being blocked by it).
+
+static const uint64_t kSdkMetricsDefaultIntervalMs = 1000;
+static const uint64_t kSdkMetricsPollSliceMs = 50;  // Shutdown responsiveness
+
+typedef struct {
+  ethervox_sdk_t* sdk;
+  volatile bool running;
+#if ETHERVOX_SDK_METRICS_THREAD_AVAILABLE
+  pthread_t thread;
+  bool thread_started;
+#endif
+#if ETHERVOX_SDK_METRICS_PROCFS
+  int stat_fd;
+  int meminfo_fd;
+  int thermal_fd;
+  int netdev_fd;
+#endif
+  // Previous counters for the delta-based metrics
+  uint64_t prev_cpu_total;
+  uint64_t prev_cpu_idle;
+  uint64_t prev_rx_bytes;
+  uint64_t prev_tx_bytes;
+  uint64_t prev_sample_ms;
+} sdk_metrics_sampler_t;
+
+static sdk_metrics_sampler_t g_metrics_sampler = {
+#if ETHERVOX_SDK_METRICS_PROCFS
+    .stat_fd = -1,
+    .meminfo_fd = -1,
+    .thermal_fd = -1,
+    .netdev_fd = -1,
+#endif
+    .sdk = NULL,
+};
+
+#if ETHERVOX_SDK_METRICS_PROCFS
+
+// Read a whole pseudo-file from offset 0 through a cached fd
+static int sampler_read_file(int* fd, const char* path, char* buf, size_t cap) {
+  if (*fd < 0) {
+    *fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (*fd < 0)
+      return -1;
+  }
+  ssize_t n = pread(*fd, buf, cap - 1, 0);
+  if (n <= 0)
+    return -1;
+  buf[n] = '\0';
+  return 0;
+}
+
+static int sampler_parse_cpu(const char* buf, uint64_t* total, uint64_t* idle) {
+  // "cpu  user nice system idle iowait irq softirq steal ..."
+  unsigned long long v[8] = {0};
+  if (strncmp(buf, "cpu ", 4) != 0)
+    return -1;
+  int fields = sscanf(buf + 4, "%llu %llu %llu %llu %llu %llu %llu %llu", &v[0], &v[1], &v[2],
+                      &v[3], &v[4], &v[5], &v[6], &v[7]);
+  if (fields < 4)
+    return -1;
+  *total = 0;
+  for (int i = 0; i < fields; i++) {
+    *total += v[i];
+  }
+  *idle = v[3] + ((fields > 4) ? v[4] : 0);  // idle + iowait
+  return 0;
+}
+
+static uint64_t sampler_meminfo_kb(const char* buf, const char* key) {
+  const char* line = strstr(buf, key);
+  if (!line)
+    return 0;
+  unsigned long long kb = 0;
+  if (sscanf(line + strlen(key), " %llu", &kb) != 1)
+    return 0;
+  return kb;
+}
+
+// Sum rx/tx byte counters across every interface except loopback
+static void sampler_parse_netdev(const char* buf, uint64_t* rx_bytes, uint64_t* tx_bytes) {
+  *rx_bytes = 0;
+  *tx_bytes = 0;
+  for (const char* line = buf; line; line = strchr(line, '\n'), line = line ? line + 1 : NULL) {
+    const char* colon = strchr(line, ':');
+    const char* eol = strchr(line, '\n');
+    if (!colon || (eol && colon > eol))
+      continue;
+    const char* name = line;
+    while (*name == ' ')
+      name++;
+    if (strncmp(name, "lo:", 3) == 0)
+      continue;
+    unsigned long long f[9] = {0};
+    if (sscanf(colon + 1, "%llu %llu %llu %llu %llu %llu %llu %llu %llu", &f[0], &f[1], &f[2],
+               &f[3], &f[4], &f[5], &f[6], &f[7], &f[8]) == 9) {
+      *rx_bytes += f[0];
+      *tx_bytes += f[8];
+    }
+  }
+}
+
+#endif  // ETHERVOX_SDK_METRICS_PROCFS
+
+// One batched sampling pass into *metrics; delta state lives in the sampler
+static void sampler_collect(sdk_metrics_sampler_t* sampler, ethervox_system_metrics_t* metrics) {
+#if ETHERVOX_SDK_METRICS_PROCFS
+  char buf[8192];
+  const uint64_t now_ms = router_monotonic_ms();
+  const uint64_t elapsed_ms =
+      (sampler->prev_sample_ms > 0) ? (now_ms - sampler->prev_sample_ms) : 0;
+  sampler->prev_sample_ms = now_ms;
+
+  if (sampler_read_file(&sampler->stat_fd, "/proc/stat", buf, sizeof(buf)) == 0) {
+    uint64_t total = 0;
+    uint64_t idle = 0;
+    if (sampler_parse_cpu(buf, &total, &idle) == 0) {
+      const uint64_t d_total = total - sampler->prev_cpu_total;
+      const uint64_t d_idle = idle - sampler->prev_cpu_idle;
+      if (sampler->prev_cpu_total > 0 && d_total > 0) {
+        metrics->cpu_usage_percent = 100.0f * (float)(d_total - d_idle) / (float)d_total;
+      }
+      sampler->prev_cpu_total = total;
+      sampler->prev_cpu_idle = idle;
+    }
+  }
+
+  if (sampler_read_file(&sampler->meminfo_fd, "/proc/meminfo", buf, sizeof(buf)) == 0) {
+    const uint64_t total_kb = sampler_meminfo_kb(buf, "MemTotal:");
+    const uint64_t avail_kb = sampler_meminfo_kb(buf, "MemAvailable:");
+    if (total_kb > 0) {
+      metrics->memory_total_mb = (uint32_t)(total_kb / 1024);
+      metrics->memory_used_mb = (uint32_t)((total_kb - avail_kb) / 1024);
+    }
+  }
+
+  struct statvfs vfs;
+  if (statvfs("/", &vfs) == 0 && vfs.f_blocks > 0) {
+    metrics->disk_usage_percent =
+        100.0f * (float)(vfs.f_blocks - vfs.f_bavail) / (float)vfs.f_blocks;
+  }
+
+  if (sampler_read_file(&sampler->thermal_fd, "/sys/class/thermal/thermal_zone0/temp", buf,
+                        sizeof(buf)) == 0) {
+    metrics->temperature_celsius = (float)atoi(buf) / 1000.0f;
+  }
+
+  if (sampler_read_file(&sampler->netdev_fd, "/proc/net/dev", buf, sizeof(buf)) == 0) {
+    uint64_t rx_bytes = 0;
+    uint64_t tx_bytes = 0;
+    sampler_parse_netdev(buf, &rx_bytes, &tx_bytes);
+    if (elapsed_ms > 0 && rx_bytes >= sampler->prev_rx_bytes &&
+        tx_bytes >= sampler->prev_tx_bytes) {
+      // bytes * 8 / ms == kbit/s
+      metrics->network_rx_kbps = (uint32_t)((rx_bytes - sampler->prev_rx_bytes) * 8 / elapsed_ms);
+      metrics->network_tx_kbps = (uint32_t)((tx_bytes - sampler->prev_tx_bytes) * 8 / elapsed_ms);
+    }
+    sampler->prev_rx_bytes = rx_bytes;
+    sampler->prev_tx_bytes = tx_bytes;
+  }
+#else
+  (void)sampler;
+  (void)metrics;
+#endif
+}
+
+static void sampler_sample_once(sdk_metrics_sampler_t* sampler) {
+  ethervox_diagnostics_t* diag = sampler->sdk->diagnostics;
+
+  // Start from the published struct so fields owned elsewhere (audio
+  // activity flags, connection count) survive the publish
+  ethervox_system_metrics_t metrics = diag->current_metrics;
+  sampler_collect(sampler, &metrics);
+
+  sdk_seq_write_enter(&diag->metrics_seq);  // Odd: write in progress
+  diag->current_metrics = metrics;
+  sdk_seq_write_exit(&diag->metrics_seq);  // Even: consistent
+  diag->last_metrics_update = router_monotonic_ms();
+}
+
+#if ETHERVOX_SDK_METRICS_THREAD_AVAILABLE
+
+static void* sampler_thread_main(void* arg) {
+  sdk_metrics_sampler_t* sampler = (sdk_metrics_sampler_t*)arg;
+
+  while (sampler->running) {
+    sampler_sample_once(sampler);
+
+    uint64_t interval = sampler->sdk->diagnostics->metrics_update_interval_ms;
+    if (interval == 0) {
+      interval = kSdkMetricsDefaultIntervalMs;
+    }
+    for (uint64_t waited = 0; sampler->running && waited < interval;
+         waited += kSdkMetricsPollSliceMs) {
+      struct timespec slice = {.tv_sec = 0, .tv_nsec = (long)kSdkMetricsPollSliceMs * 1000000L};
+      nanosleep(&slice, NULL);
+    }
+  }
+  return NULL;
+}
+
+#endif  // ETHERVOX_SDK_METRICS_THREAD_AVAILABLE
+
+int ethervox_sdk_start_metrics_sampler(ethervox_sdk_t* sdk) {
+  if (!sdk || !sdk->diagnostics)
+    return -1;
+
+#if ETHERVOX_SDK_METRICS_THREAD_AVAILABLE
+  if (g_metrics_sampler.thread_started)
+    return 0;  // Already running
+
+  g_metrics_sampler.sdk = sdk;
+  g_metrics_sampler.running = true;
+  sampler_sample_once(&g_metrics_sampler);  // Prime the deltas and publish once
+
+  if (pthread_create(&g_metrics_sampler.thread, NULL, sampler_thread_main,
+                     &g_metrics_sampler) != 0) {
+    g_metrics_sampler.running = false;
+    snprintf(sdk->last_error, sizeof(sdk->last_error), "%s",
+             "Failed to start metrics sampler thread");
+    return -1;
+  }
+  g_metrics_sampler.thread_started = true;
+  return 0;
+#else
+  snprintf(sdk->last_error, sizeof(sdk->last_error), "%s",
+           "Metrics sampler requires pthreads; metrics sample inline instead");
+  return -1;
+#endif
+}
+
+void ethervox_sdk_stop_metrics_sampler(ethervox_sdk_t* sdk) {
+  (void)sdk;
+
+#if ETHERVOX_SDK_METRICS_THREAD_AVAILABLE
+  if (g_metrics_sampler.thread_started) {
+    g_metrics_sampler.running = false;
+    pthread_join(g_metrics_sampler.thread, NULL);
+    g_metrics_sampler.thread_started = false;
+  }
+#endif
+
+#if ETHERVOX_SDK_METRICS_PROCFS
+  int* fds[] = {&g_metrics_sampler.stat_fd, &g_metrics_sampler.meminfo_fd,
+                &g_metrics_sampler.thermal_fd, &g_metrics_sampler.netdev_fd};
+  for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++) {
+    if (*fds[i] >= 0) {
+      close(*fds[i]);
+      *fds[i] = -1;
+    }
+  }
+#endif
+
+  g_metrics_sampler.sdk = NULL;
+  g_metrics_sampler.prev_sample_ms = 0;
+  g_metrics_sampler.prev_cpu_total = 0;
+  g_metrics_sampler.prev_cpu_idle = 0;
+  g_metrics_sampler.prev_rx_bytes = 0;
+  g_metrics_sampler.prev_tx_bytes = 0;
+}
+
+int ethervox_sdk_get_system_metrics(ethervox_sdk_t* sdk, ethervox_system_metrics_t* metrics) {
+  if (!sdk || !sdk->diagnostics || !metrics)
+    return -1;
+
+  ethervox_diagnostics_t* diag = sdk->diagnostics;
+
+  // Without the background thread, sample inline — still one batched pass,
+  // rate-limited by metrics_update_interval_ms so chatty callers don't turn
+  // reads into syscall storms
+  if (!g_metrics_sampler.running) {
+    uint64_t interval = diag->metrics_update_interval_ms;
+    if (interval == 0) {
+      interval = kSdkMetricsDefaultIntervalMs;
+    }
+    const uint64_t now_ms = router_monotonic_ms();
+    if (diag->last_metrics_update == 0 || now_ms - diag->last_metrics_update >= interval) {
+      g_metrics_sampler.sdk = sdk;
+      sampler_sample_once(&g_metrics_sampler);
+    }
+  }
+
+  // Seqlock copy: retry while a publish is in flight or raced the copy
+  uint32_t seq_before;
+  uint32_t seq_after;
+  do {
+    seq_before = sdk_seq_load(&diag->metrics_seq);
+    *metrics = diag->current_metrics;
+    seq_after = sdk_seq_load(&diag->metrics_seq);
+  } while ((seq_before & 1u) || seq_before != seq_after);
+
+  return 0;
+}
+
+int ethervox_sdk_export_diagnostics(ethervox_sdk_t* sdk, const char* filepath) {
+  if (!sdk || !sdk->diagnostics || !filepath)
+    return -1;
+
+  FILE* file = fopen(filepath, "w");
+  if (!file) {
+    snprintf(sdk->last_error, sizeof(sdk->last_error), "Failed to open %s for writing", filepath);
+    return -1;
+  }
+
+  fprintf(file, "EthervoxAI diagnostics (SDK %s)\n\n", ethervox_sdk_get_version_string());
+
+  fprintf(file, "Latency histograms (us):\n");
+  for (uint32_t stage = 0; stage < ETHERVOX_PERF_STAGE_COUNT; stage++) {
+    ethervox_latency_histogram_t snap;
+    if (ethervox_sdk_get_latency_snapshot(sdk, (ethervox_perf_stage_t)stage, &snap) != 0)
+      continue;
+
+    uint64_t mean = (snap.count > 0) ? (snap.sum_us / snap.count) : 0;
+    fprintf(file, "  %-8s count=%llu mean=%llu p50=%llu p95=%llu p99=%llu max=%llu\n",
+            ethervox_perf_stage_to_string((ethervox_perf_stage_t)stage),
+            (unsigned long long)snap.count, (unsigned long long)mean,
+            (unsigned long long)ethervox_latency_histogram_percentile_us(&snap, 50.0f),
+            (unsigned long long)ethervox_latency_histogram_percentile_us(&snap, 95.0f),
+            (unsigned long long)ethervox_latency_histogram_percentile_us(&snap, 99.0f),
+            (unsigned long long)snap.max_us);
+  }
+
+  ethervox_diagnostics_t* diag = sdk->diagnostics;
+  fprintf(file, "\nRecent log entries (%u):\n", diag->log_count);
+  uint32_t start = (diag->log_count < 1000) ? 0 : diag->log_head;
+  for (uint32_t i = 0; i < diag->log_count; i++) {
+    const ethervox_log_entry_t* entry = &diag->log_buffer[(start + i) % 1000];
+    fprintf(file, "  [%s] %s: %s\n", ethervox_log_level_to_string(entry->level), entry->component,
+            entry->message);
+  }
+
+  fclose(file);
+  return 0;
+}
+
 // Utility Functions
 const char* ethervox_intent_type_to_string(ethervox_intent_type_t type) {
   switch (type) {
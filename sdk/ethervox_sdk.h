@@ -32,6 +32,7 @@ extern "C" {
 // Forward declarations
 typedef struct ethervox_sdk_t ethervox_sdk_t;
 typedef struct ethervox_intent_plugin_t ethervox_intent_plugin_t;
+typedef struct ethervox_intent_cache_t ethervox_intent_cache_t;
 typedef struct ethervox_model_router_t ethervox_model_router_t;
 typedef struct ethervox_diagnostics_t ethervox_diagnostics_t;
 typedef struct ethervox_device_profile_t ethervox_device_profile_t;
@@ -87,6 +88,12 @@ struct ethervox_intent_plugin_t {
   uint64_t total_requests;
   uint64_t successful_requests;
   float average_processing_time_ms;
+
+  // How long this plugin's results may be served from the intent cache
+  // (0 picks the default, currently 5 minutes). Remote parsers whose
+  // answers drift can set this shorter; ethervox_sdk_intent_cache_invalidate
+  // drops entries immediately on config changes.
+  uint32_t cache_ttl_ms;
 };
 
 // Model Router Interface
@@ -131,6 +138,14 @@ typedef int (*ethervox_model_route_fn)(const ethervox_llm_request_t* request,
                                        ethervox_llm_response_t* response,
                                        const ethervox_model_config_t* config);
 
+// Per-model adaptive routing statistics
+typedef struct {
+  float ewma_latency_ms;   // Exponentially weighted moving average; 0 = untried
+  float ewma_error_rate;   // 0.0 .. 1.0, same decay as latency
+  uint64_t requests;
+  uint64_t failures;
+} ethervox_model_stats_t;
+
 struct ethervox_model_router_t {
   char name[64];
   uint32_t model_count;
@@ -141,7 +156,19 @@ struct ethervox_model_router_t {
   uint64_t total_requests;
   uint64_t successful_requests;
   float average_response_time_ms;
-  uint32_t active_model_index;
+  uint32_t active_model_index;  // Model chosen for the most recent request
+
+  // Adaptive routing: per-model EWMA latency and error rate; requests go to
+  // the lowest-scoring eligible model (untried models are probed first)
+  ethervox_model_stats_t model_stats[16];
+
+  // Hedging: when the chosen remote model has not answered after
+  // hedge_delay_ms, fire the local LLM in parallel and take the first
+  // completion (see ethervox_sdk_set_hedging)
+  bool enable_hedging;
+  uint32_t hedge_delay_ms;
+  uint64_t hedged_requests;
+  uint64_t hedge_wins;  // Requests where the local hedge answered first
 };
 
 // Diagnostics Interface
@@ -177,6 +204,31 @@ typedef struct {
 
 typedef void (*ethervox_log_callback_fn)(const ethervox_log_entry_t* entry, void* user_data);
 
+// Pipeline stages instrumented with latency histograms
+typedef enum {
+  ETHERVOX_PERF_STAGE_CAPTURE = 0,
+  ETHERVOX_PERF_STAGE_WAKE,
+  ETHERVOX_PERF_STAGE_STT,
+  ETHERVOX_PERF_STAGE_INTENT,
+  ETHERVOX_PERF_STAGE_LLM,
+  ETHERVOX_PERF_STAGE_TTS,
+  ETHERVOX_PERF_STAGE_COUNT
+} ethervox_perf_stage_t;
+
+// Power-of-two latency buckets: bucket i counts samples in [2^i, 2^(i+1)) us
+#define ETHERVOX_PERF_BUCKETS 32
+
+// Fixed-bucket latency histogram. Updated with relaxed atomic increments
+// only, so recording is a few ns and safe from any thread without locks;
+// snapshots are read the same way and may be slightly torn across fields,
+// which is fine for monitoring.
+typedef struct {
+  uint64_t buckets[ETHERVOX_PERF_BUCKETS];
+  uint64_t count;
+  uint64_t sum_us;
+  uint64_t max_us;
+} ethervox_latency_histogram_t;
+
 struct ethervox_diagnostics_t {
   ethervox_log_callback_fn log_callback;
   void* log_user_data;
@@ -189,14 +241,22 @@ struct ethervox_diagnostics_t {
   uint64_t metrics_update_interval_ms;
   uint64_t last_metrics_update;
 
+  // Seqlock over current_metrics: odd while the sampler is mid-publish.
+  // Readers (ethervox_sdk_get_system_metrics) spin-copy instead of blocking,
+  // so a metrics read never waits on the sampler and vice versa
+  volatile uint32_t metrics_seq;
+
   // Diagnostics configuration
   ethervox_log_level_t min_log_level;
   bool enable_performance_tracking;
   bool enable_memory_profiling;
+
+  // Per-stage latency histograms (active while enable_performance_tracking)
+  ethervox_latency_histogram_t latency_histograms[ETHERVOX_PERF_STAGE_COUNT];
 };
 
 // Device Profile Interface
-typedef struct {
+struct ethervox_device_profile_t {
   char name[64];
   char hardware_revision[32];
   char platform[32];
@@ -238,8 +298,7 @@ typedef struct {
   bool supports_edge_inference;
   uint32_t max_concurrent_streams;
   char preferred_model[64];
-
-} ethervox_device_profile_t;
+};
 
 // SDK Main Interface
 struct ethervox_sdk_t {
@@ -251,6 +310,7 @@ struct ethervox_sdk_t {
   // Core components
   ethervox_intent_plugin_t* intent_plugins[16];
   uint32_t intent_plugin_count;
+  ethervox_intent_cache_t* intent_cache;  // LRU over (normalized text, language)
 
   ethervox_model_router_t* model_router;
   ethervox_diagnostics_t* diagnostics;
@@ -275,12 +335,30 @@ ethervox_intent_plugin_t* ethervox_sdk_find_intent_plugin(ethervox_sdk_t* sdk, c
 int ethervox_sdk_process_intent(ethervox_sdk_t* sdk, const ethervox_stt_input_t* input,
                                 ethervox_intent_result_t* result);
 
+// The same few dozen commands dominate real traffic, so process_intent keeps
+// parsed results in an LRU cache keyed by (normalized text, language): a hit
+// skips the whole plugin chain, including remote round-trips. Entries expire
+// after the producing plugin's cache_ttl_ms and are flushed automatically
+// when plugins register or unregister. Call invalidate with a plugin name to
+// drop only that plugin's entries (e.g. after its configuration changed), or
+// NULL to flush everything.
+void ethervox_sdk_intent_cache_invalidate(ethervox_sdk_t* sdk, const char* plugin_name);
+void ethervox_sdk_intent_cache_stats(const ethervox_sdk_t* sdk, uint64_t* hits,
+                                     uint64_t* misses);
+
 // Model Router Management
 int ethervox_sdk_set_model_router(ethervox_sdk_t* sdk, ethervox_model_router_t* router);
 int ethervox_sdk_add_model_config(ethervox_sdk_t* sdk, const ethervox_model_config_t* config);
 int ethervox_sdk_route_llm_request(ethervox_sdk_t* sdk, const ethervox_llm_request_t* request,
                                    ethervox_llm_response_t* response);
 
+// Enable or disable hedged requests: when a remote model is chosen and has
+// not completed within hedge_delay_ms, a local ETHERVOX_MODEL_TYPE_LOCAL_LLM
+// model is fired in parallel and the first completion wins (delay 0 keeps the
+// current value). Requires a platform with pthreads; otherwise hedging is
+// silently unavailable and routing stays sequential.
+int ethervox_sdk_set_hedging(ethervox_sdk_t* sdk, bool enable, uint32_t hedge_delay_ms);
+
 // Diagnostics Management
 int ethervox_sdk_set_log_callback(ethervox_sdk_t* sdk, ethervox_log_callback_fn callback,
                                   void* user_data);
@@ -289,6 +367,59 @@ void ethervox_sdk_log(ethervox_sdk_t* sdk, ethervox_log_level_t level, const cha
 int ethervox_sdk_get_system_metrics(ethervox_sdk_t* sdk, ethervox_system_metrics_t* metrics);
 int ethervox_sdk_export_diagnostics(ethervox_sdk_t* sdk, const char* filepath);
 
+// Start the built-in system metrics sampler: a background thread batches
+// every metric source into one periodic pass (single /proc/stat and
+// /proc/meminfo read over cached fds, one statvfs, thermal zone, net
+// counters) every metrics_update_interval_ms and publishes current_metrics
+// through the seqlock. Without pthreads this returns -1 and
+// ethervox_sdk_get_system_metrics falls back to sampling inline at the same
+// rate limit; on non-Linux platforms the OS-sourced fields stay zero.
+int ethervox_sdk_start_metrics_sampler(ethervox_sdk_t* sdk);
+
+// Stop the sampler thread and release its cached fds (implied by
+// ethervox_sdk_cleanup)
+void ethervox_sdk_stop_metrics_sampler(ethervox_sdk_t* sdk);
+
+// Record one latency sample for a pipeline stage. Lock-free (relaxed atomic
+// increments), cheap enough to stay enabled in production; a no-op while
+// enable_performance_tracking is false.
+void ethervox_sdk_record_latency(ethervox_sdk_t* sdk, ethervox_perf_stage_t stage,
+                                 uint64_t latency_us);
+
+// Route core ethervox_trace_span() records into the per-stage latency
+// histograms, so traced turns feed the same percentiles exports use
+int ethervox_sdk_enable_tracing(ethervox_sdk_t* sdk);
+
+// Copy a consistent-enough view of one stage's histogram for reporting
+int ethervox_sdk_get_latency_snapshot(ethervox_sdk_t* sdk, ethervox_perf_stage_t stage,
+                                      ethervox_latency_histogram_t* snapshot);
+
+// Percentile (0.0 .. 100.0) from a snapshot; returns the upper bound of the
+// bucket containing the requested rank, 0 when the histogram is empty
+uint64_t ethervox_latency_histogram_percentile_us(const ethervox_latency_histogram_t* histogram,
+                                                  float percentile);
+const char* ethervox_perf_stage_to_string(ethervox_perf_stage_t stage);
+
+// Runtime settings derived by the auto-tuner from the device profile,
+// platform capabilities and a short startup micro-calibration. Callers plug
+// these into ethervox_llm_config_t / ethervox_audio_config_t / STT setup.
+typedef struct {
+  uint32_t llm_thread_count;     // Worker threads for local inference
+  uint32_t audio_buffer_size;    // Frames per period for ethervox_audio_config_t
+  uint32_t stt_chunk_samples;    // Samples handed to the STT decoder per chunk
+  char quantization[16];         // Suggested model quantization ("Q4_K_M", ...)
+  char model_name[64];           // Profile's preferred model when set
+
+  // Raw calibration measurements, exposed for diagnostics
+  float measured_membw_mb_s;     // Large-copy memory bandwidth
+  float measured_gflops;         // Single-core float throughput
+} ethervox_tuning_t;
+
+// Run the micro-calibration (~100 ms) and derive runtime settings from it
+// plus sdk->device_profile and the platform capabilities. Works without a
+// loaded profile; profile fields refine the result when present.
+int ethervox_sdk_auto_tune(ethervox_sdk_t* sdk, ethervox_tuning_t* tuning);
+
 // Device Profile Management
 int ethervox_sdk_load_device_profile(ethervox_sdk_t* sdk, const char* profile_path);
 int ethervox_sdk_save_device_profile(ethervox_sdk_t* sdk, const char* profile_path);
@@ -20,13 +20,116 @@
 #include <string.h>
 
 #include "ethervox/audio.h"
+#include "ethervox/audio_buffer.h"
+#include "ethervox/trace.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
-static const float kEthervoxAudioLanguageConfidenceDefault = 0.85f;
 static const float kEthervoxAudioFinalConfidenceDefault = 0.90f;
 static const uint32_t kEthervoxAudioTtsDurationSeconds = 2U;
 static const float kEthervoxAudioToneAmplitude = 0.5f;
 static const float kEthervoxAudioToneFrequencyHz = 440.0f;
 static const float kEthervoxAudioTwoPi = 6.283185307f;
+static const uint32_t kEthervoxAudioCaptureRingSlots = 8U;
+static const uint32_t kEthervoxAudioPlaybackPoolSlots = 2U;
+static const float kEthervoxAudioInt16Scale = 32768.0f;
+static const uint32_t kEthervoxAudioResampleTaps = 24U;
+static const float kEthervoxAudioResampleCutoff = 0.45f;  // Fraction of output Nyquist
+
+// Capture slot ring: a fixed slab carved into equally sized slots plus a
+// circular queue of free slot indices. The capture side pops indices at
+// acquire_pos, the consumer pushes them back at recycle_pos; each counter is
+// written by exactly one side, but the cursor advance must be a release store
+// paired with an acquire load on the other side so the free_slots[] write is
+// visible before the cursor is (plain or volatile stores reorder on ARM).
+#if defined(__GNUC__) || defined(__clang__)
+#define ring_cursor_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define ring_cursor_store(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#else
+#define ring_cursor_load(ptr) (*(ptr))
+#define ring_cursor_store(ptr, val) (*(ptr) = (val))
+#endif
+int ethervox_audio_capture_ring_init(ethervox_audio_capture_ring_t* ring, uint32_t slot_count,
+                                     uint32_t slot_samples) {
+  if (!ring || slot_count == 0 || slot_samples == 0) {
+    return -1;
+  }
+
+  memset(ring, 0, sizeof(ethervox_audio_capture_ring_t));
+
+  ring->slab = (int16_t*)malloc((size_t)slot_count * slot_samples * sizeof(int16_t));
+  if (!ring->slab) {
+    return -1;
+  }
+
+  ring->free_slots = (uint32_t*)malloc(slot_count * sizeof(uint32_t));
+  if (!ring->free_slots) {
+    free(ring->slab);
+    ring->slab = NULL;
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < slot_count; i++) {
+    ring->free_slots[i] = i;
+  }
+
+  ring->slot_count = slot_count;
+  ring->slot_samples = slot_samples;
+  ring->acquire_pos = 0;
+  ring->recycle_pos = slot_count;  // All slots start out free
+
+  return 0;
+}
+
+void ethervox_audio_capture_ring_cleanup(ethervox_audio_capture_ring_t* ring) {
+  if (!ring) {
+    return;
+  }
+
+  free(ring->slab);
+  free(ring->free_slots);
+  memset(ring, 0, sizeof(ethervox_audio_capture_ring_t));
+}
+
+int16_t* ethervox_audio_capture_ring_acquire(ethervox_audio_capture_ring_t* ring) {
+  if (!ring || !ring->slab) {
+    return NULL;
+  }
+
+  uint32_t pos = ring->acquire_pos;  // Only this side writes it
+  if (pos == ring_cursor_load(&ring->recycle_pos)) {
+    return NULL;  // All slots in flight; caller decides how to degrade
+  }
+
+  uint32_t slot = ring->free_slots[pos % ring->slot_count];
+  ring_cursor_store(&ring->acquire_pos, pos + 1);
+
+  return ring->slab + (size_t)slot * ring->slot_samples;
+}
+
+static void audio_capture_ring_release(ethervox_audio_capture_ring_t* ring, const int16_t* data) {
+  uint32_t slot = (uint32_t)((data - ring->slab) / ring->slot_samples);
+
+  uint32_t pos = ring->recycle_pos;  // Only this side writes it
+  ring->free_slots[pos % ring->slot_count] = slot;
+  ring_cursor_store(&ring->recycle_pos, pos + 1);
+}
+
+static bool audio_capture_ring_owns(const ethervox_audio_capture_ring_t* ring, const float* data) {
+  if (!ring->slab || !data) {
+    return false;
+  }
+
+  const int16_t* samples = (const int16_t*)data;
+  return samples >= ring->slab &&
+         samples < ring->slab + (size_t)ring->slot_count * ring->slot_samples;
+}
 
 // Default configuration
 ethervox_audio_config_t ethervox_audio_get_default_config(void) {
@@ -35,7 +138,8 @@ ethervox_audio_config_t ethervox_audio_get_default_config(void) {
                                     .bits_per_sample = ETHERVOX_AUDIO_BITS_PER_SAMPLE,
                                     .buffer_size = ETHERVOX_AUDIO_BUFFER_SIZE,
                                     .enable_noise_suppression = true,
-                                    .enable_echo_cancellation = true};
+                                    .enable_echo_cancellation = true,
+                                    .use_mmap_capture = false};
   return config;
 }
 
@@ -59,8 +163,32 @@ int ethervox_audio_init(ethervox_audio_runtime_t* runtime, const ethervox_audio_
   if (runtime->driver.init) {
     result = runtime->driver.init(runtime, config);
     if (result == 0) {
+      // Pre-allocate the capture slot ring so steady-state reads stay off the
+      // heap; drivers fall back to malloc if the ring is ever exhausted.
+      if (ethervox_audio_capture_ring_init(&runtime->capture_ring, kEthervoxAudioCaptureRingSlots,
+                                           config->buffer_size * config->channels) != 0) {
+        fprintf(stderr, "Failed to allocate audio capture ring\n");
+        if (runtime->driver.cleanup) {
+          runtime->driver.cleanup(runtime);
+        }
+        return -1;
+      }
+
+      // Playback buffers (TTS output) come from a fixed pool as well, keeping
+      // the whole audio path allocation-free in steady state
+      if (ethervox_audio_buffer_pool_init(
+              &runtime->playback_pool, kEthervoxAudioPlaybackPoolSlots,
+              config->sample_rate * kEthervoxAudioTtsDurationSeconds * sizeof(float)) != 0) {
+        fprintf(stderr, "Failed to allocate audio playback pool\n");
+        ethervox_audio_capture_ring_cleanup(&runtime->capture_ring);
+        if (runtime->driver.cleanup) {
+          runtime->driver.cleanup(runtime);
+        }
+        return -1;
+      }
       runtime->is_initialized = true;
-  snprintf(runtime->current_language, sizeof(runtime->current_language), "%s", "en");  // Default language
+      snprintf(runtime->current_language, sizeof(runtime->current_language), "%s",
+               "en");  // Default language
       runtime->language_confidence = 1.0f;
     } else {
       fprintf(stderr, "Platform audio driver initialization failed (err=%d)\n", result);
@@ -190,21 +318,370 @@ void ethervox_audio_cleanup(ethervox_audio_runtime_t* runtime) {
     runtime->driver.cleanup(runtime);
   }
 
+  ethervox_audio_capture_ring_cleanup(&runtime->capture_ring);
+  ethervox_audio_buffer_pool_cleanup(&runtime->playback_pool);
   runtime->is_initialized = false;
 }
 
-// Language detection (placeholder implementation)
+// Widen int16 PCM to normalized float once per buffer; AVX2/SSE2/NEON paths
+// process eight samples per iteration, everything else falls through to the
+// scalar tail.
+int ethervox_audio_convert_int16_to_float(const int16_t* input, float* output,
+                                          uint32_t sample_count) {
+  if (!input || !output) {
+    return -1;
+  }
+
+  const float scale = 1.0f / kEthervoxAudioInt16Scale;
+  uint32_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256 scale_v = _mm256_set1_ps(scale);
+  for (; i + 8 <= sample_count; i += 8) {
+    __m128i v16 = _mm_loadu_si128((const __m128i*)(input + i));
+    __m256 f = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v16));
+    _mm256_storeu_ps(output + i, _mm256_mul_ps(f, scale_v));
+  }
+#elif defined(__SSE2__)
+  const __m128 scale_v = _mm_set1_ps(scale);
+  for (; i + 8 <= sample_count; i += 8) {
+    __m128i v16 = _mm_loadu_si128((const __m128i*)(input + i));
+    // Sign-extend by moving samples into the high half and shifting back
+    __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), v16), 16);
+    __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(_mm_setzero_si128(), v16), 16);
+    _mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale_v));
+    _mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale_v));
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 8 <= sample_count; i += 8) {
+    int16x8_t v16 = vld1q_s16(input + i);
+    float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v16)));
+    float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v16)));
+    vst1q_f32(output + i, vmulq_n_f32(lo, scale));
+    vst1q_f32(output + i + 4, vmulq_n_f32(hi, scale));
+  }
+#endif
+
+  for (; i < sample_count; i++) {
+    output[i] = (float)input[i] * scale;
+  }
+
+  return 0;
+}
+
+// Windowed-sinc low-pass for the anti-alias FIR used on integer decimation
+static void audio_resample_design_fir(float* taps, uint32_t tap_count, float cutoff) {
+  float sum = 0.0f;
+  const float center = (float)(tap_count - 1) / 2.0f;
+
+  for (uint32_t i = 0; i < tap_count; i++) {
+    const float x = (float)i - center;
+    const float sinc =
+        (x == 0.0f) ? 1.0f : sinf(kEthervoxAudioTwoPi * cutoff * x / 2.0f) / (kEthervoxAudioTwoPi *
+                                                                              cutoff * x / 2.0f);
+    // Hann window
+    const float window = 0.5f - 0.5f * cosf(kEthervoxAudioTwoPi * (float)i / (float)(tap_count - 1));
+    taps[i] = sinc * cutoff * window;
+    sum += taps[i];
+  }
+
+  // Normalize to unity DC gain
+  for (uint32_t i = 0; i < tap_count; i++) {
+    taps[i] /= sum;
+  }
+}
+
+// Rate conversion: integer-ratio decimation goes through an anti-alias FIR
+// (the 48 kHz -> 16 kHz USB mic case); any other ratio falls back to linear
+// interpolation, which is adequate for the small corrections it is used for.
+int ethervox_audio_resample(const float* input, uint32_t input_count, uint32_t input_rate,
+                            float* output, uint32_t output_capacity, uint32_t* output_count,
+                            uint32_t output_rate) {
+  if (!input || !output || !output_count || input_rate == 0 || output_rate == 0) {
+    return -1;
+  }
+
+  if (input_rate == output_rate) {
+    if (input_count > output_capacity) {
+      return -1;
+    }
+    memcpy(output, input, input_count * sizeof(float));
+    *output_count = input_count;
+    return 0;
+  }
+
+  if (input_rate > output_rate && input_rate % output_rate == 0) {
+    const uint32_t factor = input_rate / output_rate;
+    const uint32_t out_samples = input_count / factor;
+    if (out_samples > output_capacity) {
+      return -1;
+    }
+
+    float taps[kEthervoxAudioResampleTaps];
+    const uint32_t tap_count = kEthervoxAudioResampleTaps;
+    audio_resample_design_fir(taps, tap_count, kEthervoxAudioResampleCutoff * 2.0f /
+                                                   (float)factor);
+
+    const int32_t half = (int32_t)tap_count / 2;
+    for (uint32_t n = 0; n < out_samples; n++) {
+      float acc = 0.0f;
+      const int32_t base = (int32_t)(n * factor);
+      for (uint32_t k = 0; k < tap_count; k++) {
+        int32_t idx = base + (int32_t)k - half;
+        if (idx < 0) {
+          idx = 0;
+        } else if (idx >= (int32_t)input_count) {
+          idx = (int32_t)input_count - 1;
+        }
+        acc += input[idx] * taps[k];
+      }
+      output[n] = acc;
+    }
+
+    *output_count = out_samples;
+    return 0;
+  }
+
+  // Generic ratio: linear interpolation
+  const float step = (float)input_rate / (float)output_rate;
+  const uint32_t out_samples = (uint32_t)((float)input_count / step);
+  if (out_samples > output_capacity) {
+    return -1;
+  }
+
+  for (uint32_t n = 0; n < out_samples; n++) {
+    const float pos = (float)n * step;
+    const uint32_t idx = (uint32_t)pos;
+    const float frac = pos - (float)idx;
+    const float a = input[idx];
+    const float b = (idx + 1 < input_count) ? input[idx + 1] : a;
+    output[n] = a + (b - a) * frac;
+  }
+
+  *output_count = out_samples;
+  return 0;
+}
+
+// One-shot normalization of a raw capture buffer (device-rate int16 PCM, size
+// in bytes) to the 16 kHz float stream STT and wake word expect
+int ethervox_audio_capture_to_float(const ethervox_audio_buffer_t* capture, uint32_t capture_rate,
+                                    float* output, uint32_t output_capacity,
+                                    uint32_t* output_count) {
+  if (!capture || !capture->data || !output || !output_count) {
+    return -1;
+  }
+
+  const int16_t* samples = (const int16_t*)capture->data;
+  const uint32_t sample_count = capture->size / sizeof(int16_t);
+
+  if (capture_rate == ETHERVOX_AUDIO_SAMPLE_RATE) {
+    if (sample_count > output_capacity) {
+      return -1;
+    }
+    ethervox_audio_convert_int16_to_float(samples, output, sample_count);
+    *output_count = sample_count;
+    return 0;
+  }
+
+  // Convert in chunks through a stack scratch so arbitrary buffer sizes do
+  // not force a heap allocation in the capture path
+  float scratch[ETHERVOX_AUDIO_BUFFER_SIZE];
+  if (sample_count <= ETHERVOX_AUDIO_BUFFER_SIZE) {
+    ethervox_audio_convert_int16_to_float(samples, scratch, sample_count);
+    return ethervox_audio_resample(scratch, sample_count, capture_rate, output, output_capacity,
+                                   output_count, ETHERVOX_AUDIO_SAMPLE_RATE);
+  }
+
+  uint32_t produced_total = 0;
+  for (uint32_t offset = 0; offset < sample_count; offset += ETHERVOX_AUDIO_BUFFER_SIZE) {
+    const uint32_t chunk = (sample_count - offset < ETHERVOX_AUDIO_BUFFER_SIZE)
+                               ? sample_count - offset
+                               : ETHERVOX_AUDIO_BUFFER_SIZE;
+    uint32_t produced = 0;
+    ethervox_audio_convert_int16_to_float(samples + offset, scratch, chunk);
+    if (ethervox_audio_resample(scratch, chunk, capture_rate, output + produced_total,
+                                output_capacity - produced_total, &produced,
+                                ETHERVOX_AUDIO_SAMPLE_RATE) != 0) {
+      return -1;
+    }
+    produced_total += produced;
+  }
+
+  *output_count = produced_total;
+  return 0;
+}
+
+// Incremental language identification.
+//
+// Three cheap phonotactic features per 10 ms frame — zero-crossing rate
+// (fricative/vowel balance), spectral tilt (high-band energy share) and
+// frame-to-frame energy modulation (syllable rhythm) — scored against
+// per-language Gaussian profiles. Scores accumulate across frames and the
+// detector decides as soon as the leading language's posterior clears the
+// threshold, so routing typically settles well inside the 500 ms budget.
+// The profiles are coarse first-order approximations (vowel-rich
+// syllable-timed Spanish sits low on ZCR with regular modulation,
+// stress-timed English in the middle, Mandarin higher on tilt); they pick
+// the right STT path, not transcribe.
+
+static const uint32_t kEthervoxLangIdFrameSamples = 160;  // 10 ms at 16 kHz
+static const uint32_t kEthervoxLangIdMaxSamples = 8000;   // Decide within 500 ms
+static const uint32_t kEthervoxLangIdMinFrames = 20;      // 200 ms before early exit
+static const float kEthervoxLangIdConfidenceThreshold = 0.80f;
+static const float kEthervoxLangIdSharpness = 3.0f;  // Softmax temperature
+
+typedef struct {
+  const char* code;
+  float zcr_mean, zcr_sd;
+  float tilt_mean, tilt_sd;
+  float mod_mean, mod_sd;
+} ethervox_langid_profile_t;
+
+// Profiles exist for the languages the dialogue engine can answer in
+static const ethervox_langid_profile_t kEthervoxLangIdProfiles[] = {
+    {"en", 0.16f, 0.08f, 0.45f, 0.18f, 0.50f, 0.25f},
+    {"es", 0.11f, 0.06f, 0.38f, 0.15f, 0.65f, 0.20f},
+    {"zh", 0.14f, 0.07f, 0.52f, 0.20f, 0.55f, 0.20f},
+};
+#define ETHERVOX_LANGID_PROFILE_COUNT \
+  ((uint32_t)(sizeof(kEthervoxLangIdProfiles) / sizeof(kEthervoxLangIdProfiles[0])))
+
+static float langid_gaussian_loglik(float value, float mean, float sd) {
+  const float z = (value - mean) / sd;
+  return -0.5f * z * z;
+}
+
+static void langid_score_frame(ethervox_language_detector_t* detector, const float* frame,
+                               uint32_t count) {
+  uint32_t crossings = 0;
+  float energy = 0.0f;
+  float diff_energy = 0.0f;
+
+  for (uint32_t i = 1; i < count; i++) {
+    if ((frame[i] >= 0.0f) != (frame[i - 1] >= 0.0f)) {
+      crossings++;
+    }
+    energy += frame[i] * frame[i];
+    const float d = frame[i] - frame[i - 1];
+    diff_energy += d * d;
+  }
+
+  if (energy < 1e-6f) {
+    return;  // Silence carries no language evidence
+  }
+
+  const float zcr = (float)crossings / (float)count;
+  const float tilt = diff_energy / (diff_energy + energy);  // 0..1 high-band share
+  const float modulation =
+      (detector->prev_energy > 0.0f)
+          ? fabsf(energy - detector->prev_energy) / (energy + detector->prev_energy)
+          : 0.0f;
+  detector->prev_energy = energy;
+
+  for (uint32_t lang = 0; lang < ETHERVOX_LANGID_PROFILE_COUNT; lang++) {
+    const ethervox_langid_profile_t* p = &kEthervoxLangIdProfiles[lang];
+    detector->scores[lang] += langid_gaussian_loglik(zcr, p->zcr_mean, p->zcr_sd) +
+                              langid_gaussian_loglik(tilt, p->tilt_mean, p->tilt_sd) +
+                              langid_gaussian_loglik(modulation, p->mod_mean, p->mod_sd);
+  }
+  detector->frames_seen++;
+}
+
+// Posterior of the leading language from the accumulated scores
+static uint32_t langid_posterior(const ethervox_language_detector_t* detector,
+                                 float* confidence) {
+  uint32_t best = 0;
+  for (uint32_t lang = 1; lang < ETHERVOX_LANGID_PROFILE_COUNT; lang++) {
+    if (detector->scores[lang] > detector->scores[best]) {
+      best = lang;
+    }
+  }
+
+  if (detector->frames_seen == 0) {
+    *confidence = 0.0f;
+    return best;
+  }
+
+  float denominator = 0.0f;
+  for (uint32_t lang = 0; lang < ETHERVOX_LANGID_PROFILE_COUNT; lang++) {
+    const float mean_delta =
+        (detector->scores[lang] - detector->scores[best]) / (float)detector->frames_seen;
+    denominator += expf(kEthervoxLangIdSharpness * mean_delta);
+  }
+  *confidence = 1.0f / denominator;
+  return best;
+}
+
+static void langid_decide(ethervox_language_detector_t* detector) {
+  float confidence = 0.0f;
+  const uint32_t best = langid_posterior(detector, &confidence);
+  detector->decided = true;
+  detector->confidence = confidence;
+  snprintf(detector->language_code, sizeof(detector->language_code), "%s",
+           kEthervoxLangIdProfiles[best].code);
+}
+
+void ethervox_language_detector_reset(ethervox_language_detector_t* detector) {
+  if (detector) {
+    memset(detector, 0, sizeof(*detector));
+  }
+}
+
+int ethervox_language_detector_feed(ethervox_language_detector_t* detector,
+                                    const ethervox_audio_buffer_t* buffer, uint32_t sample_rate,
+                                    ethervox_language_detect_t* result) {
+  if (!detector || !buffer || !buffer->data || !result) {
+    return -1;
+  }
+  (void)sample_rate;  // Frames are fixed 10 ms-at-16 kHz windows
+
+  if (!detector->decided) {
+    for (uint32_t offset = 0; offset + kEthervoxLangIdFrameSamples <= buffer->size;
+         offset += kEthervoxLangIdFrameSamples) {
+      langid_score_frame(detector, buffer->data + offset, kEthervoxLangIdFrameSamples);
+    }
+    detector->samples_seen += buffer->size;
+
+    float confidence = 0.0f;
+    langid_posterior(detector, &confidence);
+    if ((detector->frames_seen >= kEthervoxLangIdMinFrames &&
+         confidence >= kEthervoxLangIdConfidenceThreshold) ||
+        detector->samples_seen >= kEthervoxLangIdMaxSamples) {
+      langid_decide(detector);
+    }
+  }
+
+  if (!detector->decided) {
+    return 0;
+  }
+
+  snprintf(result->language_code, sizeof(result->language_code), "%s", detector->language_code);
+  result->confidence = detector->confidence;
+  result->is_ambient = true;
+  return 1;
+}
+
+// One-shot language detection over a single buffer
 int ethervox_language_detect(const ethervox_audio_buffer_t* buffer,
                              ethervox_language_detect_t* result) {
   if (!buffer || !result) {
     return -1;
   }
 
-  // Placeholder: Simple heuristic based on audio characteristics
-  // In a real implementation, this would use ML models
-  snprintf(result->language_code, sizeof(result->language_code), "%s", "en");
-  result->confidence = kEthervoxAudioLanguageConfidenceDefault;
-  result->is_ambient = true;
+  ethervox_language_detector_t detector;
+  ethervox_language_detector_reset(&detector);
+
+  if (ethervox_language_detector_feed(&detector, buffer, 0, result) < 0) {
+    return -1;
+  }
+  if (!detector.decided) {
+    // Short clip: decide on whatever evidence we have
+    langid_decide(&detector);
+    snprintf(result->language_code, sizeof(result->language_code), "%s",
+             detector.language_code);
+    result->confidence = detector.confidence;
+    result->is_ambient = true;
+  }
 
   return 0;
 }
@@ -217,9 +694,19 @@ int ethervox_tts_synthesize(ethervox_audio_runtime_t* runtime,
     return -1;
   }
 
+  const uint64_t span_start_us = ethervox_trace_now_us();
+
   // Placeholder: Generate simple tone as audio output
   uint32_t samples = runtime->config.sample_rate * kEthervoxAudioTtsDurationSeconds;
-  output->data = (float*)malloc(samples * sizeof(float));
+
+  // Prefer a pooled slot; fall back to the heap if both slots are in flight
+  if (ethervox_audio_buffer_pool_acquire(&runtime->playback_pool, samples * sizeof(float),
+                                         output) != 0) {
+    output->data = (float*)malloc(samples * sizeof(float));
+    if (!output->data) {
+      return -1;
+    }
+  }
   output->size = samples;
   output->channels = 1;
   output->timestamp_us = 0;
@@ -233,6 +720,75 @@ int ethervox_tts_synthesize(ethervox_audio_runtime_t* runtime,
                       sinf(kEthervoxAudioTwoPi * kEthervoxAudioToneFrequencyHz * time_s);
   }
 
+  ethervox_trace_span(request->trace_id, ETHERVOX_TRACE_STAGE_TTS, span_start_us,
+                      ethervox_trace_now_us());
+  return 0;
+}
+
+// Streaming TTS synthesis (placeholder implementation). Generates the same
+// tone as ethervox_tts_synthesize() but hands it out in fixed-size chunks
+// through the callback as each is ready, reusing one playback-pool slot per
+// chunk, so downstream playback starts after the first chunk rather than
+// after the full utterance.
+int ethervox_tts_synthesize_stream(ethervox_audio_runtime_t* runtime,
+                                   const ethervox_tts_request_t* request, uint32_t chunk_samples,
+                                   ethervox_tts_chunk_callback_t on_chunk, void* user_data) {
+  if (!runtime || !request || !on_chunk) {
+    return -1;
+  }
+
+  const uint64_t span_start_us = ethervox_trace_now_us();
+  const uint32_t sample_rate = runtime->config.sample_rate;
+
+  if (chunk_samples == 0) {
+    chunk_samples = sample_rate / 10;  // 100 ms
+  }
+
+  uint32_t remaining = sample_rate * kEthervoxAudioTtsDurationSeconds;
+  const float sample_rate_f = (float)sample_rate;
+  uint64_t sample_index = 0;  // Keeps the tone phase continuous across chunks
+
+  while (remaining > 0) {
+    const uint32_t this_chunk = (remaining < chunk_samples) ? remaining : chunk_samples;
+
+    ethervox_audio_buffer_t chunk = {0};
+    bool pooled = true;
+    if (ethervox_audio_buffer_pool_acquire(&runtime->playback_pool,
+                                           this_chunk * sizeof(float), &chunk) != 0) {
+      chunk.data = (float*)malloc(this_chunk * sizeof(float));
+      if (!chunk.data) {
+        return -1;
+      }
+      pooled = false;
+    }
+    chunk.size = this_chunk;
+    chunk.channels = 1;
+    chunk.timestamp_us = (sample_index * 1000000ULL) / sample_rate;
+
+    for (uint32_t i = 0; i < this_chunk; i++) {
+      const float time_s = (float)(sample_index + i) / sample_rate_f;
+      chunk.data[i] = kEthervoxAudioToneAmplitude *
+                      sinf(kEthervoxAudioTwoPi * kEthervoxAudioToneFrequencyHz * time_s);
+    }
+
+    sample_index += this_chunk;
+    remaining -= this_chunk;
+
+    const int callback_result = on_chunk(&chunk, remaining == 0, user_data);
+
+    if (pooled) {
+      ethervox_audio_buffer_pool_release(&runtime->playback_pool, &chunk);
+    } else {
+      free(chunk.data);
+    }
+
+    if (callback_result != 0) {
+      return -1;  // Consumer aborted
+    }
+  }
+
+  ethervox_trace_span(request->trace_id, ETHERVOX_TRACE_STAGE_TTS, span_start_us,
+                      ethervox_trace_now_us());
   return 0;
 }
 
@@ -243,4 +799,28 @@ void ethervox_audio_buffer_free(ethervox_audio_buffer_t* buffer) {
     buffer->data = NULL;
     buffer->size = 0;
   }
+}
+
+// Return a capture buffer to the runtime. Ring-owned slots go back into the
+// free queue; anything else (driver fallback allocations, TTS output) is
+// heap-allocated and simply freed.
+void ethervox_audio_buffer_recycle(ethervox_audio_runtime_t* runtime,
+                                   ethervox_audio_buffer_t* buffer) {
+  if (!buffer || !buffer->data) {
+    return;
+  }
+
+  if (runtime && audio_capture_ring_owns(&runtime->capture_ring, buffer->data)) {
+    audio_capture_ring_release(&runtime->capture_ring, (const int16_t*)buffer->data);
+    buffer->data = NULL;
+    buffer->size = 0;
+    return;
+  }
+
+  if (runtime && ethervox_audio_buffer_pool_owns(&runtime->playback_pool, buffer->data)) {
+    ethervox_audio_buffer_pool_release(&runtime->playback_pool, buffer);
+    return;
+  }
+
+  ethervox_audio_buffer_free(buffer);
 }
\ No newline at end of file
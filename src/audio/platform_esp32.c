@@ -22,7 +22,10 @@
 #include "driver/i2s_std.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "ethervox/wake_word.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/stream_buffer.h"
 #include "freertos/task.h"
 
 static const char* TAG = "ESP32_AUDIO";
@@ -37,11 +40,58 @@ static const char* TAG = "ESP32_AUDIO";
 #define I2S_WS_IO 25
 #define I2S_DATA_IN_IO 33
 
+// Dual-core pipeline: capture on core 0, wake-word processing on core 1,
+// coupled by a stream buffer so a slow detection pass never stalls I2S reads
+#define DUAL_CORE_CAPTURE_CORE 0
+#define DUAL_CORE_PROCESS_CORE 1
+#define DUAL_CORE_FRAME_SAMPLES 512  // Matches the wake detector's frame_length
+#define DUAL_CORE_FRAME_BYTES (DUAL_CORE_FRAME_SAMPLES * sizeof(int16_t))
+#define DUAL_CORE_STREAM_FRAMES 8
+#define DUAL_CORE_HIGH_WATERMARK_BYTES (6 * DUAL_CORE_FRAME_BYTES)
+#define DUAL_CORE_LOW_WATERMARK_BYTES (2 * DUAL_CORE_FRAME_BYTES)
+#define DUAL_CORE_CAPTURE_STACK 3072
+#define DUAL_CORE_PROCESS_STACK 6144
+#define DUAL_CORE_CAPTURE_PRIORITY (configMAX_PRIORITIES - 2)
+#define DUAL_CORE_PROCESS_PRIORITY (tskIDLE_PRIORITY + 2)
+
+// DMA double buffering: the I2S peripheral chains two descriptors and flips
+// between them, so it fills one buffer while the consumer reads the other
+// straight out of DMA memory — no blocking read, no intermediate copy. The
+// on_recv ISR posts each completed buffer into a two-slot mailbox; a consumed
+// buffer stays valid until the peripheral wraps back to it, one full buffer
+// period later.
+#define DMA_CAPTURE_DESCRIPTORS 2
+#define DMA_CAPTURE_FRAME_SAMPLES 512
+
+typedef struct {
+  void* data;
+  size_t bytes;
+} esp32_dma_slot_t;
+
 // Platform-specific audio data
 typedef struct {
   i2s_chan_handle_t rx_handle;
   uint8_t buffer[1024];
   size_t buffer_size;
+
+  // DMA double-buffer mailbox (ISR producer, single consumer)
+  esp32_dma_slot_t dma_slots[DMA_CAPTURE_DESCRIPTORS];
+  volatile uint32_t dma_write_pos;
+  volatile uint32_t dma_read_pos;
+  volatile uint32_t dma_overruns;  // Consumer held a buffer across a wrap
+  SemaphoreHandle_t dma_ready;
+  bool dma_capture_enabled;
+
+  // Dual-core pipeline state
+  ethervox_audio_runtime_t* runtime;
+  ethervox_wake_runtime_t* wake_runtime;
+  ethervox_wake_detected_callback_t on_wake;
+  StreamBufferHandle_t frame_stream;
+  TaskHandle_t capture_task;
+  TaskHandle_t process_task;
+  volatile bool dual_core_running;
+  volatile uint32_t frames_dropped;
+  volatile uint32_t frames_skipped;  // Detection skipped during backlog drain
 } esp32_audio_data_t;
 
 // Initialize audio runtime
@@ -58,6 +108,57 @@ int ethervox_audio_init(ethervox_audio_runtime_t* runtime, const ethervox_audio_
   ESP_LOGI(TAG, "Audio runtime initialized for ESP32");
   return 0;
 }
+// DMA completion ISR: the peripheral just finished filling one descriptor and
+// has already moved on to the other. Publish the completed buffer and wake the
+// reader. If the mailbox is full the reader is more than a whole chain behind
+// and the oldest buffer is about to be overwritten — count it as an overrun.
+static IRAM_ATTR bool esp32_audio_on_dma_recv(i2s_chan_handle_t handle,
+                                              i2s_event_data_t* event, void* user_ctx) {
+  esp32_audio_data_t* audio_data = (esp32_audio_data_t*)user_ctx;
+  (void)handle;
+
+  uint32_t pending = audio_data->dma_write_pos - audio_data->dma_read_pos;
+  if (pending >= DMA_CAPTURE_DESCRIPTORS) {
+    audio_data->dma_overruns++;
+    audio_data->dma_read_pos++;  // Drop the oldest; its memory is being reused
+  }
+
+  esp32_dma_slot_t* slot =
+      &audio_data->dma_slots[audio_data->dma_write_pos % DMA_CAPTURE_DESCRIPTORS];
+  slot->data = event->data;
+  slot->bytes = event->size;
+  audio_data->dma_write_pos++;
+
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR(audio_data->dma_ready, &woken);
+  return woken == pdTRUE;
+}
+
+// Zero-copy read: hand out the DMA descriptor buffer the peripheral just
+// completed. The returned samples are raw int16 PCM (cast through float* as
+// elsewhere in this driver) and remain valid until the chain wraps — consume
+// before the next frame period ends.
+static int esp32_audio_read_dma(esp32_audio_data_t* audio_data,
+                                ethervox_audio_buffer_t* buffer) {
+  if (xSemaphoreTake(audio_data->dma_ready, portMAX_DELAY) != pdTRUE) {
+    return -1;
+  }
+
+  if (audio_data->dma_write_pos == audio_data->dma_read_pos) {
+    return -1;  // Raced with an overrun drop in the ISR
+  }
+
+  esp32_dma_slot_t* slot =
+      &audio_data->dma_slots[audio_data->dma_read_pos % DMA_CAPTURE_DESCRIPTORS];
+  buffer->data = (float*)slot->data;
+  buffer->size = slot->bytes;
+  buffer->timestamp_us = esp_timer_get_time();
+  buffer->channels = I2S_CHANNEL_NUM;
+  audio_data->dma_read_pos++;
+
+  return 0;
+}
+
 // Start audio capture
 int ethervox_audio_start_capture(ethervox_audio_runtime_t* runtime) {
   if (!runtime || !runtime->is_initialized)
@@ -72,10 +173,14 @@ int ethervox_audio_start_capture(ethervox_audio_runtime_t* runtime) {
     return -1;
   }
 
+  memset(audio_data, 0, sizeof(esp32_audio_data_t));
   audio_data->buffer_size = sizeof(audio_data->buffer);
 
-  // Configure I2S channel
+  // Configure I2S channel with a two-descriptor DMA chain sized to the wake
+  // detector's frame length, so each completed descriptor is one frame
   i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+  chan_cfg.dma_desc_num = DMA_CAPTURE_DESCRIPTORS;
+  chan_cfg.dma_frame_num = DMA_CAPTURE_FRAME_SAMPLES;
 
   esp_err_t ret = i2s_new_channel(&chan_cfg, NULL, &audio_data->rx_handle);
   if (ret != ESP_OK) {
@@ -112,9 +217,27 @@ int ethervox_audio_start_capture(ethervox_audio_runtime_t* runtime) {
     return -1;
   }
 
+  // Hook the DMA completion ISR so read_audio can hand out descriptor
+  // buffers directly; falls back to blocking copies if registration fails
+  audio_data->dma_ready = xSemaphoreCreateCounting(DMA_CAPTURE_DESCRIPTORS, 0);
+  if (audio_data->dma_ready) {
+    i2s_event_callbacks_t callbacks = {.on_recv = esp32_audio_on_dma_recv};
+    if (i2s_channel_register_event_callback(audio_data->rx_handle, &callbacks, audio_data) ==
+        ESP_OK) {
+      audio_data->dma_capture_enabled = true;
+    } else {
+      ESP_LOGW(TAG, "DMA capture callback unavailable; using blocking reads");
+      vSemaphoreDelete(audio_data->dma_ready);
+      audio_data->dma_ready = NULL;
+    }
+  }
+
   ret = i2s_channel_enable(audio_data->rx_handle);
   if (ret != ESP_OK) {
     ESP_LOGE(TAG, "Failed to enable I2S channel: %s", esp_err_to_name(ret));
+    if (audio_data->dma_ready) {
+      vSemaphoreDelete(audio_data->dma_ready);
+    }
     i2s_del_channel(audio_data->rx_handle);
     free(audio_data);
     return -1;
@@ -134,8 +257,17 @@ int ethervox_audio_stop_capture(ethervox_audio_runtime_t* runtime) {
 
   esp32_audio_data_t* audio_data = (esp32_audio_data_t*)runtime->platform_data;
   if (audio_data) {
+    if (audio_data->dual_core_running) {
+      ethervox_audio_esp32_stop_dual_core(runtime);
+    }
     i2s_channel_disable(audio_data->rx_handle);
     i2s_del_channel(audio_data->rx_handle);
+    if (audio_data->dma_ready) {
+      if (audio_data->dma_overruns) {
+        ESP_LOGW(TAG, "DMA capture: %u buffer overruns", (unsigned)audio_data->dma_overruns);
+      }
+      vSemaphoreDelete(audio_data->dma_ready);
+    }
     free(audio_data);
     runtime->platform_data = NULL;
   }
@@ -154,6 +286,12 @@ int ethervox_audio_read(ethervox_audio_runtime_t* runtime, ethervox_audio_buffer
   if (!audio_data)
     return -1;
 
+  // Preferred path: wait for the next completed DMA descriptor and return it
+  // without copying; the blocking read below is the fallback
+  if (audio_data->dma_capture_enabled) {
+    return esp32_audio_read_dma(audio_data, buffer);
+  }
+
   size_t bytes_read = 0;
   esp_err_t ret = i2s_channel_read(audio_data->rx_handle, audio_data->buffer,
                                    audio_data->buffer_size, &bytes_read, portMAX_DELAY);
@@ -171,6 +309,153 @@ int ethervox_audio_read(ethervox_audio_runtime_t* runtime, ethervox_audio_buffer
   return 0;
 }
 
+// Core 0: read I2S frames and push them into the stream buffer. Sends use a
+// zero block time — when the processing side falls behind and the buffer is
+// full, the frame is dropped here and counted rather than backing up into the
+// I2S DMA ring.
+static void esp32_audio_capture_task(void* arg) {
+  esp32_audio_data_t* audio_data = (esp32_audio_data_t*)arg;
+  int16_t frame[DUAL_CORE_FRAME_SAMPLES];
+
+  while (audio_data->dual_core_running) {
+    size_t bytes_read = 0;
+    esp_err_t ret = i2s_channel_read(audio_data->rx_handle, frame, sizeof(frame), &bytes_read,
+                                     pdMS_TO_TICKS(100));
+    if (ret != ESP_OK || bytes_read == 0) {
+      continue;
+    }
+
+    size_t sent = xStreamBufferSend(audio_data->frame_stream, frame, bytes_read, 0);
+    if (sent < bytes_read) {
+      audio_data->frames_dropped++;
+    }
+  }
+
+  vTaskDelete(NULL);
+}
+
+// Core 1: drain the stream buffer and run the wake detector. Above the high
+// watermark the detector is skipped so the backlog drains at copy speed;
+// detection resumes below the low watermark.
+static void esp32_audio_process_task(void* arg) {
+  esp32_audio_data_t* audio_data = (esp32_audio_data_t*)arg;
+  ethervox_audio_runtime_t* runtime = audio_data->runtime;
+  int16_t frame[DUAL_CORE_FRAME_SAMPLES];
+  bool draining = false;
+
+  while (audio_data->dual_core_running) {
+    size_t bytes = xStreamBufferReceive(audio_data->frame_stream, frame, sizeof(frame),
+                                        pdMS_TO_TICKS(100));
+    if (bytes < DUAL_CORE_FRAME_BYTES) {
+      continue;
+    }
+
+    // Raw S16 with size in bytes, the convention every driver's buffers use
+    // (ethervox_wake_process casts data to int16 and divides size by two)
+    ethervox_audio_buffer_t buffer = {
+        .data = (float*)frame,
+        .size = (uint32_t)bytes,
+        .channels = I2S_CHANNEL_NUM,
+        .timestamp_us = (uint64_t)esp_timer_get_time(),
+    };
+
+    size_t backlog = xStreamBufferBytesAvailable(audio_data->frame_stream);
+    if (backlog >= DUAL_CORE_HIGH_WATERMARK_BYTES) {
+      draining = true;
+    } else if (backlog <= DUAL_CORE_LOW_WATERMARK_BYTES) {
+      draining = false;
+    }
+
+    if (draining) {
+      audio_data->frames_skipped++;
+    } else if (audio_data->wake_runtime) {
+      ethervox_wake_result_t result;
+      if (ethervox_wake_process(audio_data->wake_runtime, &buffer, &result) == 0 &&
+          result.detected && audio_data->on_wake) {
+        audio_data->on_wake(&result, runtime->user_data);
+      }
+    }
+
+    if (runtime->on_audio_data) {
+      runtime->on_audio_data(&buffer, runtime->user_data);
+    }
+  }
+
+  vTaskDelete(NULL);
+}
+
+int ethervox_audio_esp32_start_dual_core(ethervox_audio_runtime_t* runtime,
+                                         struct ethervox_wake_runtime* wake_runtime,
+                                         ethervox_wake_detected_callback_t on_wake) {
+  if (!runtime || !runtime->is_capturing) {
+    return -1;
+  }
+
+  esp32_audio_data_t* audio_data = (esp32_audio_data_t*)runtime->platform_data;
+  if (!audio_data || audio_data->dual_core_running) {
+    return -1;
+  }
+
+  audio_data->frame_stream =
+      xStreamBufferCreate(DUAL_CORE_STREAM_FRAMES * DUAL_CORE_FRAME_BYTES, DUAL_CORE_FRAME_BYTES);
+  if (!audio_data->frame_stream) {
+    ESP_LOGE(TAG, "Failed to allocate capture stream buffer");
+    return -1;
+  }
+
+  audio_data->runtime = runtime;
+  audio_data->wake_runtime = wake_runtime;
+  audio_data->on_wake = on_wake;
+  audio_data->frames_dropped = 0;
+  audio_data->frames_skipped = 0;
+  audio_data->dual_core_running = true;
+
+  if (xTaskCreatePinnedToCore(esp32_audio_capture_task, "evx_capture", DUAL_CORE_CAPTURE_STACK,
+                              audio_data, DUAL_CORE_CAPTURE_PRIORITY, &audio_data->capture_task,
+                              DUAL_CORE_CAPTURE_CORE) != pdPASS ||
+      xTaskCreatePinnedToCore(esp32_audio_process_task, "evx_process", DUAL_CORE_PROCESS_STACK,
+                              audio_data, DUAL_CORE_PROCESS_PRIORITY, &audio_data->process_task,
+                              DUAL_CORE_PROCESS_CORE) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create dual-core audio tasks");
+    audio_data->dual_core_running = false;
+    vTaskDelay(pdMS_TO_TICKS(200));  // Let a partially created task exit
+    vStreamBufferDelete(audio_data->frame_stream);
+    audio_data->frame_stream = NULL;
+    return -1;
+  }
+
+  ESP_LOGI(TAG, "Dual-core audio pipeline started (capture=core %d, process=core %d)",
+           DUAL_CORE_CAPTURE_CORE, DUAL_CORE_PROCESS_CORE);
+  return 0;
+}
+
+int ethervox_audio_esp32_stop_dual_core(ethervox_audio_runtime_t* runtime) {
+  if (!runtime) {
+    return -1;
+  }
+
+  esp32_audio_data_t* audio_data = (esp32_audio_data_t*)runtime->platform_data;
+  if (!audio_data || !audio_data->dual_core_running) {
+    return -1;
+  }
+
+  audio_data->dual_core_running = false;
+  vTaskDelay(pdMS_TO_TICKS(200));  // Both tasks poll with 100 ms timeouts
+
+  vStreamBufferDelete(audio_data->frame_stream);
+  audio_data->frame_stream = NULL;
+  audio_data->capture_task = NULL;
+  audio_data->process_task = NULL;
+
+  if (audio_data->frames_dropped || audio_data->frames_skipped) {
+    ESP_LOGW(TAG, "Dual-core pipeline: %u frames dropped, %u detections skipped",
+             (unsigned)audio_data->frames_dropped, (unsigned)audio_data->frames_skipped);
+  }
+
+  ESP_LOGI(TAG, "Dual-core audio pipeline stopped");
+  return 0;
+}
+
 // Cleanup audio runtime
 void ethervox_audio_cleanup(ethervox_audio_runtime_t* runtime) {
   if (!runtime)
@@ -189,9 +474,10 @@ int ethervox_audio_register_platform_driver(ethervox_audio_runtime_t* runtime) {
   if (!runtime)
     return -1;
 
-  // For ESP32, we don't need to register function pointers
-  // because we directly implement the ethervox_audio_* functions
-  // The linker will resolve them automatically
+  // ESP32 implements the ethervox_audio_* entry points directly, so most
+  // driver slots stay empty; read_audio is filled in so callers using the
+  // driver interface get the zero-copy DMA path
+  runtime->driver.read_audio = ethervox_audio_read;
 
   ESP_LOGI(TAG, "ESP32 audio platform driver registered");
   return 0;
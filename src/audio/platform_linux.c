@@ -22,10 +22,12 @@
 
 #ifdef ETHERVOX_PLATFORM_LINUX
 #include <alsa/asoundlib.h>
+#include <poll.h>
 #include <stdbool.h>
 
 static const size_t kLinuxMaxDeviceCandidates = 3U;
 static const unsigned int kLinuxDefaultPeriods = 2U;
+static const int kLinuxCapturePollTimeoutMs = 1000;
 
 typedef struct {
   snd_pcm_t* pcm_capture;
@@ -33,6 +35,11 @@ typedef struct {
   snd_pcm_uframes_t buffer_frames;
   bool is_recording;
   bool is_playing;
+
+  // mmap + poll capture mode (config.use_mmap_capture)
+  bool use_mmap;
+  struct pollfd* poll_fds;
+  int poll_fd_count;
 } linux_audio_data_t;
 
 static int linux_audio_init(ethervox_audio_runtime_t* runtime,
@@ -67,6 +74,8 @@ static int linux_audio_start_capture(ethervox_audio_runtime_t* runtime) {
   candidates[candidate_count++] = "default";
   candidates[candidate_count++] = "sysdefault";
 
+  audio_data->use_mmap = runtime->config.use_mmap_capture;
+
   const char* opened_device = NULL;
   for (size_t i = 0; i < candidate_count; ++i) {
     const char* device = candidates[i];
@@ -74,7 +83,9 @@ static int linux_audio_start_capture(ethervox_audio_runtime_t* runtime) {
       continue;
     }
 
-    err = snd_pcm_open(&audio_data->pcm_capture, device, SND_PCM_STREAM_CAPTURE, 0);
+    // mmap capture polls for period completion, so the handle must not block
+    err = snd_pcm_open(&audio_data->pcm_capture, device, SND_PCM_STREAM_CAPTURE,
+                       audio_data->use_mmap ? SND_PCM_NONBLOCK : 0);
     if (err >= 0) {
       opened_device = device;
       break;
@@ -101,7 +112,23 @@ static int linux_audio_start_capture(ethervox_audio_runtime_t* runtime) {
 
   // Configure hardware parameters
   snd_pcm_hw_params_any(audio_data->pcm_capture, hw_params);
-  snd_pcm_hw_params_set_access(audio_data->pcm_capture, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED);
+
+  if (audio_data->use_mmap) {
+    err = snd_pcm_hw_params_set_access(audio_data->pcm_capture, hw_params,
+                                       SND_PCM_ACCESS_MMAP_INTERLEAVED);
+    if (err < 0) {
+      printf("ALSA: device refuses mmap access (%s), falling back to blocking reads\n",
+             snd_strerror(err));
+      audio_data->use_mmap = false;
+      // The handle was opened non-blocking for mmap polling; snd_pcm_readi
+      // must block or the -EAGAIN retry in linux_audio_read busy-spins a core
+      snd_pcm_nonblock(audio_data->pcm_capture, 0);
+    }
+  }
+  if (!audio_data->use_mmap) {
+    snd_pcm_hw_params_set_access(audio_data->pcm_capture, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED);
+  }
+
   snd_pcm_hw_params_set_format(audio_data->pcm_capture, hw_params, SND_PCM_FORMAT_S16_LE);
   snd_pcm_hw_params_set_channels(audio_data->pcm_capture, hw_params, runtime->config.channels);
 
@@ -127,6 +154,39 @@ static int linux_audio_start_capture(ethervox_audio_runtime_t* runtime) {
     return -1;
   }
 
+  if (audio_data->use_mmap) {
+    int fd_count = snd_pcm_poll_descriptors_count(audio_data->pcm_capture);
+    if (fd_count <= 0) {
+      printf("ALSA: no poll descriptors available, falling back to blocking reads\n");
+      audio_data->use_mmap = false;
+      snd_pcm_nonblock(audio_data->pcm_capture, 0);  // Same as the access fallback above
+    } else {
+      audio_data->poll_fds = (struct pollfd*)calloc((size_t)fd_count, sizeof(struct pollfd));
+      if (!audio_data->poll_fds) {
+        snd_pcm_close(audio_data->pcm_capture);
+        audio_data->pcm_capture = NULL;
+        return -1;
+      }
+      audio_data->poll_fd_count =
+          snd_pcm_poll_descriptors(audio_data->pcm_capture, audio_data->poll_fds,
+                                   (unsigned int)fd_count);
+
+      // Capture streams only produce data once started; RW mode starts
+      // implicitly on the first snd_pcm_readi()
+      err = snd_pcm_start(audio_data->pcm_capture);
+      if (err < 0) {
+        printf("Cannot start mmap capture stream: %s\n", snd_strerror(err));
+        free(audio_data->poll_fds);
+        audio_data->poll_fds = NULL;
+        audio_data->poll_fd_count = 0;
+        snd_pcm_close(audio_data->pcm_capture);
+        audio_data->pcm_capture = NULL;
+        return -1;
+      }
+      printf("ALSA: mmap + poll capture mode enabled\n");
+    }
+  }
+
   audio_data->is_recording = true;
   printf("Linux audio capture started\n");
   return 0;
@@ -140,6 +200,12 @@ static int linux_audio_stop_capture(ethervox_audio_runtime_t* runtime) {
     audio_data->pcm_capture = NULL;
   }
 
+  if (audio_data->poll_fds) {
+    free(audio_data->poll_fds);
+    audio_data->poll_fds = NULL;
+    audio_data->poll_fd_count = 0;
+  }
+
   audio_data->is_recording = false;
   printf("Linux audio capture stopped\n");
   return 0;
@@ -213,6 +279,91 @@ static uint64_t linux_get_timestamp_us(void) {
                                                         ETHERVOX_PLATFORM_US_PER_MS;
 }
 
+// Recover a capture stream after an overrun (or suspend) and restart it so
+// mmap transfers resume
+static int linux_capture_recover(linux_audio_data_t* audio_data, int err) {
+  int rc = snd_pcm_recover(audio_data->pcm_capture, err, 1);
+  if (rc < 0) {
+    printf("ALSA capture recovery failed: %s\n", snd_strerror(rc));
+    return rc;
+  }
+  return snd_pcm_start(audio_data->pcm_capture);
+}
+
+// Sleep on the device poll descriptors until at least one period is ready
+static int linux_capture_wait(linux_audio_data_t* audio_data) {
+  int rc = poll(audio_data->poll_fds, (nfds_t)audio_data->poll_fd_count,
+                kLinuxCapturePollTimeoutMs);
+  if (rc < 0) {
+    printf("ALSA capture poll failed\n");
+    return -1;
+  }
+  if (rc == 0) {
+    printf("ALSA capture poll timed out\n");
+    return -1;
+  }
+
+  unsigned short revents = 0;
+  snd_pcm_poll_descriptors_revents(audio_data->pcm_capture, audio_data->poll_fds,
+                                   (unsigned int)audio_data->poll_fd_count, &revents);
+  if (revents & POLLERR) {
+    return linux_capture_recover(audio_data, -EPIPE);
+  }
+  return 0;
+}
+
+// Zero-copy read from the kernel mmap ring into the destination buffer; the
+// calling thread sleeps between periods instead of busy-retrying -EAGAIN
+static int linux_audio_read_mmap(linux_audio_data_t* audio_data, int16_t* dest, uint32_t channels,
+                                 uint32_t frames_requested) {
+  uint32_t frames_read = 0;
+
+  while (frames_read < frames_requested) {
+    snd_pcm_sframes_t avail = snd_pcm_avail_update(audio_data->pcm_capture);
+    if (avail < 0) {
+      if (linux_capture_recover(audio_data, (int)avail) < 0) {
+        return -1;
+      }
+      continue;
+    }
+    if (avail == 0) {
+      if (linux_capture_wait(audio_data) < 0) {
+        return -1;
+      }
+      continue;
+    }
+
+    const snd_pcm_channel_area_t* areas = NULL;
+    snd_pcm_uframes_t offset = 0;
+    snd_pcm_uframes_t frames = frames_requested - frames_read;
+
+    int err = snd_pcm_mmap_begin(audio_data->pcm_capture, &areas, &offset, &frames);
+    if (err < 0) {
+      if (linux_capture_recover(audio_data, err) < 0) {
+        return -1;
+      }
+      continue;
+    }
+
+    // Interleaved S16: all channels share one area with a sample-sized step
+    const int16_t* src =
+        (const int16_t*)((const uint8_t*)areas[0].addr + areas[0].first / 8) + offset * channels;
+    memcpy(dest + (size_t)frames_read * channels, src, (size_t)frames * channels * sizeof(int16_t));
+
+    snd_pcm_sframes_t committed = snd_pcm_mmap_commit(audio_data->pcm_capture, offset, frames);
+    if (committed < 0 || (snd_pcm_uframes_t)committed != frames) {
+      if (linux_capture_recover(audio_data, committed < 0 ? (int)committed : -EPIPE) < 0) {
+        return -1;
+      }
+      continue;
+    }
+
+    frames_read += (uint32_t)committed;
+  }
+
+  return 0;
+}
+
 static int linux_audio_read(ethervox_audio_runtime_t* runtime, ethervox_audio_buffer_t* buffer) {
   if (!runtime || !buffer || !runtime->platform_data) {
     return -1;
@@ -228,29 +379,54 @@ static int linux_audio_read(ethervox_audio_runtime_t* runtime, ethervox_audio_bu
   const size_t samples_total = (size_t)frames_requested * channels;
   const size_t bytes_total = samples_total * sizeof(int16_t);
 
-  int16_t* capture_buffer = (int16_t*)malloc(bytes_total);
+  // Steady-state capture fills a pre-allocated ring slot; malloc is only the
+  // fallback when every slot is still in flight downstream.
+  bool from_ring = true;
+  int16_t* capture_buffer = ethervox_audio_capture_ring_acquire(&runtime->capture_ring);
   if (!capture_buffer) {
-    return -1;
+    capture_buffer = (int16_t*)malloc(bytes_total);
+    if (!capture_buffer) {
+      return -1;
+    }
+    from_ring = false;
   }
 
   uint32_t frames_read = 0;
-  while (frames_read < frames_requested) {
-    snd_pcm_sframes_t rc =
-        snd_pcm_readi(audio_data->pcm_capture, capture_buffer + (size_t)frames_read * channels,
-                      frames_requested - frames_read);
-
-    if (rc == -EPIPE) {
-      snd_pcm_prepare(audio_data->pcm_capture);
-      continue;
-    } else if (rc == -EAGAIN) {
-      continue;
-    } else if (rc < 0) {
-      printf("ALSA capture error: %s\n", snd_strerror((int)rc));
-      free(capture_buffer);
+  if (audio_data->use_mmap) {
+    if (linux_audio_read_mmap(audio_data, capture_buffer, channels, frames_requested) != 0) {
+      if (from_ring) {
+        ethervox_audio_buffer_t failed = {.data = (float*)capture_buffer};
+        ethervox_audio_buffer_recycle(runtime, &failed);
+      } else {
+        free(capture_buffer);
+      }
       return -1;
     }
-
-    frames_read += (uint32_t)rc;
+    frames_read = frames_requested;
+  } else {
+    while (frames_read < frames_requested) {
+      snd_pcm_sframes_t rc =
+          snd_pcm_readi(audio_data->pcm_capture, capture_buffer + (size_t)frames_read * channels,
+                        frames_requested - frames_read);
+
+      if (rc == -EPIPE) {
+        snd_pcm_prepare(audio_data->pcm_capture);
+        continue;
+      } else if (rc == -EAGAIN) {
+        continue;
+      } else if (rc < 0) {
+        printf("ALSA capture error: %s\n", snd_strerror((int)rc));
+        if (from_ring) {
+          ethervox_audio_buffer_t failed = {.data = (float*)capture_buffer};
+          ethervox_audio_buffer_recycle(runtime, &failed);
+        } else {
+          free(capture_buffer);
+        }
+        return -1;
+      }
+
+      frames_read += (uint32_t)rc;
+    }
   }
 
   buffer->data = (float*)capture_buffer;
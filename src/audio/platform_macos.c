@@ -1,6 +1,6 @@
 /**
  * @file platform_macos.c
- * @brief macOS-specific audio platform implementation for EthervoxAI (stub)
+ * @brief macOS-specific audio platform implementation for EthervoxAI
  *
  * Copyright (c) 2024-2025 EthervoxAI Team
  *
@@ -17,17 +17,118 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "ethervox/audio.h"
 
 #ifdef ETHERVOX_PLATFORM_MACOS
 
+#include <AudioToolbox/AudioToolbox.h>
+#include <AudioUnit/AudioUnit.h>
+#include <CoreAudio/CoreAudio.h>
+#include <pthread.h>
+
+// AUHAL capture: the CoreAudio server thread pushes each IO cycle's samples
+// through the input callback, which renders directly into a pre-allocated
+// capture ring slot — no polling thread and no staging copy. Filled slots are
+// handed to ethervox_audio_read() through a small SPSC queue; the consumer
+// wakes on a condition variable instead of spinning.
+
+// Preprocessor constant so the struct below can size its array with it
+#define MACOS_FILLED_QUEUE_SLOTS 8U
+static const uint64_t kMacosReadTimeoutNs = 200000000ULL;  // 200 ms
+
+typedef struct {
+  int16_t* data;
+  uint32_t bytes;
+  uint64_t timestamp_us;
+} macos_filled_slot_t;
+
 typedef struct {
   bool is_recording;
   bool is_playing;
+
+  AudioUnit input_unit;
+  bool input_unit_ready;
+  uint32_t channels;
+  uint32_t overruns;  // IO cycles dropped because every ring slot was in flight
+
+  // Filled-slot queue: audio thread produces, ethervox_audio_read() consumes
+  macos_filled_slot_t filled[MACOS_FILLED_QUEUE_SLOTS];
+  uint32_t filled_write_pos;
+  uint32_t filled_read_pos;
+  pthread_mutex_t filled_lock;
+  pthread_cond_t filled_cond;
 } macos_audio_state_t;
 
+static uint64_t macos_get_timestamp_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+// Runs on the CoreAudio server thread once per IO cycle. Renders the cycle's
+// input straight into a capture ring slot and queues it for the reader; when
+// the ring is exhausted the cycle is dropped and counted rather than blocking
+// the audio thread.
+static OSStatus macos_input_callback(void* user_data, AudioUnitRenderActionFlags* action_flags,
+                                     const AudioTimeStamp* timestamp, UInt32 bus,
+                                     UInt32 frame_count, AudioBufferList* unused) {
+  ethervox_audio_runtime_t* runtime = (ethervox_audio_runtime_t*)user_data;
+  macos_audio_state_t* state = (macos_audio_state_t*)runtime->platform_data;
+  (void)unused;
+
+  int16_t* slot = ethervox_audio_capture_ring_acquire(&runtime->capture_ring);
+  if (!slot) {
+    state->overruns++;
+    return noErr;
+  }
+
+  // The BufferFrameSize request at init is best-effort: a device that keeps a
+  // larger IO cycle would otherwise make AudioUnitRender overflow the slot
+  const uint32_t slot_samples = runtime->config.buffer_size * runtime->config.channels;
+  if (frame_count * state->channels > slot_samples) {
+    frame_count = slot_samples / state->channels;  // Never overrun a ring slot
+  }
+
+  const uint32_t bytes = frame_count * state->channels * sizeof(int16_t);
+  AudioBufferList render_list = {
+      .mNumberBuffers = 1,
+      .mBuffers = {{.mNumberChannels = state->channels, .mDataByteSize = bytes, .mData = slot}},
+  };
+
+  OSStatus status = AudioUnitRender(state->input_unit, action_flags, timestamp, bus, frame_count,
+                                    &render_list);
+  if (status != noErr) {
+    ethervox_audio_buffer_t failed = {.data = (float*)slot};
+    ethervox_audio_buffer_recycle(runtime, &failed);
+    return status;
+  }
+
+  pthread_mutex_lock(&state->filled_lock);
+  const uint32_t pending = state->filled_write_pos - state->filled_read_pos;
+  if (pending >= MACOS_FILLED_QUEUE_SLOTS) {
+    // Reader has fallen a whole queue behind; drop the oldest slot
+    macos_filled_slot_t* oldest =
+        &state->filled[state->filled_read_pos % MACOS_FILLED_QUEUE_SLOTS];
+    ethervox_audio_buffer_t dropped = {.data = (float*)oldest->data};
+    ethervox_audio_buffer_recycle(runtime, &dropped);
+    state->filled_read_pos++;
+    state->overruns++;
+  }
+
+  macos_filled_slot_t* entry = &state->filled[state->filled_write_pos % MACOS_FILLED_QUEUE_SLOTS];
+  entry->data = slot;
+  entry->bytes = render_list.mBuffers[0].mDataByteSize;
+  entry->timestamp_us = macos_get_timestamp_us();
+  state->filled_write_pos++;
+  pthread_cond_signal(&state->filled_cond);
+  pthread_mutex_unlock(&state->filled_lock);
+
+  return noErr;
+}
+
 static int macos_audio_init(ethervox_audio_runtime_t* runtime,
                             const ethervox_audio_config_t* config) {
   (void)config;
@@ -37,8 +138,92 @@ static int macos_audio_init(ethervox_audio_runtime_t* runtime,
     return -1;
   }
 
+  pthread_mutex_init(&state->filled_lock, NULL);
+  pthread_cond_init(&state->filled_cond, NULL);
+
   runtime->platform_data = state;
-  printf("macOS audio driver initialized (stub)\n");
+  printf("macOS audio driver initialized\n");
+  return 0;
+}
+
+// Bring up the AUHAL unit: input enabled on bus 1, output disabled on bus 0,
+// default input device, client format matching the runtime config, and the IO
+// buffer sized to config.buffer_size frames so latency follows the config.
+static int macos_setup_input_unit(ethervox_audio_runtime_t* runtime,
+                                  macos_audio_state_t* state) {
+  AudioComponentDescription desc = {
+      .componentType = kAudioUnitType_Output,
+      .componentSubType = kAudioUnitSubType_HALOutput,
+      .componentManufacturer = kAudioUnitManufacturer_Apple,
+  };
+
+  AudioComponent component = AudioComponentFindNext(NULL, &desc);
+  if (!component || AudioComponentInstanceNew(component, &state->input_unit) != noErr) {
+    return -1;
+  }
+
+  UInt32 enable = 1;
+  UInt32 disable = 0;
+  if (AudioUnitSetProperty(state->input_unit, kAudioOutputUnitProperty_EnableIO,
+                           kAudioUnitScope_Input, 1, &enable, sizeof(enable)) != noErr ||
+      AudioUnitSetProperty(state->input_unit, kAudioOutputUnitProperty_EnableIO,
+                           kAudioUnitScope_Output, 0, &disable, sizeof(disable)) != noErr) {
+    return -1;
+  }
+
+  AudioDeviceID input_device = kAudioObjectUnknown;
+  UInt32 device_size = sizeof(input_device);
+  AudioObjectPropertyAddress default_input = {
+      .mSelector = kAudioHardwarePropertyDefaultInputDevice,
+      .mScope = kAudioObjectPropertyScopeGlobal,
+      .mElement = kAudioObjectPropertyElementMain,
+  };
+  if (AudioObjectGetPropertyData(kAudioObjectSystemObject, &default_input, 0, NULL, &device_size,
+                                 &input_device) != noErr ||
+      AudioUnitSetProperty(state->input_unit, kAudioOutputUnitProperty_CurrentDevice,
+                           kAudioUnitScope_Global, 0, &input_device,
+                           sizeof(input_device)) != noErr) {
+    return -1;
+  }
+
+  // Client format: interleaved int16 at the configured rate, so ring slots
+  // carry the same raw PCM layout as every other platform driver
+  const uint32_t channels = runtime->config.channels;
+  AudioStreamBasicDescription format = {
+      .mSampleRate = (Float64)runtime->config.sample_rate,
+      .mFormatID = kAudioFormatLinearPCM,
+      .mFormatFlags = kAudioFormatFlagIsSignedInteger | kAudioFormatFlagIsPacked,
+      .mFramesPerPacket = 1,
+      .mChannelsPerFrame = channels,
+      .mBitsPerChannel = 16,
+      .mBytesPerFrame = channels * sizeof(int16_t),
+      .mBytesPerPacket = channels * sizeof(int16_t),
+  };
+  if (AudioUnitSetProperty(state->input_unit, kAudioUnitProperty_StreamFormat,
+                           kAudioUnitScope_Output, 1, &format, sizeof(format)) != noErr) {
+    return -1;
+  }
+
+  // Honor the configured buffer size as the IO cycle length
+  UInt32 io_frames = runtime->config.buffer_size;
+  AudioUnitSetProperty(state->input_unit, kAudioDevicePropertyBufferFrameSize,
+                       kAudioUnitScope_Global, 0, &io_frames, sizeof(io_frames));
+
+  AURenderCallbackStruct callback = {
+      .inputProc = macos_input_callback,
+      .inputProcRefCon = runtime,
+  };
+  if (AudioUnitSetProperty(state->input_unit, kAudioOutputUnitProperty_SetInputCallback,
+                           kAudioUnitScope_Global, 0, &callback, sizeof(callback)) != noErr) {
+    return -1;
+  }
+
+  if (AudioUnitInitialize(state->input_unit) != noErr) {
+    return -1;
+  }
+
+  state->channels = channels;
+  state->input_unit_ready = true;
   return 0;
 }
 
@@ -48,9 +233,26 @@ static int macos_audio_start_capture(ethervox_audio_runtime_t* runtime) {
     return -1;
   }
 
+  if (!state->input_unit_ready) {
+    if (macos_setup_input_unit(runtime, state) != 0) {
+      printf("Failed to set up AUHAL capture unit\n");
+      if (state->input_unit) {
+        AudioComponentInstanceDispose(state->input_unit);
+        state->input_unit = NULL;
+      }
+      return -1;
+    }
+  }
+
+  if (AudioOutputUnitStart(state->input_unit) != noErr) {
+    printf("Failed to start AUHAL capture unit\n");
+    return -1;
+  }
+
   state->is_recording = true;
-  printf("macOS audio capture requested (not implemented)\n");
-  return -1;
+  printf("macOS audio capture started (AUHAL, %u-frame IO cycles)\n",
+         runtime->config.buffer_size);
+  return 0;
 }
 
 static int macos_audio_stop_capture(ethervox_audio_runtime_t* runtime) {
@@ -59,6 +261,13 @@ static int macos_audio_stop_capture(ethervox_audio_runtime_t* runtime) {
     return -1;
   }
 
+  if (state->input_unit_ready) {
+    AudioOutputUnitStop(state->input_unit);
+  }
+  if (state->overruns) {
+    printf("macOS audio capture: %u IO cycles dropped\n", state->overruns);
+  }
+
   state->is_recording = false;
   return 0;
 }
@@ -84,10 +293,42 @@ static int macos_audio_stop_playback(ethervox_audio_runtime_t* runtime) {
   return 0;
 }
 
+// Block until the audio thread queues the next filled ring slot; the slot is
+// handed to the caller as-is and returned via ethervox_audio_buffer_recycle()
 static int macos_audio_read(ethervox_audio_runtime_t* runtime, ethervox_audio_buffer_t* buffer) {
-  (void)runtime;
-  (void)buffer;
-  return -1;
+  if (!runtime || !buffer || !runtime->platform_data) {
+    return -1;
+  }
+
+  macos_audio_state_t* state = (macos_audio_state_t*)runtime->platform_data;
+  if (!state->is_recording) {
+    return -1;
+  }
+
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_nsec += (long)(kMacosReadTimeoutNs % 1000000000ULL);
+  deadline.tv_sec += (time_t)(kMacosReadTimeoutNs / 1000000000ULL) + deadline.tv_nsec / 1000000000L;
+  deadline.tv_nsec %= 1000000000L;
+
+  pthread_mutex_lock(&state->filled_lock);
+  while (state->filled_write_pos == state->filled_read_pos) {
+    if (pthread_cond_timedwait(&state->filled_cond, &state->filled_lock, &deadline) != 0) {
+      pthread_mutex_unlock(&state->filled_lock);
+      return -1;
+    }
+  }
+
+  macos_filled_slot_t entry = state->filled[state->filled_read_pos % MACOS_FILLED_QUEUE_SLOTS];
+  state->filled_read_pos++;
+  pthread_mutex_unlock(&state->filled_lock);
+
+  buffer->data = (float*)entry.data;
+  buffer->size = entry.bytes;
+  buffer->channels = state->channels;
+  buffer->timestamp_us = entry.timestamp_us;
+
+  return 0;
 }
 
 static void macos_audio_cleanup(ethervox_audio_runtime_t* runtime) {
@@ -95,6 +336,14 @@ static void macos_audio_cleanup(ethervox_audio_runtime_t* runtime) {
     return;
   }
 
+  macos_audio_state_t* state = (macos_audio_state_t*)runtime->platform_data;
+  if (state->input_unit_ready) {
+    AudioUnitUninitialize(state->input_unit);
+    AudioComponentInstanceDispose(state->input_unit);
+  }
+  pthread_mutex_destroy(&state->filled_lock);
+  pthread_cond_destroy(&state->filled_cond);
+
   free(runtime->platform_data);
   runtime->platform_data = NULL;
   printf("macOS audio driver cleaned up\n");
@@ -0,0 +1,118 @@
+/**
+ * @file audio_buffer.c
+ * @brief Fixed-capacity audio buffer pool for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ethervox/audio_buffer.h"
+
+int ethervox_audio_buffer_pool_init(ethervox_audio_buffer_pool_t* pool, uint32_t slot_count,
+                                    uint32_t slot_bytes) {
+  if (!pool || slot_count == 0 || slot_bytes == 0) {
+    return -1;
+  }
+
+  memset(pool, 0, sizeof(ethervox_audio_buffer_pool_t));
+
+  pool->slab = (uint8_t*)malloc((size_t)slot_count * slot_bytes);
+  if (!pool->slab) {
+    return -1;
+  }
+
+  pool->in_use = (bool*)calloc(slot_count, sizeof(bool));
+  if (!pool->in_use) {
+    free(pool->slab);
+    pool->slab = NULL;
+    return -1;
+  }
+
+  pool->slot_count = slot_count;
+  pool->slot_bytes = slot_bytes;
+  pool->is_initialized = true;
+  return 0;
+}
+
+int ethervox_audio_buffer_pool_acquire(ethervox_audio_buffer_pool_t* pool, uint32_t bytes,
+                                       ethervox_audio_buffer_t* buffer) {
+  if (!pool || !pool->is_initialized || !buffer || bytes == 0 || bytes > pool->slot_bytes) {
+    return -1;
+  }
+
+  for (uint32_t slot = 0; slot < pool->slot_count; slot++) {
+    if (pool->in_use[slot]) {
+      continue;
+    }
+
+    pool->in_use[slot] = true;
+
+    uint32_t active = 0;
+    for (uint32_t i = 0; i < pool->slot_count; i++) {
+      if (pool->in_use[i]) {
+        active++;
+      }
+    }
+    if (active > pool->peak_in_use) {
+      pool->peak_in_use = active;
+    }
+
+    buffer->data = (float*)(pool->slab + (size_t)slot * pool->slot_bytes);
+    buffer->size = bytes;
+    buffer->channels = 1;
+    buffer->timestamp_us = 0;
+    return 0;
+  }
+
+  return -1;  // All slots in flight; caller decides how to degrade
+}
+
+bool ethervox_audio_buffer_pool_owns(const ethervox_audio_buffer_pool_t* pool, const float* data) {
+  if (!pool || !pool->slab || !data) {
+    return false;
+  }
+
+  const uint8_t* bytes = (const uint8_t*)data;
+  return bytes >= pool->slab && bytes < pool->slab + (size_t)pool->slot_count * pool->slot_bytes;
+}
+
+void ethervox_audio_buffer_pool_release(ethervox_audio_buffer_pool_t* pool,
+                                        ethervox_audio_buffer_t* buffer) {
+  if (!buffer || !buffer->data) {
+    return;
+  }
+
+  if (pool && ethervox_audio_buffer_pool_owns(pool, buffer->data)) {
+    const uint32_t slot =
+        (uint32_t)(((const uint8_t*)buffer->data - pool->slab) / pool->slot_bytes);
+    pool->in_use[slot] = false;
+    buffer->data = NULL;
+    buffer->size = 0;
+    return;
+  }
+
+  // Heap fallback buffers flow through the same release path
+  ethervox_audio_buffer_free(buffer);
+}
+
+void ethervox_audio_buffer_pool_cleanup(ethervox_audio_buffer_pool_t* pool) {
+  if (!pool) {
+    return;
+  }
+
+  free(pool->slab);
+  free(pool->in_use);
+  memset(pool, 0, sizeof(ethervox_audio_buffer_pool_t));
+}
@@ -0,0 +1,409 @@
+/**
+ * @file echo_cancel.c
+ * @brief Partitioned-block frequency-domain acoustic echo canceller for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ethervox/echo_cancel.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Partitioned-block frequency-domain adaptive filter (overlap-save). The
+// echo path is split into partition_count blocks; each block's contribution
+// is one per-bin complex multiply of the stored reference spectrum with its
+// weight, so the whole tail costs O(P*N) multiply-adds plus three FFTs per
+// block instead of an O(tail) convolution per sample. Weights adapt with
+// frequency-domain NLMS: the step is normalized per bin by the smoothed
+// reference power, which keeps adaptation stable through level changes and
+// limits divergence during double-talk — exactly the barge-in case. The
+// gradient constraint (two extra FFTs per partition per block) is skipped;
+// unconstrained FDAF is the usual embedded tradeoff and behaves well while
+// the true echo tail fits inside the modeled one.
+
+static const uint32_t kEthervoxAecDefaultBlockSize = 256;
+static const uint32_t kEthervoxAecDefaultPartitions = 12;  // 192 ms at 16 kHz
+static const uint32_t kEthervoxAecRefFifoBlocks = 16;
+static const float kEthervoxAecDefaultLearningRate = 0.5f;
+static const float kEthervoxAecPowerSmoothing = 0.7f;
+static const float kEthervoxAecRegularization = 1e-6f;
+static const float kEthervoxAecAdaptThreshold = 1e-8f;  // Mean-square per sample
+
+// --- Radix-2 FFT on planar re/im arrays ------------------------------------
+
+static void aec_fft(const ethervox_echo_cancel_runtime_t* runtime, float* re, float* im,
+                    bool inverse) {
+  const uint32_t n = runtime->fft_size;
+
+  for (uint32_t i = 0; i < n; i++) {
+    const uint32_t j = runtime->bit_reverse[i];
+    if (j > i) {
+      float tmp = re[i];
+      re[i] = re[j];
+      re[j] = tmp;
+      tmp = im[i];
+      im[i] = im[j];
+      im[j] = tmp;
+    }
+  }
+
+  for (uint32_t len = 2; len <= n; len <<= 1) {
+    const uint32_t half = len >> 1;
+    const uint32_t step = n / len;
+    for (uint32_t base = 0; base < n; base += len) {
+      for (uint32_t k = 0; k < half; k++) {
+        const float wr = runtime->twiddle_cos[k * step];
+        const float wi = inverse ? runtime->twiddle_sin[k * step]
+                                 : -runtime->twiddle_sin[k * step];
+        const uint32_t a = base + k;
+        const uint32_t b = a + half;
+        const float tr = re[b] * wr - im[b] * wi;
+        const float ti = re[b] * wi + im[b] * wr;
+        re[b] = re[a] - tr;
+        im[b] = im[a] - ti;
+        re[a] += tr;
+        im[a] += ti;
+      }
+    }
+  }
+
+  if (inverse) {
+    const float scale = 1.0f / (float)n;
+    for (uint32_t i = 0; i < n; i++) {
+      re[i] *= scale;
+      im[i] *= scale;
+    }
+  }
+}
+
+// --- Vectorized per-bin complex arithmetic ---------------------------------
+
+// acc += w * x over n bins; planar storage keeps this a straight multiply-add
+// stream on SSE2/NEON with no shuffles
+static void aec_complex_mac(float* acc_re, float* acc_im, const float* w_re, const float* w_im,
+                            const float* x_re, const float* x_im, uint32_t n) {
+  uint32_t i = 0;
+
+#if defined(__SSE2__)
+  for (; i + 4 <= n; i += 4) {
+    const __m128 wr = _mm_loadu_ps(w_re + i);
+    const __m128 wi = _mm_loadu_ps(w_im + i);
+    const __m128 xr = _mm_loadu_ps(x_re + i);
+    const __m128 xi = _mm_loadu_ps(x_im + i);
+    _mm_storeu_ps(acc_re + i, _mm_add_ps(_mm_loadu_ps(acc_re + i),
+                                         _mm_sub_ps(_mm_mul_ps(wr, xr), _mm_mul_ps(wi, xi))));
+    _mm_storeu_ps(acc_im + i, _mm_add_ps(_mm_loadu_ps(acc_im + i),
+                                         _mm_add_ps(_mm_mul_ps(wr, xi), _mm_mul_ps(wi, xr))));
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 4 <= n; i += 4) {
+    const float32x4_t wr = vld1q_f32(w_re + i);
+    const float32x4_t wi = vld1q_f32(w_im + i);
+    const float32x4_t xr = vld1q_f32(x_re + i);
+    const float32x4_t xi = vld1q_f32(x_im + i);
+    vst1q_f32(acc_re + i,
+              vmlsq_f32(vmlaq_f32(vld1q_f32(acc_re + i), wr, xr), wi, xi));
+    vst1q_f32(acc_im + i,
+              vmlaq_f32(vmlaq_f32(vld1q_f32(acc_im + i), wr, xi), wi, xr));
+  }
+#endif
+
+  for (; i < n; i++) {
+    acc_re[i] += w_re[i] * x_re[i] - w_im[i] * x_im[i];
+    acc_im[i] += w_re[i] * x_im[i] + w_im[i] * x_re[i];
+  }
+}
+
+// w += gain * conj(x) * e per bin (the NLMS weight update)
+static void aec_weight_update(float* w_re, float* w_im, const float* x_re, const float* x_im,
+                              const float* e_re, const float* e_im, const float* gain,
+                              uint32_t n) {
+  uint32_t i = 0;
+
+#if defined(__SSE2__)
+  for (; i + 4 <= n; i += 4) {
+    const __m128 g = _mm_loadu_ps(gain + i);
+    const __m128 xr = _mm_loadu_ps(x_re + i);
+    const __m128 xi = _mm_loadu_ps(x_im + i);
+    const __m128 er = _mm_loadu_ps(e_re + i);
+    const __m128 ei = _mm_loadu_ps(e_im + i);
+    // conj(x) * e = (xr*er + xi*ei) + j(xr*ei - xi*er)
+    const __m128 gr = _mm_add_ps(_mm_mul_ps(xr, er), _mm_mul_ps(xi, ei));
+    const __m128 gi = _mm_sub_ps(_mm_mul_ps(xr, ei), _mm_mul_ps(xi, er));
+    _mm_storeu_ps(w_re + i, _mm_add_ps(_mm_loadu_ps(w_re + i), _mm_mul_ps(g, gr)));
+    _mm_storeu_ps(w_im + i, _mm_add_ps(_mm_loadu_ps(w_im + i), _mm_mul_ps(g, gi)));
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 4 <= n; i += 4) {
+    const float32x4_t g = vld1q_f32(gain + i);
+    const float32x4_t xr = vld1q_f32(x_re + i);
+    const float32x4_t xi = vld1q_f32(x_im + i);
+    const float32x4_t er = vld1q_f32(e_re + i);
+    const float32x4_t ei = vld1q_f32(e_im + i);
+    const float32x4_t gr = vmlaq_f32(vmulq_f32(xr, er), xi, ei);
+    const float32x4_t gi = vmlsq_f32(vmulq_f32(xr, ei), xi, er);
+    vst1q_f32(w_re + i, vmlaq_f32(vld1q_f32(w_re + i), g, gr));
+    vst1q_f32(w_im + i, vmlaq_f32(vld1q_f32(w_im + i), g, gi));
+  }
+#endif
+
+  for (; i < n; i++) {
+    const float gr = x_re[i] * e_re[i] + x_im[i] * e_im[i];
+    const float gi = x_re[i] * e_im[i] - x_im[i] * e_re[i];
+    w_re[i] += gain[i] * gr;
+    w_im[i] += gain[i] * gi;
+  }
+}
+
+// --- Lifecycle -------------------------------------------------------------
+
+ethervox_echo_cancel_config_t ethervox_echo_cancel_get_default_config(void) {
+  ethervox_echo_cancel_config_t config = {.sample_rate = ETHERVOX_AUDIO_SAMPLE_RATE,
+                                          .block_size = kEthervoxAecDefaultBlockSize,
+                                          .partition_count = kEthervoxAecDefaultPartitions,
+                                          .learning_rate = kEthervoxAecDefaultLearningRate};
+  return config;
+}
+
+int ethervox_echo_cancel_init(ethervox_echo_cancel_runtime_t* runtime,
+                              const ethervox_echo_cancel_config_t* config) {
+  if (!runtime) {
+    return -1;
+  }
+
+  memset(runtime, 0, sizeof(ethervox_echo_cancel_runtime_t));
+  runtime->config = config ? *config : ethervox_echo_cancel_get_default_config();
+
+  const uint32_t block = runtime->config.block_size;
+  if (block == 0 || (block & (block - 1)) != 0 || runtime->config.sample_rate == 0 ||
+      runtime->config.partition_count == 0 ||
+      runtime->config.partition_count > ETHERVOX_ECHO_CANCEL_MAX_PARTITIONS ||
+      runtime->config.learning_rate <= 0.0f || runtime->config.learning_rate > 1.0f) {
+    fprintf(stderr, "Invalid echo canceller configuration\n");
+    return -1;
+  }
+
+  const uint32_t n = block * 2;
+  const uint32_t partitions = runtime->config.partition_count;
+  runtime->fft_size = n;
+
+  runtime->twiddle_cos = (float*)malloc((n / 2) * sizeof(float));
+  runtime->twiddle_sin = (float*)malloc((n / 2) * sizeof(float));
+  runtime->bit_reverse = (uint32_t*)malloc(n * sizeof(uint32_t));
+  runtime->ref_spectra_re = (float*)calloc((size_t)partitions * n, sizeof(float));
+  runtime->ref_spectra_im = (float*)calloc((size_t)partitions * n, sizeof(float));
+  runtime->weights_re = (float*)calloc((size_t)partitions * n, sizeof(float));
+  runtime->weights_im = (float*)calloc((size_t)partitions * n, sizeof(float));
+  runtime->ref_power = (float*)calloc(n, sizeof(float));
+  runtime->ref_window = (float*)calloc(n, sizeof(float));
+  runtime->ref_fifo_capacity = block * kEthervoxAecRefFifoBlocks;
+  runtime->ref_fifo = (float*)calloc(runtime->ref_fifo_capacity, sizeof(float));
+  runtime->scratch_re = (float*)malloc(n * sizeof(float));
+  runtime->scratch_im = (float*)malloc(n * sizeof(float));
+  runtime->error_re = (float*)malloc(n * sizeof(float));
+  runtime->error_im = (float*)malloc(n * sizeof(float));
+  runtime->gain = (float*)malloc(n * sizeof(float));
+
+  if (!runtime->twiddle_cos || !runtime->twiddle_sin || !runtime->bit_reverse ||
+      !runtime->ref_spectra_re || !runtime->ref_spectra_im || !runtime->weights_re ||
+      !runtime->weights_im || !runtime->ref_power || !runtime->ref_window ||
+      !runtime->ref_fifo || !runtime->scratch_re || !runtime->scratch_im ||
+      !runtime->error_re || !runtime->error_im || !runtime->gain) {
+    ethervox_echo_cancel_cleanup(runtime);
+    return -1;
+  }
+
+  for (uint32_t k = 0; k < n / 2; k++) {
+    const double angle = 2.0 * M_PI * (double)k / (double)n;
+    runtime->twiddle_cos[k] = (float)cos(angle);
+    runtime->twiddle_sin[k] = (float)sin(angle);
+  }
+
+  uint32_t bits = 0;
+  while ((1u << bits) < n) {
+    bits++;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t reversed = 0;
+    for (uint32_t b = 0; b < bits; b++) {
+      reversed |= ((i >> b) & 1u) << (bits - 1 - b);
+    }
+    runtime->bit_reverse[i] = reversed;
+  }
+
+  runtime->is_initialized = true;
+  return 0;
+}
+
+int ethervox_echo_cancel_feed_playback(ethervox_echo_cancel_runtime_t* runtime,
+                                       const float* samples, uint32_t sample_count) {
+  if (!runtime || !runtime->is_initialized || !samples) {
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < sample_count; i++) {
+    if (runtime->ref_fifo_count == runtime->ref_fifo_capacity) {
+      // Capture has fallen behind; drop the oldest reference so the newest
+      // playback stays aligned with what the mic is about to hear
+      runtime->ref_fifo_head = (runtime->ref_fifo_head + 1) % runtime->ref_fifo_capacity;
+      runtime->ref_fifo_count--;
+    }
+    const uint32_t tail =
+        (runtime->ref_fifo_head + runtime->ref_fifo_count) % runtime->ref_fifo_capacity;
+    runtime->ref_fifo[tail] = samples[i];
+    runtime->ref_fifo_count++;
+  }
+  return 0;
+}
+
+// --- Per-block filtering ---------------------------------------------------
+
+static void aec_process_block(ethervox_echo_cancel_runtime_t* runtime, float* capture) {
+  const uint32_t block = runtime->config.block_size;
+  const uint32_t n = runtime->fft_size;
+  const uint32_t partitions = runtime->config.partition_count;
+
+  // Slide the overlap-save reference window forward by one block, pulling
+  // from the playback FIFO (silence on underrun)
+  memmove(runtime->ref_window, runtime->ref_window + block, (n - block) * sizeof(float));
+  float* fresh = runtime->ref_window + (n - block);
+  float ref_energy = 0.0f;
+  for (uint32_t i = 0; i < block; i++) {
+    float sample = 0.0f;
+    if (runtime->ref_fifo_count > 0) {
+      sample = runtime->ref_fifo[runtime->ref_fifo_head];
+      runtime->ref_fifo_head = (runtime->ref_fifo_head + 1) % runtime->ref_fifo_capacity;
+      runtime->ref_fifo_count--;
+    }
+    fresh[i] = sample;
+    ref_energy += sample * sample;
+  }
+
+  // Newest reference spectrum into the partition ring
+  runtime->spectra_head = (runtime->spectra_head + 1) % partitions;
+  float* x_re = runtime->ref_spectra_re + (size_t)runtime->spectra_head * n;
+  float* x_im = runtime->ref_spectra_im + (size_t)runtime->spectra_head * n;
+  memcpy(x_re, runtime->ref_window, n * sizeof(float));
+  memset(x_im, 0, n * sizeof(float));
+  aec_fft(runtime, x_re, x_im, false);
+
+  // Echo estimate: accumulate every partition's weighted spectrum, back to
+  // time; overlap-save makes only the last block of the inverse valid
+  memset(runtime->scratch_re, 0, n * sizeof(float));
+  memset(runtime->scratch_im, 0, n * sizeof(float));
+  for (uint32_t p = 0; p < partitions; p++) {
+    const uint32_t slot = (runtime->spectra_head + partitions - p) % partitions;
+    aec_complex_mac(runtime->scratch_re, runtime->scratch_im,
+                    runtime->weights_re + (size_t)p * n, runtime->weights_im + (size_t)p * n,
+                    runtime->ref_spectra_re + (size_t)slot * n,
+                    runtime->ref_spectra_im + (size_t)slot * n, n);
+  }
+  aec_fft(runtime, runtime->scratch_re, runtime->scratch_im, true);
+
+  for (uint32_t i = 0; i < block; i++) {
+    capture[i] -= runtime->scratch_re[block + i];
+  }
+
+  // Freeze adaptation while the speaker is quiet: there is no echo to model
+  // and the update would chase mic noise
+  if (ref_energy / (float)block < kEthervoxAecAdaptThreshold) {
+    return;
+  }
+
+  // Smoothed per-bin reference power for the normalized step
+  const float smooth = kEthervoxAecPowerSmoothing;
+  const float mu = runtime->config.learning_rate;
+  for (uint32_t i = 0; i < n; i++) {
+    const float power = x_re[i] * x_re[i] + x_im[i] * x_im[i];
+    runtime->ref_power[i] = smooth * runtime->ref_power[i] + (1.0f - smooth) * power;
+    runtime->gain[i] =
+        mu / ((float)partitions * runtime->ref_power[i] + kEthervoxAecRegularization);
+  }
+
+  // Error spectrum (zero-padded first half, matching overlap-save), then the
+  // NLMS update against each stored reference partition
+  memset(runtime->error_re, 0, block * sizeof(float));
+  memcpy(runtime->error_re + block, capture, block * sizeof(float));
+  memset(runtime->error_im, 0, n * sizeof(float));
+  aec_fft(runtime, runtime->error_re, runtime->error_im, false);
+
+  for (uint32_t p = 0; p < partitions; p++) {
+    const uint32_t slot = (runtime->spectra_head + partitions - p) % partitions;
+    aec_weight_update(runtime->weights_re + (size_t)p * n, runtime->weights_im + (size_t)p * n,
+                      runtime->ref_spectra_re + (size_t)slot * n,
+                      runtime->ref_spectra_im + (size_t)slot * n, runtime->error_re,
+                      runtime->error_im, runtime->gain, n);
+  }
+}
+
+int ethervox_echo_cancel_process(ethervox_echo_cancel_runtime_t* runtime, float* capture,
+                                 uint32_t sample_count) {
+  if (!runtime || !runtime->is_initialized || !capture ||
+      sample_count % runtime->config.block_size != 0) {
+    return -1;
+  }
+
+  for (uint32_t offset = 0; offset < sample_count; offset += runtime->config.block_size) {
+    aec_process_block(runtime, capture + offset);
+  }
+  return 0;
+}
+
+void ethervox_echo_cancel_reset(ethervox_echo_cancel_runtime_t* runtime) {
+  if (!runtime || !runtime->is_initialized) {
+    return;
+  }
+
+  const uint32_t n = runtime->fft_size;
+  const uint32_t partitions = runtime->config.partition_count;
+  memset(runtime->ref_spectra_re, 0, (size_t)partitions * n * sizeof(float));
+  memset(runtime->ref_spectra_im, 0, (size_t)partitions * n * sizeof(float));
+  memset(runtime->weights_re, 0, (size_t)partitions * n * sizeof(float));
+  memset(runtime->weights_im, 0, (size_t)partitions * n * sizeof(float));
+  memset(runtime->ref_power, 0, n * sizeof(float));
+  memset(runtime->ref_window, 0, n * sizeof(float));
+  runtime->spectra_head = 0;
+  runtime->ref_fifo_head = 0;
+  runtime->ref_fifo_count = 0;
+}
+
+void ethervox_echo_cancel_cleanup(ethervox_echo_cancel_runtime_t* runtime) {
+  if (!runtime) {
+    return;
+  }
+
+  free(runtime->twiddle_cos);
+  free(runtime->twiddle_sin);
+  free(runtime->bit_reverse);
+  free(runtime->ref_spectra_re);
+  free(runtime->ref_spectra_im);
+  free(runtime->weights_re);
+  free(runtime->weights_im);
+  free(runtime->ref_power);
+  free(runtime->ref_window);
+  free(runtime->ref_fifo);
+  free(runtime->scratch_re);
+  free(runtime->scratch_im);
+  free(runtime->error_re);
+  free(runtime->error_im);
+  free(runtime->gain);
+  memset(runtime, 0, sizeof(ethervox_echo_cancel_runtime_t));
+}
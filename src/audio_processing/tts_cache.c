@@ -0,0 +1,369 @@
+/**
+ * @file tts_cache.c
+ * @brief LRU cache of synthesized TTS audio
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ethervox/tts_cache.h"
+
+static const uint32_t kTtsCacheInitialBuckets = 64;  // Power of two
+static const uint32_t kTtsCacheMaxKeyBytes = 1024;
+
+// Canonical key: the request fields that change the rendered audio. Rates
+// and pitches are rounded to two decimals so float noise doesn't split
+// otherwise identical phrases.
+static int tts_cache_build_key(const ethervox_tts_request_t* request, char* key, size_t key_size) {
+  const int written = snprintf(key, key_size, "%s|%s|%s|%.2f|%.2f",
+                               request->text ? request->text : "",
+                               request->voice_id ? request->voice_id : "",
+                               request->language_code ? request->language_code : "",
+                               (double)request->speech_rate, (double)request->pitch);
+  return (written < 0 || written >= (int)key_size) ? -1 : 0;
+}
+
+// FNV-1a, same scheme the plugin and dialogue indexes use
+static uint64_t tts_cache_hash(const char* key) {
+  uint64_t hash = 1469598103934665603ULL;
+  for (const unsigned char* p = (const unsigned char*)key; *p; p++) {
+    hash ^= *p;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+static void tts_cache_lru_unlink(ethervox_tts_cache_t* cache, ethervox_tts_cache_entry_t* entry) {
+  if (entry->lru_prev) {
+    entry->lru_prev->lru_next = entry->lru_next;
+  } else {
+    cache->lru_head = entry->lru_next;
+  }
+  if (entry->lru_next) {
+    entry->lru_next->lru_prev = entry->lru_prev;
+  } else {
+    cache->lru_tail = entry->lru_prev;
+  }
+  entry->lru_prev = NULL;
+  entry->lru_next = NULL;
+}
+
+static void tts_cache_lru_push_front(ethervox_tts_cache_t* cache,
+                                     ethervox_tts_cache_entry_t* entry) {
+  entry->lru_prev = NULL;
+  entry->lru_next = cache->lru_head;
+  if (cache->lru_head) {
+    cache->lru_head->lru_prev = entry;
+  }
+  cache->lru_head = entry;
+  if (!cache->lru_tail) {
+    cache->lru_tail = entry;
+  }
+}
+
+static ethervox_tts_cache_entry_t** tts_cache_bucket_for(ethervox_tts_cache_t* cache,
+                                                         uint64_t hash, const char* key) {
+  const uint32_t mask = cache->bucket_count - 1;
+  uint32_t index = (uint32_t)hash & mask;
+  for (;;) {
+    ethervox_tts_cache_entry_t** slot = &cache->buckets[index];
+    if (!*slot || ((*slot)->hash == hash && strcmp((*slot)->key, key) == 0)) {
+      return slot;
+    }
+    index = (index + 1) & mask;
+  }
+}
+
+// Rebuild the bucket table from the LRU list (after eviction or growth)
+static int tts_cache_rehash(ethervox_tts_cache_t* cache, uint32_t bucket_count) {
+  ethervox_tts_cache_entry_t** buckets =
+      (ethervox_tts_cache_entry_t**)calloc(bucket_count, sizeof(*buckets));
+  if (!buckets) {
+    return -1;
+  }
+
+  free(cache->buckets);
+  cache->buckets = buckets;
+  cache->bucket_count = bucket_count;
+
+  const uint32_t mask = bucket_count - 1;
+  for (ethervox_tts_cache_entry_t* entry = cache->lru_head; entry; entry = entry->lru_next) {
+    uint32_t index = (uint32_t)entry->hash & mask;
+    while (cache->buckets[index]) {
+      index = (index + 1) & mask;
+    }
+    cache->buckets[index] = entry;
+  }
+  return 0;
+}
+
+static void tts_cache_entry_free(ethervox_tts_cache_entry_t* entry) {
+  free(entry->key);
+  free(entry->samples);
+  free(entry);
+}
+
+static void tts_cache_evict_tail(ethervox_tts_cache_t* cache) {
+  ethervox_tts_cache_entry_t* victim = cache->lru_tail;
+  if (!victim) {
+    return;
+  }
+  tts_cache_lru_unlink(cache, victim);
+  cache->used_bytes -= victim->bytes;
+  cache->entry_count--;
+  tts_cache_entry_free(victim);
+  // Open addressing can't delete in place without tombstones; the table is
+  // small, so rebuild it from the surviving entries
+  tts_cache_rehash(cache, cache->bucket_count);
+}
+
+// On-disk layout: sample_count header followed by raw float PCM, named by
+// the key hash under persist_dir
+static void tts_cache_disk_path(const ethervox_tts_cache_t* cache, uint64_t hash, char* path,
+                                size_t path_size) {
+  snprintf(path, path_size, "%s/tts_%016llx.pcm", cache->persist_dir,
+           (unsigned long long)hash);
+}
+
+static void tts_cache_disk_store(const ethervox_tts_cache_t* cache,
+                                 const ethervox_tts_cache_entry_t* entry) {
+  char path[600];
+  tts_cache_disk_path(cache, entry->hash, path, sizeof(path));
+
+  FILE* file = fopen(path, "wb");
+  if (!file) {
+    return;  // Persistence is best-effort
+  }
+  if (fwrite(&entry->sample_count, sizeof(entry->sample_count), 1, file) == 1) {
+    fwrite(entry->samples, sizeof(float), entry->sample_count, file);
+  }
+  fclose(file);
+}
+
+static float* tts_cache_disk_load(const ethervox_tts_cache_t* cache, uint64_t hash,
+                                  uint32_t* sample_count) {
+  char path[600];
+  tts_cache_disk_path(cache, hash, path, sizeof(path));
+
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return NULL;
+  }
+
+  uint32_t count = 0;
+  float* samples = NULL;
+  if (fread(&count, sizeof(count), 1, file) == 1 && count > 0 &&
+      (size_t)count * sizeof(float) <= cache->budget_bytes) {
+    samples = (float*)malloc((size_t)count * sizeof(float));
+    if (samples && fread(samples, sizeof(float), count, file) != count) {
+      free(samples);
+      samples = NULL;
+    }
+  }
+  fclose(file);
+
+  if (samples) {
+    *sample_count = count;
+  }
+  return samples;
+}
+
+int ethervox_tts_cache_init(ethervox_tts_cache_t* cache, size_t budget_bytes,
+                            const char* persist_dir) {
+  if (!cache || budget_bytes == 0) {
+    return -1;
+  }
+
+  memset(cache, 0, sizeof(*cache));
+  cache->buckets = (ethervox_tts_cache_entry_t**)calloc(kTtsCacheInitialBuckets,
+                                                        sizeof(*cache->buckets));
+  if (!cache->buckets) {
+    return -1;
+  }
+  cache->bucket_count = kTtsCacheInitialBuckets;
+  cache->budget_bytes = budget_bytes;
+  if (persist_dir && persist_dir[0] != '\0') {
+    snprintf(cache->persist_dir, sizeof(cache->persist_dir), "%s", persist_dir);
+  }
+  cache->is_initialized = true;
+  return 0;
+}
+
+// Insert an already-built entry, evicting until it fits; takes ownership
+static int tts_cache_insert(ethervox_tts_cache_t* cache, ethervox_tts_cache_entry_t* entry) {
+  while (cache->used_bytes + entry->bytes > cache->budget_bytes && cache->lru_tail) {
+    tts_cache_evict_tail(cache);
+  }
+
+  // Keep the table at most half full so probe chains stay short
+  if ((cache->entry_count + 1) * 2 > cache->bucket_count) {
+    if (tts_cache_rehash(cache, cache->bucket_count * 2) != 0) {
+      tts_cache_entry_free(entry);
+      return -1;
+    }
+  }
+
+  *tts_cache_bucket_for(cache, entry->hash, entry->key) = entry;
+  tts_cache_lru_push_front(cache, entry);
+  cache->used_bytes += entry->bytes;
+  cache->entry_count++;
+  return 0;
+}
+
+static ethervox_tts_cache_entry_t* tts_cache_entry_new(const char* key, uint64_t hash,
+                                                       const float* samples,
+                                                       uint32_t sample_count) {
+  ethervox_tts_cache_entry_t* entry =
+      (ethervox_tts_cache_entry_t*)calloc(1, sizeof(*entry));
+  if (!entry) {
+    return NULL;
+  }
+  entry->key = strdup(key);
+  entry->samples = (float*)malloc((size_t)sample_count * sizeof(float));
+  if (!entry->key || !entry->samples) {
+    tts_cache_entry_free(entry);
+    return NULL;
+  }
+  memcpy(entry->samples, samples, (size_t)sample_count * sizeof(float));
+  entry->hash = hash;
+  entry->sample_count = sample_count;
+  entry->bytes = sizeof(*entry) + strlen(key) + 1 + (size_t)sample_count * sizeof(float);
+  return entry;
+}
+
+static int tts_cache_fill_output(const ethervox_tts_cache_entry_t* entry,
+                                 ethervox_audio_buffer_t* output) {
+  output->data = (float*)malloc((size_t)entry->sample_count * sizeof(float));
+  if (!output->data) {
+    return -1;
+  }
+  memcpy(output->data, entry->samples, (size_t)entry->sample_count * sizeof(float));
+  output->size = entry->sample_count;
+  output->channels = 1;
+  output->timestamp_us = 0;
+  return 0;
+}
+
+int ethervox_tts_cache_lookup(ethervox_tts_cache_t* cache, const ethervox_tts_request_t* request,
+                              ethervox_audio_buffer_t* output) {
+  if (!cache || !cache->is_initialized || !request || !output) {
+    return -1;
+  }
+
+  char key[kTtsCacheMaxKeyBytes];
+  if (tts_cache_build_key(request, key, sizeof(key)) != 0) {
+    return 1;  // Oversized keys are simply not cacheable
+  }
+  const uint64_t hash = tts_cache_hash(key);
+
+  ethervox_tts_cache_entry_t** slot = tts_cache_bucket_for(cache, hash, key);
+  if (*slot) {
+    ethervox_tts_cache_entry_t* entry = *slot;
+    tts_cache_lru_unlink(cache, entry);
+    tts_cache_lru_push_front(cache, entry);
+    cache->hits++;
+    return tts_cache_fill_output(entry, output);
+  }
+
+  // Cold start: promote a persisted copy into memory if one exists
+  if (cache->persist_dir[0] != '\0') {
+    uint32_t sample_count = 0;
+    float* samples = tts_cache_disk_load(cache, hash, &sample_count);
+    if (samples) {
+      ethervox_tts_cache_entry_t* entry = tts_cache_entry_new(key, hash, samples, sample_count);
+      free(samples);
+      if (entry && tts_cache_insert(cache, entry) == 0) {
+        cache->hits++;
+        return tts_cache_fill_output(entry, output);
+      }
+    }
+  }
+
+  cache->misses++;
+  return 1;
+}
+
+int ethervox_tts_cache_store(ethervox_tts_cache_t* cache, const ethervox_tts_request_t* request,
+                             const ethervox_audio_buffer_t* pcm) {
+  if (!cache || !cache->is_initialized || !request || !pcm || !pcm->data) {
+    return -1;
+  }
+
+  char key[kTtsCacheMaxKeyBytes];
+  if (tts_cache_build_key(request, key, sizeof(key)) != 0) {
+    return -1;
+  }
+  const uint64_t hash = tts_cache_hash(key);
+
+  if ((size_t)pcm->size * sizeof(float) > cache->budget_bytes) {
+    return -1;  // Larger than the whole budget; caching it would empty the cache
+  }
+
+  ethervox_tts_cache_entry_t** slot = tts_cache_bucket_for(cache, hash, key);
+  if (*slot) {
+    return 0;  // Already cached; lookup refreshes recency
+  }
+
+  ethervox_tts_cache_entry_t* entry = tts_cache_entry_new(key, hash, pcm->data, pcm->size);
+  if (!entry || tts_cache_insert(cache, entry) != 0) {
+    return -1;
+  }
+
+  if (cache->persist_dir[0] != '\0') {
+    tts_cache_disk_store(cache, entry);
+  }
+  return 0;
+}
+
+int ethervox_tts_synthesize_cached(ethervox_audio_runtime_t* runtime,
+                                   ethervox_tts_cache_t* cache,
+                                   const ethervox_tts_request_t* request,
+                                   ethervox_audio_buffer_t* output) {
+  if (!runtime || !request || !output) {
+    return -1;
+  }
+
+  if (cache) {
+    const int found = ethervox_tts_cache_lookup(cache, request, output);
+    if (found == 0) {
+      return 0;
+    }
+    if (found < 0) {
+      return -1;
+    }
+  }
+
+  if (ethervox_tts_synthesize(runtime, request, output) != 0) {
+    return -1;
+  }
+  if (cache) {
+    ethervox_tts_cache_store(cache, request, output);
+  }
+  return 0;
+}
+
+void ethervox_tts_cache_cleanup(ethervox_tts_cache_t* cache) {
+  if (!cache || !cache->is_initialized) {
+    return;
+  }
+
+  ethervox_tts_cache_entry_t* entry = cache->lru_head;
+  while (entry) {
+    ethervox_tts_cache_entry_t* next = entry->lru_next;
+    tts_cache_entry_free(entry);
+    entry = next;
+  }
+  free(cache->buckets);
+  memset(cache, 0, sizeof(*cache));
+}
@@ -0,0 +1,241 @@
+/**
+ * @file vad.c
+ * @brief Voice activity detection (energy + spectral flatness) for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ethervox/vad.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+static const uint32_t kEthervoxVadFrameSize = 256U;  // 16 ms at 16 kHz
+static const uint32_t kEthervoxVadMaxFrameSize = 512U;
+static const float kEthervoxVadEnergyThresholdDefault = 0.02f;
+static const float kEthervoxVadFlatnessThresholdDefault = 0.45f;
+static const uint32_t kEthervoxVadHangoverFramesDefault = 8U;
+static const float kEthervoxVadNoiseFloorDecay = 0.95f;
+static const float kEthervoxVadNoiseFloorMargin = 3.0f;
+static const float kEthervoxVadInt16Scale = 32768.0f;
+static const float kEthervoxVadTwoPi = 6.283185307f;
+static const float kEthervoxVadLogFloor = 1e-12f;
+
+ethervox_vad_config_t ethervox_vad_get_default_config(void) {
+  ethervox_vad_config_t config = {.sample_rate = ETHERVOX_AUDIO_SAMPLE_RATE,
+                                  .frame_size = kEthervoxVadFrameSize,
+                                  .energy_threshold = kEthervoxVadEnergyThresholdDefault,
+                                  .flatness_threshold = kEthervoxVadFlatnessThresholdDefault,
+                                  .hangover_frames = kEthervoxVadHangoverFramesDefault};
+  return config;
+}
+
+int ethervox_vad_init(ethervox_vad_runtime_t* runtime, const ethervox_vad_config_t* config) {
+  if (!runtime) {
+    return -1;
+  }
+
+  memset(runtime, 0, sizeof(ethervox_vad_runtime_t));
+  runtime->config = config ? *config : ethervox_vad_get_default_config();
+
+  // The flatness FFT requires a power-of-two frame within the scratch limit
+  if (runtime->config.frame_size == 0 || runtime->config.frame_size > kEthervoxVadMaxFrameSize ||
+      (runtime->config.frame_size & (runtime->config.frame_size - 1)) != 0) {
+    fprintf(stderr, "VAD frame size must be a power of two (<= %u)\n", kEthervoxVadMaxFrameSize);
+    return -1;
+  }
+
+  runtime->noise_floor = runtime->config.energy_threshold;
+  runtime->is_initialized = true;
+  return 0;
+}
+
+// Normalized RMS of an int16 frame; vectorized on SSE2/NEON, scalar elsewhere.
+// Products are accumulated into 64-bit lanes so no frame length can overflow.
+static float vad_frame_energy(const int16_t* samples, uint32_t count) {
+  uint64_t acc = 0;
+  uint32_t i = 0;
+
+#if defined(__SSE2__)
+  __m128i acc_v = _mm_setzero_si128();
+  for (; i + 8 <= count; i += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(samples + i));
+    __m128i sq = _mm_madd_epi16(v, v);  // 4 x int32 pair sums
+    acc_v = _mm_add_epi64(acc_v, _mm_unpacklo_epi32(sq, _mm_setzero_si128()));
+    acc_v = _mm_add_epi64(acc_v, _mm_unpackhi_epi32(sq, _mm_setzero_si128()));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128((__m128i*)lanes, acc_v);
+  acc = lanes[0] + lanes[1];
+#elif defined(__ARM_NEON)
+  int64x2_t acc_v = vdupq_n_s64(0);
+  for (; i + 8 <= count; i += 8) {
+    int16x8_t v = vld1q_s16(samples + i);
+    int32x4_t sq_lo = vmull_s16(vget_low_s16(v), vget_low_s16(v));
+    int32x4_t sq_hi = vmull_s16(vget_high_s16(v), vget_high_s16(v));
+    acc_v = vpadalq_s32(vpadalq_s32(acc_v, sq_lo), sq_hi);
+  }
+  acc = (uint64_t)(vgetq_lane_s64(acc_v, 0) + vgetq_lane_s64(acc_v, 1));
+#endif
+
+  for (; i < count; i++) {
+    acc += (uint64_t)((int32_t)samples[i] * (int32_t)samples[i]);
+  }
+
+  const float mean_square =
+      (float)acc / ((float)count * kEthervoxVadInt16Scale * kEthervoxVadInt16Scale);
+  return sqrtf(mean_square);
+}
+
+// In-place iterative radix-2 FFT; im[] must be zeroed by the caller
+static void vad_fft(float* re, float* im, uint32_t n) {
+  for (uint32_t i = 1, j = 0; i < n; i++) {
+    uint32_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      float tmp = re[i];
+      re[i] = re[j];
+      re[j] = tmp;
+      tmp = im[i];
+      im[i] = im[j];
+      im[j] = tmp;
+    }
+  }
+
+  for (uint32_t len = 2; len <= n; len <<= 1) {
+    const float angle = -kEthervoxVadTwoPi / (float)len;
+    const float w_re = cosf(angle);
+    const float w_im = sinf(angle);
+    for (uint32_t i = 0; i < n; i += len) {
+      float cur_re = 1.0f;
+      float cur_im = 0.0f;
+      for (uint32_t k = 0; k < len / 2; k++) {
+        const uint32_t a = i + k;
+        const uint32_t b = i + k + len / 2;
+        const float t_re = re[b] * cur_re - im[b] * cur_im;
+        const float t_im = re[b] * cur_im + im[b] * cur_re;
+        re[b] = re[a] - t_re;
+        im[b] = im[a] - t_im;
+        re[a] += t_re;
+        im[a] += t_im;
+        const float next_re = cur_re * w_re - cur_im * w_im;
+        cur_im = cur_re * w_im + cur_im * w_re;
+        cur_re = next_re;
+      }
+    }
+  }
+}
+
+// Spectral flatness (geometric / arithmetic mean of power bins). Close to 1.0
+// for broadband noise, well below for harmonic content such as voiced speech.
+static float vad_frame_flatness(const int16_t* samples, uint32_t n) {
+  float re[kEthervoxVadMaxFrameSize];
+  float im[kEthervoxVadMaxFrameSize];
+
+  for (uint32_t i = 0; i < n; i++) {
+    re[i] = (float)samples[i] / kEthervoxVadInt16Scale;
+    im[i] = 0.0f;
+  }
+
+  vad_fft(re, im, n);
+
+  const uint32_t bins = n / 2;
+  float log_sum = 0.0f;
+  float lin_sum = 0.0f;
+  for (uint32_t i = 1; i < bins; i++) {  // Skip DC
+    const float power = re[i] * re[i] + im[i] * im[i] + kEthervoxVadLogFloor;
+    log_sum += logf(power);
+    lin_sum += power;
+  }
+
+  const float geometric = expf(log_sum / (float)(bins - 1));
+  const float arithmetic = lin_sum / (float)(bins - 1);
+  return geometric / arithmetic;
+}
+
+int ethervox_vad_process(ethervox_vad_runtime_t* runtime,
+                         const ethervox_audio_buffer_t* audio_buffer, bool* is_voice) {
+  if (!runtime || !runtime->is_initialized || !audio_buffer || !is_voice) {
+    return -1;
+  }
+
+  *is_voice = false;
+  if (!audio_buffer->data || audio_buffer->size == 0) {
+    return 0;
+  }
+
+  // Capture buffers carry raw int16 PCM and size in bytes (see platform read)
+  const int16_t* samples = (const int16_t*)audio_buffer->data;
+  const uint32_t sample_count = audio_buffer->size / sizeof(int16_t);
+  const uint32_t frame_size = runtime->config.frame_size;
+
+  bool active = false;
+  for (uint32_t offset = 0; offset + frame_size <= sample_count; offset += frame_size) {
+    const float energy = vad_frame_energy(samples + offset, frame_size);
+
+    // Track the noise floor on quiet frames so the gate adapts to room tone
+    if (energy < runtime->noise_floor) {
+      runtime->noise_floor = energy;
+    } else {
+      runtime->noise_floor = runtime->noise_floor * kEthervoxVadNoiseFloorDecay +
+                             energy * (1.0f - kEthervoxVadNoiseFloorDecay);
+    }
+
+    if (energy < runtime->config.energy_threshold &&
+        energy < runtime->noise_floor * kEthervoxVadNoiseFloorMargin) {
+      continue;  // Too quiet; skip the FFT entirely
+    }
+
+    const float flatness = vad_frame_flatness(samples + offset, frame_size);
+    if (flatness < runtime->config.flatness_threshold) {
+      active = true;
+      break;
+    }
+  }
+
+  if (active) {
+    runtime->hangover_counter = runtime->config.hangover_frames;
+    *is_voice = true;
+  } else if (runtime->hangover_counter > 0) {
+    runtime->hangover_counter--;
+    *is_voice = true;  // Bridge short pauses so trailing syllables pass
+  }
+
+  return 0;
+}
+
+void ethervox_vad_reset(ethervox_vad_runtime_t* runtime) {
+  if (!runtime) {
+    return;
+  }
+
+  runtime->noise_floor = runtime->config.energy_threshold;
+  runtime->hangover_counter = 0;
+}
+
+void ethervox_vad_cleanup(ethervox_vad_runtime_t* runtime) {
+  if (!runtime) {
+    return;
+  }
+
+  runtime->is_initialized = false;
+}
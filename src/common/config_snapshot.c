@@ -0,0 +1,364 @@
+/**
+ * @file config_snapshot.c
+ * @brief Immutable, refcounted configuration snapshots for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+
+#include "ethervox/config_snapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define CONFIG_STORE_HAVE_PTHREAD 1
+#else
+#define CONFIG_STORE_HAVE_PTHREAD 0
+#endif
+
+// Refcounting follows the trace-id pattern: atomic where the compiler offers
+// it, plain arithmetic on single-threaded toolchains
+#if defined(__GNUC__) || defined(__clang__)
+#define snapshot_ref_inc(p) __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+#define snapshot_ref_dec(p) __atomic_sub_fetch((p), 1, __ATOMIC_ACQ_REL)
+#else
+#define snapshot_ref_inc(p) (++*(p))
+#define snapshot_ref_dec(p) (--*(p))
+#endif
+
+typedef struct {
+  const char* key;
+  const char* value;
+} config_entry_t;
+
+// The whole snapshot lives in one malloc block: this header, the sorted
+// entry table, then the interned string bytes. Nothing mutates after build,
+// so holders read without synchronization.
+struct ethervox_config_snapshot {
+  volatile int refcount;
+  uint32_t entry_count;
+  config_entry_t entries[];
+};
+
+typedef struct {
+  char* key;
+  char* value;
+} builder_entry_t;
+
+struct ethervox_config_builder {
+  builder_entry_t* entries;
+  uint32_t count;
+  uint32_t capacity;
+};
+
+ethervox_config_builder_t* ethervox_config_builder_create(void) {
+  return (ethervox_config_builder_t*)calloc(1, sizeof(ethervox_config_builder_t));
+}
+
+ethervox_config_builder_t* ethervox_config_builder_from(
+    const ethervox_config_snapshot_t* snapshot) {
+  ethervox_config_builder_t* builder = ethervox_config_builder_create();
+  if (!builder || !snapshot) {
+    return builder;
+  }
+
+  for (uint32_t i = 0; i < snapshot->entry_count; i++) {
+    if (ethervox_config_builder_set(builder, snapshot->entries[i].key,
+                                    snapshot->entries[i].value) != 0) {
+      ethervox_config_builder_destroy(builder);
+      return NULL;
+    }
+  }
+  return builder;
+}
+
+int ethervox_config_builder_set(ethervox_config_builder_t* builder, const char* key,
+                                const char* value) {
+  if (!builder || !key || !*key) {
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < builder->count; i++) {
+    if (strcmp(builder->entries[i].key, key) != 0) {
+      continue;
+    }
+    if (!value) {  // Remove the key
+      free(builder->entries[i].key);
+      free(builder->entries[i].value);
+      builder->entries[i] = builder->entries[builder->count - 1];
+      builder->count--;
+      return 0;
+    }
+    char* copy = strdup(value);
+    if (!copy) {
+      return -1;
+    }
+    free(builder->entries[i].value);
+    builder->entries[i].value = copy;
+    return 0;
+  }
+
+  if (!value) {
+    return 0;  // Removing an absent key is a no-op
+  }
+
+  if (builder->count == builder->capacity) {
+    const uint32_t capacity = builder->capacity ? builder->capacity * 2 : 16;
+    builder_entry_t* grown =
+        (builder_entry_t*)realloc(builder->entries, capacity * sizeof(builder_entry_t));
+    if (!grown) {
+      return -1;
+    }
+    builder->entries = grown;
+    builder->capacity = capacity;
+  }
+
+  builder_entry_t* entry = &builder->entries[builder->count];
+  entry->key = strdup(key);
+  entry->value = strdup(value);
+  if (!entry->key || !entry->value) {
+    free(entry->key);
+    free(entry->value);
+    return -1;
+  }
+  builder->count++;
+  return 0;
+}
+
+void ethervox_config_builder_destroy(ethervox_config_builder_t* builder) {
+  if (!builder) {
+    return;
+  }
+  for (uint32_t i = 0; i < builder->count; i++) {
+    free(builder->entries[i].key);
+    free(builder->entries[i].value);
+  }
+  free(builder->entries);
+  free(builder);
+}
+
+static int builder_entry_compare(const void* a, const void* b) {
+  return strcmp(((const builder_entry_t*)a)->key, ((const builder_entry_t*)b)->key);
+}
+
+// Intern text into the arena: an identical earlier string is reused instead
+// of stored again (wake words, language codes and paths repeat across keys)
+static const char* arena_intern(char* arena, size_t* used, const char* text) {
+  size_t offset = 0;
+  const size_t len = strlen(text) + 1;
+  while (offset < *used) {
+    if (strcmp(arena + offset, text) == 0) {
+      return arena + offset;
+    }
+    offset += strlen(arena + offset) + 1;
+  }
+  memcpy(arena + *used, text, len);
+  const char* interned = arena + *used;
+  *used += len;
+  return interned;
+}
+
+ethervox_config_snapshot_t* ethervox_config_builder_finish(ethervox_config_builder_t* builder) {
+  if (!builder) {
+    return NULL;
+  }
+
+  qsort(builder->entries, builder->count, sizeof(builder_entry_t), builder_entry_compare);
+
+  // Worst case (no sharing) every key and value is stored once
+  size_t string_bytes = 0;
+  for (uint32_t i = 0; i < builder->count; i++) {
+    string_bytes += strlen(builder->entries[i].key) + 1;
+    string_bytes += strlen(builder->entries[i].value) + 1;
+  }
+
+  ethervox_config_snapshot_t* snapshot = (ethervox_config_snapshot_t*)malloc(
+      sizeof(ethervox_config_snapshot_t) + builder->count * sizeof(config_entry_t) +
+      string_bytes);
+  if (!snapshot) {
+    ethervox_config_builder_destroy(builder);
+    return NULL;
+  }
+
+  snapshot->refcount = 1;
+  snapshot->entry_count = builder->count;
+
+  char* arena = (char*)(snapshot->entries + builder->count);
+  size_t used = 0;
+  for (uint32_t i = 0; i < builder->count; i++) {
+    snapshot->entries[i].key = arena_intern(arena, &used, builder->entries[i].key);
+    snapshot->entries[i].value = arena_intern(arena, &used, builder->entries[i].value);
+  }
+
+  ethervox_config_builder_destroy(builder);
+  return snapshot;
+}
+
+ethervox_config_snapshot_t* ethervox_config_snapshot_ref(ethervox_config_snapshot_t* snapshot) {
+  if (snapshot) {
+    snapshot_ref_inc(&snapshot->refcount);
+  }
+  return snapshot;
+}
+
+void ethervox_config_snapshot_unref(ethervox_config_snapshot_t* snapshot) {
+  if (snapshot && snapshot_ref_dec(&snapshot->refcount) == 0) {
+    free(snapshot);
+  }
+}
+
+const char* ethervox_config_snapshot_get(const ethervox_config_snapshot_t* snapshot,
+                                         const char* key, const char* default_value) {
+  if (!snapshot || !key) {
+    return default_value;
+  }
+
+  // Binary search over the sorted entry table
+  uint32_t lo = 0;
+  uint32_t hi = snapshot->entry_count;
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    const int cmp = strcmp(snapshot->entries[mid].key, key);
+    if (cmp == 0) {
+      return snapshot->entries[mid].value;
+    }
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return default_value;
+}
+
+bool ethervox_config_snapshot_get_bool(const ethervox_config_snapshot_t* snapshot,
+                                       const char* key, bool default_value) {
+  const char* value = ethervox_config_snapshot_get(snapshot, key, NULL);
+  if (!value) {
+    return default_value;
+  }
+  return strcmp(value, "true") == 0 || strcmp(value, "1") == 0;
+}
+
+uint32_t ethervox_config_snapshot_get_uint(const ethervox_config_snapshot_t* snapshot,
+                                           const char* key, uint32_t default_value) {
+  const char* value = ethervox_config_snapshot_get(snapshot, key, NULL);
+  if (!value) {
+    return default_value;
+  }
+  char* end = NULL;
+  const unsigned long parsed = strtoul(value, &end, 10);
+  return (end && *end == '\0') ? (uint32_t)parsed : default_value;
+}
+
+float ethervox_config_snapshot_get_float(const ethervox_config_snapshot_t* snapshot,
+                                         const char* key, float default_value) {
+  const char* value = ethervox_config_snapshot_get(snapshot, key, NULL);
+  if (!value) {
+    return default_value;
+  }
+  char* end = NULL;
+  const float parsed = strtof(value, &end);
+  return (end && *end == '\0') ? parsed : default_value;
+}
+
+uint32_t ethervox_config_snapshot_count(const ethervox_config_snapshot_t* snapshot) {
+  return snapshot ? snapshot->entry_count : 0;
+}
+
+int ethervox_config_snapshot_at(const ethervox_config_snapshot_t* snapshot, uint32_t index,
+                                const char** key, const char** value) {
+  if (!snapshot || index >= snapshot->entry_count) {
+    return -1;
+  }
+  if (key) {
+    *key = snapshot->entries[index].key;
+  }
+  if (value) {
+    *value = snapshot->entries[index].value;
+  }
+  return 0;
+}
+
+// --- Store -----------------------------------------------------------------
+
+struct ethervox_config_store {
+  ethervox_config_snapshot_t* current;
+#if CONFIG_STORE_HAVE_PTHREAD
+  // Held only across the pointer exchange and the ref taken in load();
+  // readers do all actual config access on their own referenced snapshot
+  pthread_mutex_t mutex;
+#endif
+};
+
+ethervox_config_store_t* ethervox_config_store_create(ethervox_config_snapshot_t* initial) {
+  ethervox_config_store_t* store =
+      (ethervox_config_store_t*)calloc(1, sizeof(ethervox_config_store_t));
+  if (!store) {
+    ethervox_config_snapshot_unref(initial);
+    return NULL;
+  }
+
+  store->current = initial;
+#if CONFIG_STORE_HAVE_PTHREAD
+  pthread_mutex_init(&store->mutex, NULL);
+#endif
+  return store;
+}
+
+ethervox_config_snapshot_t* ethervox_config_store_load(ethervox_config_store_t* store) {
+  if (!store) {
+    return NULL;
+  }
+
+#if CONFIG_STORE_HAVE_PTHREAD
+  pthread_mutex_lock(&store->mutex);
+#endif
+  ethervox_config_snapshot_t* snapshot = ethervox_config_snapshot_ref(store->current);
+#if CONFIG_STORE_HAVE_PTHREAD
+  pthread_mutex_unlock(&store->mutex);
+#endif
+  return snapshot;
+}
+
+void ethervox_config_store_swap(ethervox_config_store_t* store,
+                                ethervox_config_snapshot_t* snapshot) {
+  if (!store) {
+    ethervox_config_snapshot_unref(snapshot);
+    return;
+  }
+
+#if CONFIG_STORE_HAVE_PTHREAD
+  pthread_mutex_lock(&store->mutex);
+#endif
+  ethervox_config_snapshot_t* previous = store->current;
+  store->current = snapshot;
+#if CONFIG_STORE_HAVE_PTHREAD
+  pthread_mutex_unlock(&store->mutex);
+#endif
+
+  ethervox_config_snapshot_unref(previous);
+}
+
+void ethervox_config_store_destroy(ethervox_config_store_t* store) {
+  if (!store) {
+    return;
+  }
+
+  ethervox_config_snapshot_unref(store->current);
+#if CONFIG_STORE_HAVE_PTHREAD
+  pthread_mutex_destroy(&store->mutex);
+#endif
+  free(store);
+}
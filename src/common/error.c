@@ -12,22 +12,32 @@
 #include <string.h>
 #include <time.h>
 
-// Thread-local storage for error context (if available)
+// Per-thread preallocated error state: a small fixed ring of contexts so a
+// failure can carry its nested causes (caller pushed on top of callee) with
+// recording costing a few stores — no heap, no lock, safe in the audio and
+// STT loops where overrun recovery fires constantly under load.
+typedef struct {
+    ethervox_error_context_t chain[ETHERVOX_ERROR_CHAIN_DEPTH];
+    uint32_t head;    // Index of the most recent context
+    uint32_t length;  // Valid entries, capped at ETHERVOX_ERROR_CHAIN_DEPTH
+} ethervox_error_state_t;
+
+// Thread-local storage for error state (if available)
 #if defined(_MSC_VER)
 // MSVC extension - use this first for Windows
-static __declspec(thread) ethervox_error_context_t g_error_context = {0};
+static __declspec(thread) ethervox_error_state_t g_error_state = {0};
 #define HAS_THREAD_LOCAL 1
 #elif defined(__GNUC__) || defined(__clang__)
 // GCC/Clang extension (including MinGW)
-static __thread ethervox_error_context_t g_error_context = {0};
+static __thread ethervox_error_state_t g_error_state = {0};
 #define HAS_THREAD_LOCAL 1
 #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
 #include <threads.h>
-static thread_local ethervox_error_context_t g_error_context = {0};
+static thread_local ethervox_error_state_t g_error_state = {0};
 #define HAS_THREAD_LOCAL 1
 #else
 // Fallback to global for platforms without thread_local
-static ethervox_error_context_t g_error_context = {0};
+static ethervox_error_state_t g_error_state = {0};
 #define HAS_THREAD_LOCAL 0
 #endif
 
@@ -101,33 +111,54 @@ void ethervox_error_set_context(
     int line,
     const char* function
 ) {
-    g_error_context.code = code;
-    g_error_context.message = message;
-    g_error_context.file = file;
-    g_error_context.line = line;
-    g_error_context.function = function;
-    
+    // Advance the ring head; the previous context becomes this one's cause.
+    // The oldest entry is overwritten once the fixed depth is exceeded.
+    g_error_state.head = (g_error_state.head + 1) % ETHERVOX_ERROR_CHAIN_DEPTH;
+    if (g_error_state.length < ETHERVOX_ERROR_CHAIN_DEPTH) {
+        g_error_state.length++;
+    }
+
+    ethervox_error_context_t* ctx = &g_error_state.chain[g_error_state.head];
+    ctx->code = code;
+    ctx->message = message;
+    ctx->file = file;
+    ctx->line = line;
+    ctx->function = function;
+
     // Platform-specific timestamp
 #if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 199309L
     struct timespec ts;
     if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-        g_error_context.timestamp_ms = (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+        ctx->timestamp_ms = (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
     } else {
-        g_error_context.timestamp_ms = 0;
+        ctx->timestamp_ms = 0;
     }
 #elif defined(_WIN32)
     // Windows implementation
-    g_error_context.timestamp_ms = (uint64_t)GetTickCount64();
+    ctx->timestamp_ms = (uint64_t)GetTickCount64();
 #else
     // Fallback: use time() which has 1-second resolution
-    g_error_context.timestamp_ms = (uint64_t)time(NULL) * 1000;
+    ctx->timestamp_ms = (uint64_t)time(NULL) * 1000;
 #endif
 }
 
 const ethervox_error_context_t* ethervox_error_get_context(void) {
-    return &g_error_context;
+    return &g_error_state.chain[g_error_state.head];
+}
+
+const ethervox_error_context_t* ethervox_error_get_cause(uint32_t depth) {
+    if (depth >= g_error_state.length) {
+        return NULL;
+    }
+    const uint32_t index =
+        (g_error_state.head + ETHERVOX_ERROR_CHAIN_DEPTH - depth) % ETHERVOX_ERROR_CHAIN_DEPTH;
+    return &g_error_state.chain[index];
+}
+
+uint32_t ethervox_error_chain_length(void) {
+    return g_error_state.length;
 }
 
 void ethervox_error_clear(void) {
-    memset(&g_error_context, 0, sizeof(g_error_context));
+    memset(&g_error_state, 0, sizeof(g_error_state));
 }
\ No newline at end of file
@@ -1,16 +1,47 @@
 // SPDX-License-Identifier: CC-BY-NC-SA-4.0
 #include "ethervox/logging.h"
+#include <stdbool.h>
+#include <stdint.h>
 #include <time.h>
 #include <string.h>
 
-static ethervox_log_level_t g_log_level = ETHERVOX_LOG_LEVEL_INFO;
+// Async mode needs a drain thread; without pthreads ethervox_log() stays
+// synchronous and ethervox_log_async_start() reports failure
+#if defined(__has_include)
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define ETHERVOX_LOG_ASYNC_AVAILABLE 1
+#endif
+#endif
+#ifndef ETHERVOX_LOG_ASYNC_AVAILABLE
+#define ETHERVOX_LOG_ASYNC_AVAILABLE 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define log_atomic_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define log_atomic_store(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define log_atomic_cas(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), false, __ATOMIC_ACQ_REL, \
+                                __ATOMIC_ACQUIRE)
+#define log_atomic_inc(ptr) (void)__atomic_add_fetch((ptr), 1, __ATOMIC_RELAXED)
+#else
+#define log_atomic_load(ptr) (*(ptr))
+#define log_atomic_store(ptr, val) (*(ptr) = (val))
+#define log_atomic_cas(ptr, expected, desired) \
+    ((*(ptr) == *(expected)) ? (*(ptr) = (desired), true) : (*(expected) = *(ptr), false))
+#define log_atomic_inc(ptr) (void)(++*(ptr))
+#endif
+
+// Non-static so the ETHERVOX_LOG_* macros can pre-check the level without a
+// function call; everything else goes through the accessors
+ethervox_log_level_t ethervox_g_log_level = ETHERVOX_LOG_LEVEL_INFO;
 
 void ethervox_log_set_level(ethervox_log_level_t level) {
-    g_log_level = level;
+    ethervox_g_log_level = level;
 }
 
 ethervox_log_level_t ethervox_log_get_level(void) {
-    return g_log_level;
+    return ethervox_g_log_level;
 }
 
 static const char* log_level_string(ethervox_log_level_t level) {
@@ -25,6 +56,127 @@ static const char* log_level_string(ethervox_log_level_t level) {
     }
 }
 
+// Lock-free MPSC ring for async mode. Producers format the full line on
+// their own stack, claim a slot with a CAS on the head, copy the line in and
+// publish it by storing the slot's sequence number; the drain thread is the
+// only consumer. A full ring drops the record and counts it — the capture
+// loop must never block on logging I/O.
+#define ETHERVOX_LOG_RING_SLOTS 256  // Power of two
+#define ETHERVOX_LOG_RECORD_BYTES 256
+
+typedef struct {
+    volatile uint32_t seq;  // claim + 1 once the record is readable
+    char text[ETHERVOX_LOG_RECORD_BYTES];
+} log_record_t;
+
+static log_record_t g_log_ring[ETHERVOX_LOG_RING_SLOTS];
+static volatile uint32_t g_log_ring_head;  // Next slot producers claim
+static volatile uint32_t g_log_ring_tail;  // Advanced by the drain thread only
+static volatile uint32_t g_log_dropped;
+static volatile bool g_log_async_enabled;
+
+#if ETHERVOX_LOG_ASYNC_AVAILABLE
+static pthread_t g_log_drain_thread;
+static volatile bool g_log_drain_running;
+static const uint32_t kLogDrainIdleSleepMs = 5;
+#endif
+
+static void log_ring_enqueue(const char* line) {
+    uint32_t claim;
+    for (;;) {
+        claim = log_atomic_load(&g_log_ring_head);
+        if (claim - log_atomic_load(&g_log_ring_tail) >= ETHERVOX_LOG_RING_SLOTS) {
+            log_atomic_inc(&g_log_dropped);
+            return;
+        }
+        uint32_t expected = claim;
+        if (log_atomic_cas(&g_log_ring_head, &expected, claim + 1)) {
+            break;
+        }
+    }
+
+    log_record_t* record = &g_log_ring[claim % ETHERVOX_LOG_RING_SLOTS];
+    snprintf(record->text, sizeof(record->text), "%s", line);
+    log_atomic_store(&record->seq, claim + 1);
+}
+
+#if ETHERVOX_LOG_ASYNC_AVAILABLE
+// Drain every published record at the tail; returns how many were written
+static uint32_t log_ring_drain(void) {
+    uint32_t written = 0;
+    for (;;) {
+        log_record_t* record = &g_log_ring[g_log_ring_tail % ETHERVOX_LOG_RING_SLOTS];
+        if (log_atomic_load(&record->seq) != g_log_ring_tail + 1) {
+            break;  // Empty, or the producer hasn't finished the copy yet
+        }
+        fputs(record->text, stderr);
+        log_atomic_store(&g_log_ring_tail, g_log_ring_tail + 1);
+        written++;
+    }
+    return written;
+}
+
+static void* log_drain_thread_main(void* arg) {
+    (void)arg;
+    uint32_t reported_drops = 0;
+
+    while (g_log_drain_running) {
+        if (log_ring_drain() == 0) {
+            struct timespec ts = {0, (long)kLogDrainIdleSleepMs * 1000000L};
+            nanosleep(&ts, NULL);
+        }
+
+        const uint32_t dropped = log_atomic_load(&g_log_dropped);
+        if (dropped != reported_drops) {
+            fprintf(stderr, "[logging] %u record(s) dropped (ring full)\n",
+                    dropped - reported_drops);
+            reported_drops = dropped;
+        }
+    }
+
+    // Final sweep so stop() doesn't lose records published before it
+    log_ring_drain();
+    fflush(stderr);
+    return NULL;
+}
+#endif  // ETHERVOX_LOG_ASYNC_AVAILABLE
+
+int ethervox_log_async_start(void) {
+#if ETHERVOX_LOG_ASYNC_AVAILABLE
+    if (g_log_async_enabled) {
+        return 0;
+    }
+
+    g_log_drain_running = true;
+    if (pthread_create(&g_log_drain_thread, NULL, log_drain_thread_main, NULL) != 0) {
+        g_log_drain_running = false;
+        return -1;
+    }
+    g_log_async_enabled = true;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+void ethervox_log_async_stop(void) {
+#if ETHERVOX_LOG_ASYNC_AVAILABLE
+    if (!g_log_async_enabled) {
+        return;
+    }
+
+    // Flip producers back to the synchronous path before draining so no
+    // record can be published after the final sweep
+    g_log_async_enabled = false;
+    g_log_drain_running = false;
+    pthread_join(g_log_drain_thread, NULL);
+#endif
+}
+
+uint32_t ethervox_log_async_dropped(void) {
+    return log_atomic_load(&g_log_dropped);
+}
+
 static const char* extract_filename(const char* path) {
     const char* filename = strrchr(path, '/');
     if (filename) {
@@ -39,7 +191,7 @@ static const char* extract_filename(const char* path) {
 
 void ethervox_log(ethervox_log_level_t level, const char* file, int line, 
                   const char* func, const char* fmt, ...) {
-    if (level < g_log_level) {
+    if (level < ethervox_g_log_level) {
         return;
     }
     
@@ -53,22 +205,39 @@ void ethervox_log(ethervox_log_level_t level, const char* file, int line,
     localtime_r(&now, &tm_info);  // POSIX
 #endif
     strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &tm_info);
-    
-    // Print log prefix
-    fprintf(stderr, "[%s] [%s] [%s:%d %s] ", 
-            timestamp,
-            log_level_string(level),
-            extract_filename(file),
-            line,
-            func);
-    
-    // Print message
+
+    // Format the whole line up front: in async mode only the copy into the
+    // ring happens on the caller's thread, never any I/O
+    char record[ETHERVOX_LOG_RECORD_BYTES];
+    int prefix_len = snprintf(record, sizeof(record), "[%s] [%s] [%s:%d %s] ",
+                              timestamp,
+                              log_level_string(level),
+                              extract_filename(file),
+                              line,
+                              func);
+    if (prefix_len < 0 || prefix_len >= (int)sizeof(record) - 1) {
+        prefix_len = (int)sizeof(record) - 2;
+    }
+
     va_list args;
     va_start(args, fmt);
-    vfprintf(stderr, fmt, args);
+    int msg_len = vsnprintf(record + prefix_len, sizeof(record) - (size_t)prefix_len - 1, fmt,
+                            args);
     va_end(args);
-    
-    fprintf(stderr, "\n");
+
+    int total = prefix_len + ((msg_len < 0) ? 0 : msg_len);
+    if (total >= (int)sizeof(record) - 1) {
+        total = (int)sizeof(record) - 2;
+    }
+    record[total] = '\n';
+    record[total + 1] = '\0';
+
+    if (g_log_async_enabled) {
+        log_ring_enqueue(record);
+        return;
+    }
+
+    fputs(record, stderr);
     fflush(stderr);
 }
 
@@ -0,0 +1,431 @@
+/**
+ * @file scheduler.c
+ * @brief Shared work-stealing task scheduler for EthervoxAI
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+
+#include "ethervox/scheduler.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ethervox/platform.h"
+
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define SCHEDULER_HAVE_PTHREAD 1
+#else
+#define SCHEDULER_HAVE_PTHREAD 0
+#endif
+
+#if SCHEDULER_HAVE_PTHREAD
+
+// Capacities are powers of two so ring indices wrap with a mask. 256 slots
+// per deque is far beyond any realistic backlog here; submit reports full
+// rather than blocking so callers can degrade to inline execution.
+#define SCHEDULER_DEQUE_CAPACITY 256
+#define SCHEDULER_INJECT_CAPACITY 256
+#define SCHEDULER_MAX_WORKERS 8
+
+typedef struct {
+  ethervox_sched_task_fn_t fn;
+  void* arg;
+} sched_task_t;
+
+// Chase-Lev style bounded deque: the owning worker pushes and pops at the
+// bottom without locks, thieves race on top with a compare-and-swap. The
+// capacity check in push guarantees a slot is never overwritten while a
+// thief may still be reading it.
+typedef struct {
+  volatile int64_t top;     // Next index thieves steal from
+  volatile int64_t bottom;  // Next index the owner pushes to
+  sched_task_t items[SCHEDULER_DEQUE_CAPACITY];
+} sched_deque_t;
+
+typedef struct {
+  pthread_t thread;
+  uint32_t index;
+  struct ethervox_scheduler* scheduler;
+  sched_deque_t deques[ETHERVOX_SCHED_PRIORITY_COUNT];
+  uint32_t steal_seed;  // Per-worker xorshift state for victim choice
+} sched_worker_t;
+
+// External submissions land here (mutex-guarded; the hot path between
+// workers is the lock-free deques, injection happens at task granularity)
+typedef struct {
+  sched_task_t items[SCHEDULER_INJECT_CAPACITY];
+  uint32_t head;
+  uint32_t count;
+} sched_inject_queue_t;
+
+struct ethervox_scheduler {
+  pthread_mutex_t lock;          // Injection queues + idle parking
+  pthread_cond_t work_available;
+  pthread_cond_t all_idle;       // Signalled for drain when counts hit zero
+  sched_inject_queue_t inject[ETHERVOX_SCHED_PRIORITY_COUNT];
+  sched_worker_t workers[SCHEDULER_MAX_WORKERS];
+  uint32_t worker_count;
+  volatile int64_t pending;  // Queued tasks not yet picked up
+  volatile int64_t active;   // Tasks currently executing
+  bool running;
+};
+
+// Set while a worker runs tasks, so submit-from-task uses the own deque
+static __thread sched_worker_t* tls_current_worker = NULL;
+
+static bool sched_deque_push(sched_deque_t* deque, sched_task_t task) {
+  const int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+  const int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+  if (bottom - top >= SCHEDULER_DEQUE_CAPACITY) {
+    return false;
+  }
+  deque->items[bottom & (SCHEDULER_DEQUE_CAPACITY - 1)] = task;
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+  return true;
+}
+
+static bool sched_deque_pop(sched_deque_t* deque, sched_task_t* out) {
+  int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+  __atomic_store_n(&deque->bottom, bottom, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  int64_t top = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+  if (top > bottom) {
+    // Deque was already empty; undo the speculative decrement
+    __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+    return false;
+  }
+
+  *out = deque->items[bottom & (SCHEDULER_DEQUE_CAPACITY - 1)];
+  if (top != bottom) {
+    return true;  // More than one item left; no race with thieves
+  }
+
+  // Last item: race thieves for it via top, then restore bottom
+  const bool won = __atomic_compare_exchange_n(&deque->top, &top, top + 1, false,
+                                               __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+  __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+  return won;
+}
+
+static bool sched_deque_steal(sched_deque_t* deque, sched_task_t* out) {
+  int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  const int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+  if (top >= bottom) {
+    return false;
+  }
+  *out = deque->items[top & (SCHEDULER_DEQUE_CAPACITY - 1)];
+  return __atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST,
+                                     __ATOMIC_RELAXED);
+}
+
+static bool sched_inject_pop(ethervox_scheduler_t* scheduler, sched_task_t* out) {
+  bool found = false;
+  pthread_mutex_lock(&scheduler->lock);
+  for (int pri = 0; pri < ETHERVOX_SCHED_PRIORITY_COUNT && !found; pri++) {
+    sched_inject_queue_t* queue = &scheduler->inject[pri];
+    if (queue->count > 0) {
+      *out = queue->items[queue->head];
+      queue->head = (queue->head + 1) % SCHEDULER_INJECT_CAPACITY;
+      queue->count--;
+      found = true;
+    }
+  }
+  pthread_mutex_unlock(&scheduler->lock);
+  return found;
+}
+
+static uint32_t sched_next_victim(sched_worker_t* worker) {
+  // xorshift32; quality hardly matters, avoiding a shared counter does
+  uint32_t x = worker->steal_seed;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  worker->steal_seed = x;
+  return x;
+}
+
+// One attempt to obtain a task: own deques first (realtime before
+// background), then the injection queues, then other workers' deques
+static bool sched_find_task(sched_worker_t* worker, sched_task_t* out) {
+  ethervox_scheduler_t* scheduler = worker->scheduler;
+
+  for (int pri = 0; pri < ETHERVOX_SCHED_PRIORITY_COUNT; pri++) {
+    if (sched_deque_pop(&worker->deques[pri], out)) {
+      return true;
+    }
+  }
+  if (sched_inject_pop(scheduler, out)) {
+    return true;
+  }
+  for (int pri = 0; pri < ETHERVOX_SCHED_PRIORITY_COUNT; pri++) {
+    const uint32_t offset = sched_next_victim(worker);
+    for (uint32_t i = 0; i < scheduler->worker_count; i++) {
+      sched_worker_t* victim = &scheduler->workers[(offset + i) % scheduler->worker_count];
+      if (victim != worker && sched_deque_steal(&victim->deques[pri], out)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+static void sched_run_task(ethervox_scheduler_t* scheduler, const sched_task_t* task) {
+  __atomic_sub_fetch(&scheduler->pending, 1, __ATOMIC_ACQ_REL);
+  __atomic_add_fetch(&scheduler->active, 1, __ATOMIC_ACQ_REL);
+
+  task->fn(task->arg);
+
+  if (__atomic_sub_fetch(&scheduler->active, 1, __ATOMIC_ACQ_REL) == 0 &&
+    __atomic_load_n(&scheduler->pending, __ATOMIC_ACQUIRE) == 0) {
+    pthread_mutex_lock(&scheduler->lock);
+    pthread_cond_broadcast(&scheduler->all_idle);
+    pthread_mutex_unlock(&scheduler->lock);
+  }
+}
+
+static void* sched_worker_main(void* arg) {
+  sched_worker_t* worker = (sched_worker_t*)arg;
+  ethervox_scheduler_t* scheduler = worker->scheduler;
+  tls_current_worker = worker;
+
+  for (;;) {
+    sched_task_t task;
+    if (sched_find_task(worker, &task)) {
+      sched_run_task(scheduler, &task);
+      continue;
+    }
+
+    // Nothing anywhere: park until a submitter signals. pending is
+    // re-checked under the lock so a signal between the failed search
+    // and the wait cannot be lost.
+    pthread_mutex_lock(&scheduler->lock);
+    while (scheduler->running &&
+           __atomic_load_n(&scheduler->pending, __ATOMIC_ACQUIRE) == 0) {
+      pthread_cond_wait(&scheduler->work_available, &scheduler->lock);
+    }
+    const bool keep_running =
+      scheduler->running || __atomic_load_n(&scheduler->pending, __ATOMIC_ACQUIRE) > 0;
+    pthread_mutex_unlock(&scheduler->lock);
+    if (!keep_running) {
+      break;
+    }
+  }
+
+  tls_current_worker = NULL;
+  return NULL;
+}
+
+static uint32_t sched_derive_worker_count(void) {
+  const ethervox_platform_capabilities_t caps = ethervox_platform_get_capabilities();
+  uint32_t cores = caps.cpu_core_count;
+  if (cores == 0) {
+    cores = 2;  // Capability probe unavailable; assume a small board
+  }
+  // Leave one core for the realtime audio path; it must never wait behind
+  // a stolen background task
+  uint32_t workers = cores > 1 ? cores - 1 : 1;
+  if (workers > SCHEDULER_MAX_WORKERS) {
+    workers = SCHEDULER_MAX_WORKERS;
+  }
+  return workers;
+}
+
+static pthread_mutex_t g_scheduler_lock = PTHREAD_MUTEX_INITIALIZER;
+static ethervox_scheduler_t* g_scheduler = NULL;
+static uint32_t g_scheduler_refcount = 0;
+
+static ethervox_scheduler_t* scheduler_create(void) {
+  ethervox_scheduler_t* scheduler =
+    (ethervox_scheduler_t*)calloc(1, sizeof(ethervox_scheduler_t));
+  if (!scheduler) {
+    return NULL;
+  }
+
+  pthread_mutex_init(&scheduler->lock, NULL);
+  pthread_cond_init(&scheduler->work_available, NULL);
+  pthread_cond_init(&scheduler->all_idle, NULL);
+  scheduler->running = true;
+
+  const uint32_t target = sched_derive_worker_count();
+  for (uint32_t i = 0; i < target; i++) {
+    sched_worker_t* worker = &scheduler->workers[i];
+    worker->index = i;
+    worker->scheduler = scheduler;
+    worker->steal_seed = 0x9E3779B9u ^ (i * 2654435761u);
+    if (pthread_create(&worker->thread, NULL, sched_worker_main, worker) != 0) {
+      break;
+    }
+    scheduler->worker_count++;
+  }
+
+  if (scheduler->worker_count == 0) {
+    pthread_mutex_destroy(&scheduler->lock);
+    pthread_cond_destroy(&scheduler->work_available);
+    pthread_cond_destroy(&scheduler->all_idle);
+    free(scheduler);
+    return NULL;
+  }
+  return scheduler;
+}
+
+static void scheduler_destroy(ethervox_scheduler_t* scheduler) {
+  pthread_mutex_lock(&scheduler->lock);
+  scheduler->running = false;
+  pthread_cond_broadcast(&scheduler->work_available);
+  pthread_mutex_unlock(&scheduler->lock);
+
+  for (uint32_t i = 0; i < scheduler->worker_count; i++) {
+    pthread_join(scheduler->workers[i].thread, NULL);
+  }
+  pthread_mutex_destroy(&scheduler->lock);
+  pthread_cond_destroy(&scheduler->work_available);
+  pthread_cond_destroy(&scheduler->all_idle);
+  free(scheduler);
+}
+
+ethervox_scheduler_t* ethervox_scheduler_acquire(void) {
+  pthread_mutex_lock(&g_scheduler_lock);
+  if (!g_scheduler) {
+    g_scheduler = scheduler_create();
+  }
+  if (g_scheduler) {
+    g_scheduler_refcount++;
+  }
+  ethervox_scheduler_t* scheduler = g_scheduler;
+  pthread_mutex_unlock(&g_scheduler_lock);
+  return scheduler;
+}
+
+void ethervox_scheduler_release(ethervox_scheduler_t* scheduler) {
+  if (!scheduler) {
+    return;
+  }
+  pthread_mutex_lock(&g_scheduler_lock);
+  if (scheduler == g_scheduler && g_scheduler_refcount > 0 &&
+    --g_scheduler_refcount == 0) {
+    ethervox_scheduler_t* doomed = g_scheduler;
+    g_scheduler = NULL;
+    pthread_mutex_unlock(&g_scheduler_lock);
+    scheduler_destroy(doomed);
+    return;
+  }
+  pthread_mutex_unlock(&g_scheduler_lock);
+}
+
+int ethervox_scheduler_submit(ethervox_scheduler_t* scheduler,
+                              ethervox_sched_priority_t priority,
+                              ethervox_sched_task_fn_t fn, void* arg) {
+  if (!scheduler || !fn || priority >= ETHERVOX_SCHED_PRIORITY_COUNT) {
+    return -1;
+  }
+
+  const sched_task_t task = {fn, arg};
+
+  // Count the task before it becomes visible so a worker that grabs it
+  // instantly never sees pending drop below zero
+  __atomic_add_fetch(&scheduler->pending, 1, __ATOMIC_ACQ_REL);
+
+  sched_worker_t* self = tls_current_worker;
+  if (self && self->scheduler == scheduler) {
+    if (!sched_deque_push(&self->deques[priority], task)) {
+      __atomic_sub_fetch(&scheduler->pending, 1, __ATOMIC_ACQ_REL);
+      return -1;
+    }
+  } else {
+    pthread_mutex_lock(&scheduler->lock);
+    sched_inject_queue_t* queue = &scheduler->inject[priority];
+    if (queue->count >= SCHEDULER_INJECT_CAPACITY) {
+      pthread_mutex_unlock(&scheduler->lock);
+      __atomic_sub_fetch(&scheduler->pending, 1, __ATOMIC_ACQ_REL);
+      return -1;
+    }
+    queue->items[(queue->head + queue->count) % SCHEDULER_INJECT_CAPACITY] = task;
+    queue->count++;
+    pthread_mutex_unlock(&scheduler->lock);
+  }
+
+  pthread_mutex_lock(&scheduler->lock);
+  pthread_cond_signal(&scheduler->work_available);
+  pthread_mutex_unlock(&scheduler->lock);
+  return 0;
+}
+
+void ethervox_scheduler_drain(ethervox_scheduler_t* scheduler) {
+  if (!scheduler) {
+    return;
+  }
+  pthread_mutex_lock(&scheduler->lock);
+  while (__atomic_load_n(&scheduler->pending, __ATOMIC_ACQUIRE) > 0 ||
+         __atomic_load_n(&scheduler->active, __ATOMIC_ACQUIRE) > 0) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += 10L * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000L;
+    }
+    // Timed wait: the final all_idle broadcast can race the last check,
+    // so never park here unboundedly
+    pthread_cond_timedwait(&scheduler->all_idle, &scheduler->lock, &deadline);
+  }
+  pthread_mutex_unlock(&scheduler->lock);
+}
+
+uint32_t ethervox_scheduler_worker_count(const ethervox_scheduler_t* scheduler) {
+  return scheduler ? scheduler->worker_count : 0;
+}
+
+#else  // !SCHEDULER_HAVE_PTHREAD
+
+// Single-threaded toolchains get a stub whose submit runs the task inline;
+// callers keep one code path either way
+struct ethervox_scheduler {
+  int unused;
+};
+
+static ethervox_scheduler_t g_scheduler_stub;
+
+ethervox_scheduler_t* ethervox_scheduler_acquire(void) {
+  return &g_scheduler_stub;
+}
+
+void ethervox_scheduler_release(ethervox_scheduler_t* scheduler) {
+  (void)scheduler;
+}
+
+int ethervox_scheduler_submit(ethervox_scheduler_t* scheduler,
+                              ethervox_sched_priority_t priority,
+                              ethervox_sched_task_fn_t fn, void* arg) {
+  (void)priority;
+  if (!scheduler || !fn) {
+    return -1;
+  }
+  fn(arg);
+  return 0;
+}
+
+void ethervox_scheduler_drain(ethervox_scheduler_t* scheduler) {
+  (void)scheduler;
+}
+
+uint32_t ethervox_scheduler_worker_count(const ethervox_scheduler_t* scheduler) {
+  (void)scheduler;
+  return 0;
+}
+
+#endif  // SCHEDULER_HAVE_PTHREAD
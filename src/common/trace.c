@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: CC-BY-NC-SA-4.0
+#include "ethervox/trace.h"
+#include <string.h>
+#include <time.h>
+
+// Trace ids are a process-wide counter; the origin timestamp of each live
+// turn is kept in a tiny fixed table so spans can report end-to-end latency
+// without threading the origin through every call signature.
+#define TRACE_ORIGIN_SLOTS 16  // Power of two; covers concurrent turns
+
+static volatile uint64_t g_next_trace_id = 1;
+static uint64_t g_origin_us[TRACE_ORIGIN_SLOTS];
+
+static ethervox_trace_sink_t g_sink = NULL;
+static void* g_sink_user_data = NULL;
+
+#if defined(__GNUC__) || defined(__clang__)
+#define trace_next_id() __atomic_fetch_add(&g_next_trace_id, 1, __ATOMIC_RELAXED)
+#else
+#define trace_next_id() (g_next_trace_id++)
+#endif
+
+uint64_t ethervox_trace_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000L);
+}
+
+uint64_t ethervox_trace_begin(uint64_t origin_timestamp_us) {
+    const uint64_t id = trace_next_id();
+    g_origin_us[id % TRACE_ORIGIN_SLOTS] = origin_timestamp_us;
+    return id;
+}
+
+void ethervox_trace_span(uint64_t trace_id, ethervox_trace_stage_t stage, uint64_t start_us,
+                         uint64_t end_us) {
+    if (trace_id == 0 || !g_sink) {
+        return;
+    }
+
+    ethervox_trace_span_t span;
+    span.trace_id = trace_id;
+    span.stage = stage;
+    span.origin_us = g_origin_us[trace_id % TRACE_ORIGIN_SLOTS];
+    span.start_us = start_us;
+    span.end_us = end_us;
+    g_sink(&span, g_sink_user_data);
+}
+
+void ethervox_trace_set_sink(ethervox_trace_sink_t sink, void* user_data) {
+    g_sink = sink;
+    g_sink_user_data = user_data;
+}
+
+const char* ethervox_trace_stage_to_string(ethervox_trace_stage_t stage) {
+    switch (stage) {
+        case ETHERVOX_TRACE_STAGE_CAPTURE: return "capture";
+        case ETHERVOX_TRACE_STAGE_WAKE:    return "wake";
+        case ETHERVOX_TRACE_STAGE_STT:     return "stt";
+        case ETHERVOX_TRACE_STAGE_INTENT:  return "intent";
+        case ETHERVOX_TRACE_STAGE_LLM:     return "llm";
+        case ETHERVOX_TRACE_STAGE_TTS:     return "tts";
+        default:                           return "unknown";
+    }
+}
@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include "ethervox/dialogue.h"
+#include "ethervox/trace.h"
 
 #ifndef ETHERVOX_UNUSED
 #if defined(__GNUC__)
@@ -28,8 +29,8 @@
 #endif
 #endif
 
-static const float kEthervoxIntentMatchConfidence ETHERVOX_UNUSED = 0.8f;
-static const float kEthervoxIntentUnknownConfidence ETHERVOX_UNUSED = 0.1f;
+static const float kEthervoxIntentMatchConfidence = 0.8f;
+static const float kEthervoxIntentUnknownConfidence = 0.1f;
 static const float kEthervoxResponseConfidence = 0.9f;
 static const uint32_t kEthervoxResponseProcessingTimeMs = 50U;
 static const uint32_t kEthervoxTokenEstimateDivisor = 4U;
@@ -149,6 +150,151 @@ static const intent_pattern_t INTENT_PATTERNS[] = {
     {NULL, ETHERVOX_INTENT_UNKNOWN, NULL}  // Sentinel
 };
 
+// Aho-Corasick automaton compiled from the pattern table at init time, so
+// intent classification is a single linear scan over the utterance no matter
+// how many patterns the table grows to. Nodes key on raw bytes, which keeps
+// multibyte UTF-8 patterns (e.g. the Chinese entries) working unchanged.
+// Children are kept as sibling lists: the alphabet actually used by the
+// patterns is small, so a sparse list beats a 256-entry table per node.
+typedef struct intent_ac_node {
+  unsigned char byte;
+  struct intent_ac_node* first_child;
+  struct intent_ac_node* next_sibling;
+  struct intent_ac_node* fail;
+  const intent_pattern_t* pattern;  // Non-NULL when a pattern ends at this node
+} intent_ac_node_t;
+
+typedef struct {
+  intent_ac_node_t* root;
+  uint32_t node_count;
+} intent_ac_t;
+
+static intent_ac_node_t* intent_ac_find_child(const intent_ac_node_t* node, unsigned char byte) {
+  for (intent_ac_node_t* child = node->first_child; child; child = child->next_sibling) {
+    if (child->byte == byte) {
+      return child;
+    }
+  }
+  return NULL;
+}
+
+static int intent_ac_insert(intent_ac_t* ac, const intent_pattern_t* pattern) {
+  intent_ac_node_t* node = ac->root;
+
+  for (const unsigned char* cursor = (const unsigned char*)pattern->pattern; *cursor; cursor++) {
+    intent_ac_node_t* child = intent_ac_find_child(node, *cursor);
+    if (!child) {
+      child = (intent_ac_node_t*)calloc(1, sizeof(intent_ac_node_t));
+      if (!child) {
+        return -1;
+      }
+      child->byte = *cursor;
+      child->next_sibling = node->first_child;
+      node->first_child = child;
+      ac->node_count++;
+    }
+    node = child;
+  }
+
+  if (!node->pattern) {  // First pattern for a given string wins, as in the table scan
+    node->pattern = pattern;
+  }
+  return 0;
+}
+
+// Breadth-first pass wiring the failure links once all patterns are inserted
+static int intent_ac_link_failures(intent_ac_t* ac) {
+  intent_ac_node_t** queue =
+      (intent_ac_node_t**)malloc(ac->node_count * sizeof(intent_ac_node_t*));
+  if (!queue) {
+    return -1;
+  }
+
+  uint32_t head = 0;
+  uint32_t tail = 0;
+
+  ac->root->fail = ac->root;
+  for (intent_ac_node_t* child = ac->root->first_child; child; child = child->next_sibling) {
+    child->fail = ac->root;
+    queue[tail++] = child;
+  }
+
+  while (head < tail) {
+    intent_ac_node_t* node = queue[head++];
+
+    for (intent_ac_node_t* child = node->first_child; child; child = child->next_sibling) {
+      intent_ac_node_t* fallback = node->fail;
+      while (fallback != ac->root && !intent_ac_find_child(fallback, child->byte)) {
+        fallback = fallback->fail;
+      }
+      intent_ac_node_t* target = intent_ac_find_child(fallback, child->byte);
+      child->fail = (target && target != child) ? target : ac->root;
+      queue[tail++] = child;
+    }
+  }
+
+  free(queue);
+  return 0;
+}
+
+static void intent_ac_free_nodes(intent_ac_node_t* node) {
+  while (node) {
+    intent_ac_node_t* next = node->next_sibling;
+    intent_ac_free_nodes(node->first_child);
+    free(node);
+    node = next;
+  }
+}
+
+static void intent_ac_free(intent_ac_t* ac) {
+  if (!ac) {
+    return;
+  }
+  intent_ac_free_nodes(ac->root);
+  free(ac);
+}
+
+static intent_ac_t* intent_ac_build(const intent_pattern_t* patterns) {
+  intent_ac_t* ac = (intent_ac_t*)calloc(1, sizeof(intent_ac_t));
+  if (!ac) {
+    return NULL;
+  }
+
+  ac->root = (intent_ac_node_t*)calloc(1, sizeof(intent_ac_node_t));
+  if (!ac->root) {
+    free(ac);
+    return NULL;
+  }
+
+  for (int i = 0; patterns[i].pattern != NULL; i++) {
+    if (intent_ac_insert(ac, &patterns[i]) != 0) {
+      intent_ac_free(ac);
+      return NULL;
+    }
+  }
+
+  if (intent_ac_link_failures(ac) != 0) {
+    intent_ac_free(ac);
+    return NULL;
+  }
+
+  return ac;
+}
+
+// Advance the automaton by one byte of input
+static const intent_ac_node_t* intent_ac_step(const intent_ac_t* ac,
+                                              const intent_ac_node_t* state, unsigned char byte) {
+  while (state != ac->root) {
+    const intent_ac_node_t* child = intent_ac_find_child(state, byte);
+    if (child) {
+      return child;
+    }
+    state = state->fail;
+  }
+  const intent_ac_node_t* child = intent_ac_find_child(ac->root, byte);
+  return child ? child : ac->root;
+}
+
 // Intent type to string mapping
 const char* ethervox_intent_type_to_string(ethervox_intent_type_t type) {
   switch (type) {
@@ -203,6 +349,11 @@ ethervox_llm_config_t ethervox_dialogue_get_default_llm_config(void) {
                                     .seed = ETHERVOX_LLM_SEED_DEFAULT,
                                     .use_gpu = false,  // Default to CPU for compatibility
                                     .gpu_layers = ETHERVOX_LLM_GPU_LAYERS_DEFAULT,
+                                    .use_mmap = true,
+                                    .use_mlock = false,
+                                    .use_speculative = false,
+                                    .draft_model_path = NULL,
+                                    .draft_tokens = 0,
                                   .language_code = NULL};
 
 #ifdef ETHERVOX_PLATFORM_DESKTOP
@@ -238,6 +389,191 @@ static char* generate_conversation_id(void) {
   return id;
 }
 
+// Per-turn bump arena. Every small turn-scoped string (intent text, entity
+// values, response text) comes out of one block chain that is reset in O(1)
+// at turn end, instead of a dozen strdup/free pairs per turn that fragment
+// the heap over long uptimes. New blocks are pushed at the head when the
+// current one fills; reset frees everything but the original block.
+typedef struct dialogue_arena_block {
+  struct dialogue_arena_block* next;
+  size_t capacity;
+  size_t used;
+  // Allocation bytes follow the header
+} dialogue_arena_block_t;
+
+static const size_t kEthervoxTurnArenaBlockBytes = 4096U;
+
+static dialogue_arena_block_t* dialogue_arena_block_new(size_t min_bytes) {
+  size_t capacity = kEthervoxTurnArenaBlockBytes;
+  if (capacity < min_bytes) {
+    capacity = min_bytes;
+  }
+
+  dialogue_arena_block_t* block =
+      (dialogue_arena_block_t*)malloc(sizeof(dialogue_arena_block_t) + capacity);
+  if (!block) {
+    return NULL;
+  }
+  block->next = NULL;
+  block->capacity = capacity;
+  block->used = 0;
+  return block;
+}
+
+static void* dialogue_arena_alloc(ethervox_dialogue_engine_t* engine, size_t bytes) {
+  bytes = (bytes + 7U) & ~(size_t)7U;  // Keep allocations pointer-aligned
+
+  dialogue_arena_block_t* block = (dialogue_arena_block_t*)engine->turn_arena;
+  if (!block || block->capacity - block->used < bytes) {
+    dialogue_arena_block_t* grown = dialogue_arena_block_new(bytes);
+    if (!grown) {
+      return NULL;
+    }
+    grown->next = block;
+    engine->turn_arena = grown;
+    block = grown;
+  }
+
+  void* ptr = (char*)(block + 1) + block->used;
+  block->used += bytes;
+  return ptr;
+}
+
+static char* dialogue_arena_strdup(ethervox_dialogue_engine_t* engine, const char* source) {
+  if (!source) {
+    return NULL;
+  }
+  const size_t len = strlen(source) + 1;
+  char* copy = (char*)dialogue_arena_alloc(engine, len);
+  if (copy) {
+    memcpy(copy, source, len);
+  }
+  return copy;
+}
+
+void ethervox_dialogue_reset_turn_arena(ethervox_dialogue_engine_t* engine) {
+  if (!engine) {
+    return;
+  }
+
+  dialogue_arena_block_t* block = (dialogue_arena_block_t*)engine->turn_arena;
+  while (block && block->next) {
+    dialogue_arena_block_t* next = block->next;
+    free(block);
+    block = next;
+  }
+  if (block) {
+    block->used = 0;
+  }
+  engine->turn_arena = block;
+}
+
+static void dialogue_arena_destroy(ethervox_dialogue_engine_t* engine) {
+  dialogue_arena_block_t* block = (dialogue_arena_block_t*)engine->turn_arena;
+  while (block) {
+    dialogue_arena_block_t* next = block->next;
+    free(block);
+    block = next;
+  }
+  engine->turn_arena = NULL;
+}
+
+// Open-addressed hash index from conversation_id to contexts array slot, so
+// context resolution stays O(1) as max_contexts grows. Slots hold index + 1;
+// 0 marks an empty slot and UINT32_MAX a tombstone left by a destroyed
+// context. Capacity is a power of two kept at >= 2x max_contexts, so linear
+// probe chains stay short. Tombstones are not empty slots, so probes are
+// bounded at the table capacity and the index is rebuilt once a quarter of
+// the table is tombstoned — otherwise create/destroy churn could leave no
+// zeros at all and turn every absent-id lookup into a full-table scan.
+static const uint32_t kEthervoxContextSlotTombstone = UINT32_MAX;
+
+static uint32_t context_index_hash(const char* key) {
+  // FNV-1a
+  uint32_t hash = 2166136261U;
+  while (*key) {
+    hash ^= (unsigned char)*key++;
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+static uint32_t context_index_capacity_for(uint32_t max_contexts) {
+  uint32_t capacity = 2;
+  while (capacity < max_contexts * 2) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+static void context_index_insert(ethervox_dialogue_engine_t* engine, const char* conversation_id,
+                                 uint32_t slot) {
+  const uint32_t mask = engine->context_index_capacity - 1;
+  uint32_t probe = context_index_hash(conversation_id) & mask;
+
+  while (engine->context_index[probe] != 0 &&
+         engine->context_index[probe] != kEthervoxContextSlotTombstone) {
+    probe = (probe + 1) & mask;
+  }
+  if (engine->context_index[probe] == kEthervoxContextSlotTombstone) {
+    engine->context_index_tombstones--;
+  }
+  engine->context_index[probe] = slot + 1;
+}
+
+// Returns the probe position for conversation_id, or UINT32_MAX if absent
+static uint32_t context_index_probe(const ethervox_dialogue_engine_t* engine,
+                                    const char* conversation_id) {
+  const uint32_t mask = engine->context_index_capacity - 1;
+  uint32_t probe = context_index_hash(conversation_id) & mask;
+
+  // Bounded at capacity: with enough churn every zero slot can become a
+  // tombstone, and an unbounded empty-slot-terminated scan would never exit
+  for (uint32_t step = 0; step < engine->context_index_capacity; step++) {
+    const uint32_t entry = engine->context_index[probe];
+    if (entry == 0) {
+      break;
+    }
+    if (entry != kEthervoxContextSlotTombstone &&
+        strcmp(engine->contexts[entry - 1].conversation_id, conversation_id) == 0) {
+      return probe;
+    }
+    probe = (probe + 1) & mask;
+  }
+  return UINT32_MAX;
+}
+
+// (Re)build the index and free list from the contexts array
+static int context_index_rebuild(ethervox_dialogue_engine_t* engine) {
+  const uint32_t capacity = context_index_capacity_for(engine->max_contexts);
+
+  uint32_t* index = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+  uint32_t* free_slots = (uint32_t*)malloc(engine->max_contexts * sizeof(uint32_t));
+  if (!index || !free_slots) {
+    free(index);
+    free(free_slots);
+    return -1;
+  }
+
+  free(engine->context_index);
+  free(engine->context_free_slots);
+  engine->context_index = index;
+  engine->context_index_capacity = capacity;
+  engine->context_free_slots = free_slots;
+  engine->context_free_count = 0;
+  engine->context_index_tombstones = 0;
+
+  // Push free slots in reverse so creation fills the array front-first
+  for (uint32_t i = engine->max_contexts; i > 0; i--) {
+    if (engine->contexts[i - 1].conversation_id) {
+      context_index_insert(engine, engine->contexts[i - 1].conversation_id, i - 1);
+    } else {
+      engine->context_free_slots[engine->context_free_count++] = i - 1;
+    }
+  }
+  return 0;
+}
+
 // Initialize dialogue engine
 int ethervox_dialogue_init(ethervox_dialogue_engine_t* engine,
                            const ethervox_llm_config_t* config) {
@@ -282,8 +618,21 @@ int ethervox_dialogue_init(ethervox_dialogue_engine_t* engine,
     return -1;
   }
 
-  // Initialize intent patterns (simplified - in production would load from files)
-  engine->intent_patterns = (void*)INTENT_PATTERNS;
+  if (context_index_rebuild(engine) != 0) {
+    free(engine->contexts);
+    engine->contexts = NULL;
+    return -1;
+  }
+
+  // Compile the intent pattern table into an Aho-Corasick automaton
+  engine->intent_patterns = intent_ac_build(INTENT_PATTERNS);
+  if (!engine->intent_patterns) {
+    free(engine->context_index);
+    free(engine->context_free_slots);
+    free(engine->contexts);
+    engine->contexts = NULL;
+    return -1;
+  }
 
   engine->is_initialized = true;
   printf("Dialogue engine initialized with %s model\n",
@@ -317,6 +666,18 @@ void ethervox_dialogue_cleanup(ethervox_dialogue_engine_t* engine) {
     }
     free(engine->contexts);
   }
+  free(engine->context_index);
+  engine->context_index = NULL;
+  free(engine->context_free_slots);
+  engine->context_free_slots = NULL;
+
+  // Cleanup intent automaton
+  if (engine->intent_patterns) {
+    intent_ac_free((intent_ac_t*)engine->intent_patterns);
+    engine->intent_patterns = NULL;
+  }
+
+  dialogue_arena_destroy(engine);
 
   // Cleanup LLM config
   if (engine->llm_config.model_path) {
@@ -348,42 +709,52 @@ int ethervox_dialogue_parse_intent(ethervox_dialogue_engine_t* engine,
   }
 
   const char* text = request->text;
+  const uint64_t span_start_us = ethervox_trace_now_us();
 
   memset(intent, 0, sizeof(ethervox_intent_t));
+  intent->trace_id = request->trace_id;
 
-  // Copy input text
-  intent->raw_text = strdup(text);
-  intent->normalized_text = strdup(text);  // TODO: Implement normalization
+  // Copy input text (turn-scoped, so it comes from the arena)
+  intent->arena_backed = true;
+  intent->raw_text = dialogue_arena_strdup(engine, text);
+  intent->normalized_text = dialogue_arena_strdup(engine, text);  // TODO: Implement normalization
   snprintf(intent->language_code, sizeof(intent->language_code), "%s", language_code);
 
-  // Simple pattern matching for intent detection
   intent->type = ETHERVOX_INTENT_UNKNOWN;
   intent->confidence = 0.0f;
 
-  const intent_pattern_t* patterns = (const intent_pattern_t*)engine->intent_patterns;
+  // Single scan over the text through the pattern automaton; at each position
+  // the failure chain yields every pattern ending there, longest first
+  const intent_ac_t* ac = (const intent_ac_t*)engine->intent_patterns;
+  const intent_ac_node_t* state = ac->root;
 
-  for (int i = 0; patterns[i].pattern != NULL; i++) {
-    // Check if pattern matches language
-    if (language_code && strcmp(patterns[i].language, language_code) != 0) {
-      continue;
-    }
+  for (const unsigned char* cursor = (const unsigned char*)text;
+       *cursor && intent->type == ETHERVOX_INTENT_UNKNOWN; cursor++) {
+    state = intent_ac_step(ac, state, *cursor);
 
-    // Simple substring matching (in production, would use more sophisticated NLP)
-    if (strstr(text, patterns[i].pattern) != NULL) {
-      intent->type = patterns[i].intent_type;
-      intent->confidence = 0.8f;  // Fixed confidence for demo
+    for (const intent_ac_node_t* hit = state; hit != ac->root; hit = hit->fail) {
+      if (!hit->pattern) {
+        continue;
+      }
+      if (language_code && strcmp(hit->pattern->language, language_code) != 0) {
+        continue;
+      }
+      intent->type = hit->pattern->intent_type;
+      intent->confidence = kEthervoxIntentMatchConfidence;
       break;
     }
   }
 
   // If no pattern matched, use unknown intent with low confidence
   if (intent->type == ETHERVOX_INTENT_UNKNOWN) {
-    intent->confidence = 0.1f;
+    intent->confidence = kEthervoxIntentUnknownConfidence;
   }
 
   printf("Intent parsed: %s (confidence: %.2f)\n", ethervox_intent_type_to_string(intent->type),
          intent->confidence);
 
+  ethervox_trace_span(intent->trace_id, ETHERVOX_TRACE_STAGE_INTENT, span_start_us,
+                      ethervox_trace_now_us());
   return 0;
 }
 
@@ -395,7 +766,10 @@ int ethervox_dialogue_process_llm(ethervox_dialogue_engine_t* engine,
     return -1;
   }
 
+  const uint64_t span_start_us = ethervox_trace_now_us();
+
   memset(response, 0, sizeof(ethervox_llm_response_t));
+  response->trace_id = intent->trace_id;
 
   // For demo purposes, generate simple responses based on intent type
   const char* response_text = NULL;
@@ -445,7 +819,7 @@ int ethervox_dialogue_process_llm(ethervox_dialogue_engine_t* engine,
     default:
       // For complex queries, indicate external LLM might be needed
       response->requires_external_llm = true;
-      response->external_llm_prompt = strdup(intent->raw_text);
+      response->external_llm_prompt = dialogue_arena_strdup(engine, intent->raw_text);
 
       if (strcmp(intent->language_code, "es") == 0) {
         response_text = "Lo siento, no entiendo completamente. ¿Podrías reformular?";
@@ -457,14 +831,78 @@ int ethervox_dialogue_process_llm(ethervox_dialogue_engine_t* engine,
       break;
   }
 
-  response->text = strdup(response_text);
+  response->arena_backed = true;
+  response->text = dialogue_arena_strdup(engine, response_text);
   snprintf(response->language_code, sizeof(response->language_code), "%s", intent->language_code);
   response->confidence = kEthervoxResponseConfidence;
   response->processing_time_ms = kEthervoxResponseProcessingTimeMs;  // Simulated processing time
   response->token_count = strlen(response_text) / kEthervoxTokenEstimateDivisor;  // Rough token estimate
 
+  // Record the turn in the conversation's history ring
+  if (context_id) {
+    ethervox_dialogue_context_t* ctx = NULL;
+    if (ethervox_dialogue_get_context(engine, context_id, &ctx) == 0) {
+      ethervox_dialogue_context_add_history(ctx, intent);
+      ctx->last_interaction_time = time(NULL);
+    }
+  }
+
   printf("LLM response generated: %s\n", response->text);
 
+  ethervox_trace_span(response->trace_id, ETHERVOX_TRACE_STAGE_LLM, span_start_us,
+                      ethervox_trace_now_us());
+  return 0;
+}
+
+// Streaming variant of ethervox_dialogue_process_llm(). The built-in engine
+// produces its response in one step, so this emits it to on_token in
+// clause-sized chunks (split at punctuation) to match the cadence a token
+// streaming backend produces — downstream TTS can start on the first clause.
+int ethervox_dialogue_process_llm_stream(ethervox_dialogue_engine_t* engine,
+                                         const ethervox_intent_t* intent, const char* context_id,
+                                         ethervox_dialogue_token_callback_t on_token,
+                                         void* user_data, ethervox_llm_response_t* response) {
+  if (!engine || !intent || !on_token || !response) {
+    return -1;
+  }
+
+  int result = ethervox_dialogue_process_llm(engine, intent, context_id, response);
+  if (result != 0) {
+    return result;
+  }
+
+  char* text = response->text;
+  char* chunk_start = text;
+  char* cursor = text;
+
+  while (*cursor) {
+    const char current = *cursor++;
+
+    // Clause boundary: ASCII punctuation plus any trailing spaces. Multibyte
+    // sequences never match, so UTF-8 text is chunked only at ASCII marks
+    const bool is_boundary = (current == ',' || current == '.' || current == '!' ||
+                              current == '?' || current == ';' || current == ':');
+    if (!is_boundary && *cursor != '\0') {
+      continue;
+    }
+
+    while (*cursor == ' ') {
+      cursor++;
+    }
+
+    // Emit [chunk_start, cursor) in place with a saved/restored terminator
+    const char saved = *cursor;
+    *cursor = '\0';
+    on_token(chunk_start, saved == '\0', user_data);
+    *cursor = saved;
+
+    chunk_start = cursor;
+  }
+
+  if (engine->on_response_ready) {
+    engine->on_response_ready(response, engine->callback_user_data);
+  }
+
   return 0;
 }
 
@@ -481,28 +919,179 @@ int ethervox_dialogue_create_context(ethervox_dialogue_engine_t* engine,
     language_code = engine->llm_config.language_code ? engine->llm_config.language_code : "en";
   }
 
-  // Find available context slot
-  for (uint32_t i = 0; i < engine->max_contexts; i++) {
-    ethervox_dialogue_context_t* ctx = &engine->contexts[i];
-    if (!ctx->conversation_id) {  // Empty slot
-      ctx->conversation_id = generate_conversation_id();
-      ctx->user_id = strdup(request->user_id);
-      snprintf(ctx->current_language, sizeof(ctx->current_language), "%s", language_code);
-      ctx->max_history = kEthervoxDefaultMaxHistory;
-      ctx->conversation_history =
-          (ethervox_intent_t*)calloc(ctx->max_history, sizeof(ethervox_intent_t));
-      ctx->last_interaction_time = time(NULL);
+  // Pop a free slot and index the new context by its conversation id
+  if (engine->context_free_count == 0) {
+    return -1;  // No available slots
+  }
+
+  const uint32_t slot = engine->context_free_slots[--engine->context_free_count];
+  ethervox_dialogue_context_t* ctx = &engine->contexts[slot];
+
+  ctx->conversation_id = generate_conversation_id();
+  ctx->user_id = strdup(request->user_id);
+  snprintf(ctx->current_language, sizeof(ctx->current_language), "%s", language_code);
+  ctx->max_history = kEthervoxDefaultMaxHistory;
+  ctx->conversation_history =
+      (ethervox_intent_t*)calloc(ctx->max_history, sizeof(ethervox_intent_t));
+  ctx->last_interaction_time = time(NULL);
+
+  context_index_insert(engine, ctx->conversation_id, slot);
+
+  *context_id = strdup(ctx->conversation_id);
+  engine->active_contexts++;
+
+  printf("Created dialogue context: %s for user: %s\n", ctx->conversation_id, request->user_id);
+  return 0;
+}
+
+// Look up a context by id via the hash index
+int ethervox_dialogue_get_context(ethervox_dialogue_engine_t* engine, const char* context_id,
+                                  ethervox_dialogue_context_t** context) {
+  if (!engine || !context_id || !context) {
+    return -1;
+  }
+
+  const uint32_t probe = context_index_probe(engine, context_id);
+  if (probe == UINT32_MAX) {
+    return -1;
+  }
+
+  *context = &engine->contexts[engine->context_index[probe] - 1];
+  return 0;
+}
+
+void ethervox_dialogue_destroy_context(ethervox_dialogue_engine_t* engine,
+                                       const char* context_id) {
+  if (!engine || !context_id) {
+    return;
+  }
 
-      *context_id = strdup(ctx->conversation_id);
-      engine->active_contexts++;
+  const uint32_t probe = context_index_probe(engine, context_id);
+  if (probe == UINT32_MAX) {
+    return;
+  }
 
-      printf("Created dialogue context: %s for user: %s\n", ctx->conversation_id,
-             request->user_id);
-      return 0;
+  const uint32_t slot = engine->context_index[probe] - 1;
+  ethervox_dialogue_context_t* ctx = &engine->contexts[slot];
+
+  free(ctx->conversation_id);
+  free(ctx->user_id);
+  if (ctx->conversation_history) {
+    for (uint32_t i = 0; i < ctx->history_count; i++) {
+      ethervox_intent_free(&ctx->conversation_history[i]);
     }
+    free(ctx->conversation_history);
+  }
+  memset(ctx, 0, sizeof(*ctx));
+
+  engine->context_index[probe] = kEthervoxContextSlotTombstone;
+  engine->context_free_slots[engine->context_free_count++] = slot;
+  engine->active_contexts--;
+  engine->context_index_tombstones++;
+
+  // Rehash before tombstones dominate the table; on allocation failure the
+  // bounded probe above keeps lookups correct, just slower
+  if (engine->context_index_tombstones > engine->context_index_capacity / 4) {
+    (void)context_index_rebuild(engine);
   }
+}
 
-  return -1;  // No available slots
+// History entries outlive the turn arena, so they carry their own heap copies
+static int intent_deep_copy(ethervox_intent_t* dst, const ethervox_intent_t* src) {
+  memset(dst, 0, sizeof(*dst));
+  dst->type = src->type;
+  dst->confidence = src->confidence;
+  snprintf(dst->language_code, sizeof(dst->language_code), "%s", src->language_code);
+
+  if (src->raw_text) {
+    dst->raw_text = strdup(src->raw_text);
+    if (!dst->raw_text) {
+      return -1;
+    }
+  }
+  if (src->normalized_text) {
+    dst->normalized_text = strdup(src->normalized_text);
+    if (!dst->normalized_text) {
+      ethervox_intent_free(dst);
+      return -1;
+    }
+  }
+
+  if (src->entities && src->entity_count > 0) {
+    dst->entities = (ethervox_entity_t*)calloc(src->entity_count, sizeof(ethervox_entity_t));
+    if (!dst->entities) {
+      ethervox_intent_free(dst);
+      return -1;
+    }
+    for (uint32_t i = 0; i < src->entity_count; i++) {
+      dst->entities[i] = src->entities[i];
+      dst->entities[i].value = src->entities[i].value ? strdup(src->entities[i].value) : NULL;
+      dst->entities[i].normalized_value =
+          src->entities[i].normalized_value ? strdup(src->entities[i].normalized_value) : NULL;
+      dst->entity_count++;
+    }
+  }
+
+  return 0;
+}
+
+int ethervox_dialogue_context_add_history(ethervox_dialogue_context_t* context,
+                                          const ethervox_intent_t* intent) {
+  if (!context || !context->conversation_history || !intent || context->max_history == 0) {
+    return -1;
+  }
+
+  uint32_t slot;
+  if (context->history_count < context->max_history) {
+    slot = (context->history_head + context->history_count) % context->max_history;
+  } else {
+    // Ring full: evict the oldest turn and reuse its slot in place
+    slot = context->history_head;
+    ethervox_intent_free(&context->conversation_history[slot]);
+    context->history_head = (context->history_head + 1) % context->max_history;
+  }
+
+  if (intent_deep_copy(&context->conversation_history[slot], intent) != 0) {
+    return -1;
+  }
+  if (context->history_count < context->max_history) {
+    context->history_count++;
+  }
+  return 0;
+}
+
+const ethervox_intent_t* ethervox_dialogue_context_history_at(
+    const ethervox_dialogue_context_t* context, uint32_t age) {
+  if (!context || !context->conversation_history || age >= context->history_count) {
+    return NULL;
+  }
+
+  const uint32_t newest =
+      (context->history_head + context->history_count - 1) % context->max_history;
+  const uint32_t slot = (newest + context->max_history - age) % context->max_history;
+  return &context->conversation_history[slot];
+}
+
+int ethervox_dialogue_set_max_contexts(ethervox_dialogue_engine_t* engine,
+                                       uint32_t max_contexts) {
+  if (!engine || !engine->contexts || max_contexts < engine->max_contexts) {
+    return -1;
+  }
+  if (max_contexts == engine->max_contexts) {
+    return 0;
+  }
+
+  ethervox_dialogue_context_t* grown = (ethervox_dialogue_context_t*)calloc(
+      max_contexts, sizeof(ethervox_dialogue_context_t));
+  if (!grown) {
+    return -1;
+  }
+  memcpy(grown, engine->contexts, engine->max_contexts * sizeof(ethervox_dialogue_context_t));
+  free(engine->contexts);
+  engine->contexts = grown;
+  engine->max_contexts = max_contexts;
+
+  return context_index_rebuild(engine);
 }
 
 int ethervox_dialogue_set_language(ethervox_dialogue_engine_t* engine, const char* language_code) {
@@ -560,7 +1149,17 @@ void ethervox_intent_free(ethervox_intent_t* intent) {
   if (!intent){
     return;
   }
-  
+
+  if (intent->arena_backed) {
+    // Strings live in the engine's turn arena and are released in one step
+    // by ethervox_dialogue_reset_turn_arena()
+    intent->raw_text = NULL;
+    intent->normalized_text = NULL;
+    intent->entities = NULL;
+    intent->entity_count = 0;
+    return;
+  }
+
   if (intent->raw_text) {
     free(intent->raw_text);
     intent->raw_text = NULL;
@@ -589,6 +1188,14 @@ void ethervox_llm_response_free(ethervox_llm_response_t* response) {
     return;
   }
 
+  if (response->arena_backed) {
+    response->text = NULL;
+    response->external_llm_prompt = NULL;
+    response->model_name = NULL;
+    response->finish_reason = NULL;
+    return;
+  }
+
   if (response->text) {
     free(response->text);
     response->text = NULL;
@@ -25,6 +25,11 @@
 #include <string.h>
 #include <time.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #ifdef ETHERVOX_WITH_LLAMA
 // Include llama.cpp headers if available
 #if __has_include(<llama.h>)
@@ -50,6 +55,24 @@
 #define LLAMA_DEFAULT_THREADS 4
 #define LLAMA_MAX_RESPONSE_LENGTH 4096
 
+// Conversations whose KV cache stays resident between turns
+#define LLAMA_KV_CACHE_SLOTS 4
+
+// Speculative decoding: tokens drafted by the small model per verify pass
+#define LLAMA_DEFAULT_DRAFT_TOKENS 4
+#define LLAMA_MAX_DRAFT_TOKENS 8
+
+#if defined(ETHERVOX_WITH_LLAMA) && LLAMA_HEADER_AVAILABLE
+// One resident conversation: the token sequence currently in the KV cache
+// for seq_id = slot index + 1 (seq 0 is reserved for uncached generation)
+typedef struct {
+  char* conversation_id;
+  llama_token* tokens;
+  int n_tokens;
+  uint64_t last_used;
+} llama_kv_slot_t;
+#endif
+
 // Llama backend context
 typedef struct {
 #if defined(ETHERVOX_WITH_LLAMA) && LLAMA_HEADER_AVAILABLE
@@ -57,6 +80,16 @@ typedef struct {
   struct llama_context* ctx;
   struct llama_context_params ctx_params;
   struct llama_model_params model_params;
+
+  // Cross-turn context caching, keyed by conversation_id (LRU eviction)
+  llama_kv_slot_t kv_slots[LLAMA_KV_CACHE_SLOTS];
+  uint64_t kv_use_counter;
+
+  // Speculative decoding draft model (NULL when disabled or load failed)
+  struct llama_model* draft_model;
+  struct llama_context* draft_ctx;
+  uint64_t spec_drafted;   // Draft tokens proposed
+  uint64_t spec_accepted;  // Draft tokens the main model agreed with
 #else
   void* model;  // Placeholder when llama.cpp not available
   void* ctx;
@@ -70,7 +103,10 @@ typedef struct {
   uint32_t n_gpu_layers;
   uint32_t n_threads;
   uint32_t seed;
-  
+  bool use_speculative;
+  char* draft_model_path;
+  uint32_t n_draft;
+
   // State
   char* loaded_model_path;
   bool use_mlock;
@@ -87,8 +123,28 @@ static int llama_backend_generate(ethervox_llm_backend_t* backend,
                                  const char* prompt,
                                  const char* language_code,
                                  ethervox_llm_response_t* response);
+static int llama_backend_generate_stream(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        void (*callback)(const char* token, void* user_data),
+                                        void* user_data);
+static int llama_backend_generate_cached(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        const char* conversation_id,
+                                        ethervox_llm_response_t* response);
+static int llama_backend_generate_batch(ethervox_llm_backend_t* backend,
+                                       struct ethervox_llm_batch_request* requests,
+                                       uint32_t request_count);
+static int llama_backend_tokenize(ethervox_llm_backend_t* backend,
+                                 const char* text,
+                                 int32_t* tokens,
+                                 uint32_t capacity);
 static int llama_backend_get_capabilities(ethervox_llm_backend_t* backend,
                                         ethervox_llm_capabilities_t* capabilities);
+#if defined(ETHERVOX_WITH_LLAMA) && LLAMA_HEADER_AVAILABLE
+static void llama_kv_slots_free(llama_backend_context_t* ctx);
+#endif
 
 // Create Llama backend instance
 ethervox_llm_backend_t* ethervox_llm_create_llama_backend(void) {
@@ -105,6 +161,10 @@ ethervox_llm_backend_t* ethervox_llm_create_llama_backend(void) {
   backend->load_model = llama_backend_load_model;
   backend->unload_model = llama_backend_unload_model;
   backend->generate = llama_backend_generate;
+  backend->generate_stream = llama_backend_generate_stream;
+  backend->generate_cached = llama_backend_generate_cached;
+  backend->generate_batch = llama_backend_generate_batch;
+  backend->tokenize = llama_backend_tokenize;
   backend->get_capabilities = llama_backend_get_capabilities;
   backend->is_initialized = false;
   backend->is_loaded = false;
@@ -137,6 +197,16 @@ static int llama_backend_init(ethervox_llm_backend_t* backend, const ethervox_ll
     ctx->top_p = config->top_p > 0.0f ? config->top_p : LLAMA_DEFAULT_TOP_P;
     ctx->n_gpu_layers = config->use_gpu ? config->gpu_layers : LLAMA_DEFAULT_GPU_LAYERS;
     ctx->seed = config->seed > 0 ? config->seed : (uint32_t)time(NULL);
+    ctx->use_mmap = config->use_mmap;
+    ctx->use_mlock = config->use_mlock;
+    ctx->use_speculative = config->use_speculative && config->draft_model_path;
+    if (ctx->use_speculative) {
+      ctx->draft_model_path = strdup(config->draft_model_path);
+    }
+    ctx->n_draft = config->draft_tokens > 0 ? config->draft_tokens : LLAMA_DEFAULT_DRAFT_TOKENS;
+    if (ctx->n_draft > LLAMA_MAX_DRAFT_TOKENS) {
+      ctx->n_draft = LLAMA_MAX_DRAFT_TOKENS;
+    }
   } else {
     ctx->n_ctx = LLAMA_DEFAULT_CONTEXT_LENGTH;
     ctx->n_predict = LLAMA_DEFAULT_MAX_TOKENS;
@@ -144,12 +214,13 @@ static int llama_backend_init(ethervox_llm_backend_t* backend, const ethervox_ll
     ctx->top_p = LLAMA_DEFAULT_TOP_P;
     ctx->n_gpu_layers = LLAMA_DEFAULT_GPU_LAYERS;
     ctx->seed = (uint32_t)time(NULL);
+    ctx->use_mmap = true;
+    ctx->use_mlock = false;
+    ctx->n_draft = LLAMA_DEFAULT_DRAFT_TOKENS;
   }
-  
+
   ctx->n_threads = LLAMA_DEFAULT_THREADS;
-  ctx->use_mlock = false;
-  ctx->use_mmap = true;
-  
+
   // Initialize llama backend
   llama_backend_init();
   
@@ -170,23 +241,40 @@ static void llama_backend_cleanup(ethervox_llm_backend_t* backend) {
   
 #if defined(ETHERVOX_WITH_LLAMA) && LLAMA_HEADER_AVAILABLE
   llama_backend_context_t* ctx = (llama_backend_context_t*)backend->handle;
-  
+
+  llama_kv_slots_free(ctx);
+
   // Unload model if loaded
   if (ctx->ctx) {
     llama_free(ctx->ctx);
     ctx->ctx = NULL;
   }
-  
+
   if (ctx->model) {
     llama_free_model(ctx->model);
     ctx->model = NULL;
   }
-  
+
+  if (ctx->draft_ctx) {
+    llama_free(ctx->draft_ctx);
+    ctx->draft_ctx = NULL;
+  }
+
+  if (ctx->draft_model) {
+    llama_free_model(ctx->draft_model);
+    ctx->draft_model = NULL;
+  }
+
+  if (ctx->draft_model_path) {
+    free(ctx->draft_model_path);
+    ctx->draft_model_path = NULL;
+  }
+
   if (ctx->loaded_model_path) {
     free(ctx->loaded_model_path);
     ctx->loaded_model_path = NULL;
   }
-  
+
   // Cleanup llama backend
   llama_backend_free();
   
@@ -201,6 +289,30 @@ static void llama_backend_cleanup(ethervox_llm_backend_t* backend) {
 #endif
 }
 
+#if defined(ETHERVOX_WITH_LLAMA) && LLAMA_HEADER_AVAILABLE
+// Ask the kernel to read the weights into the page cache ahead of the
+// mmap'd first-touch, so cold start pays sequential readahead instead of
+// random page faults as tensors are walked. llama.cpp owns the mapping, so
+// this advises on the file rather than the mapped region (the effect on the
+// page cache is the same). Best effort: a failure just means slower faults.
+static void llama_prefetch_model_file(const char* model_path) {
+#if defined(__unix__) || defined(__APPLE__)
+  int fd = open(model_path, O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+#if defined(POSIX_FADV_WILLNEED)
+  if (posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED) != 0) {
+    ETHERVOX_LOG_WARN("Model prefetch advice failed for %s", model_path);
+  }
+#endif
+  close(fd);
+#else
+  (void)model_path;
+#endif
+}
+#endif  // ETHERVOX_WITH_LLAMA && LLAMA_HEADER_AVAILABLE
+
 static int llama_backend_load_model(ethervox_llm_backend_t* backend, const char* model_path) {
   if (!backend || !backend->handle || !model_path) {
     return ETHERVOX_ERROR_INVALID_ARGUMENT;
@@ -225,7 +337,12 @@ static int llama_backend_load_model(ethervox_llm_backend_t* backend, const char*
   ctx->model_params.n_gpu_layers = ctx->n_gpu_layers;
   ctx->model_params.use_mlock = ctx->use_mlock;
   ctx->model_params.use_mmap = ctx->use_mmap;
-  
+
+  if (ctx->use_mmap) {
+    ETHERVOX_LOG_INFO("Using mmap model loading%s", ctx->use_mlock ? " with mlock pinning" : "");
+    llama_prefetch_model_file(model_path);
+  }
+
   // Load model
   ctx->model = llama_load_model_from_file(model_path, ctx->model_params);
   if (!ctx->model) {
@@ -248,13 +365,46 @@ static int llama_backend_load_model(ethervox_llm_backend_t* backend, const char*
     return ETHERVOX_ERROR_FAILED;
   }
   
+  // Load the speculative draft model alongside (CPU-only; it is small and
+  // runs interleaved with the main model, so GPU offload buys nothing)
+  if (ctx->use_speculative && ctx->draft_model_path) {
+    struct llama_model_params draft_model_params = llama_model_default_params();
+    draft_model_params.use_mmap = ctx->use_mmap;
+
+    if (ctx->use_mmap) {
+      llama_prefetch_model_file(ctx->draft_model_path);
+    }
+
+    ctx->draft_model = llama_load_model_from_file(ctx->draft_model_path, draft_model_params);
+    if (ctx->draft_model) {
+      struct llama_context_params draft_ctx_params = llama_context_default_params();
+      draft_ctx_params.n_ctx = ctx->n_ctx;
+      draft_ctx_params.n_threads = ctx->n_threads;
+      draft_ctx_params.seed = ctx->seed;
+      ctx->draft_ctx = llama_new_context_with_model(ctx->draft_model, draft_ctx_params);
+    }
+
+    if (ctx->draft_ctx) {
+      ETHERVOX_LOG_INFO("Speculative decoding enabled (draft: %s, %u tokens per pass)",
+                        ctx->draft_model_path, ctx->n_draft);
+    } else {
+      // Generation still works without the draft model, just token by token
+      ETHERVOX_LOG_WARN("Failed to load draft model %s; speculative decoding disabled",
+                        ctx->draft_model_path);
+      if (ctx->draft_model) {
+        llama_free_model(ctx->draft_model);
+        ctx->draft_model = NULL;
+      }
+    }
+  }
+
   // Save model path
   ctx->loaded_model_path = strdup(model_path);
   backend->is_loaded = true;
-  
+
   ETHERVOX_LOG_INFO("Llama model loaded successfully");
   ETHERVOX_LOG_INFO("Context size: %u, GPU layers: %u", ctx->n_ctx, ctx->n_gpu_layers);
-  
+
   return ETHERVOX_SUCCESS;
 #endif
 }
@@ -266,41 +416,310 @@ static void llama_backend_unload_model(ethervox_llm_backend_t* backend) {
   
 #if defined(ETHERVOX_WITH_LLAMA) && LLAMA_HEADER_AVAILABLE
   llama_backend_context_t* ctx = (llama_backend_context_t*)backend->handle;
-  
+
+  llama_kv_slots_free(ctx);
+
   if (ctx->ctx) {
     llama_free(ctx->ctx);
     ctx->ctx = NULL;
   }
-  
+
   if (ctx->model) {
     llama_free_model(ctx->model);
     ctx->model = NULL;
   }
-  
+
+  if (ctx->draft_ctx) {
+    llama_free(ctx->draft_ctx);
+    ctx->draft_ctx = NULL;
+  }
+
+  if (ctx->draft_model) {
+    llama_free_model(ctx->draft_model);
+    ctx->draft_model = NULL;
+  }
+
+  if (ctx->spec_drafted > 0) {
+    ETHERVOX_LOG_INFO("Speculative decoding: %llu/%llu draft tokens accepted (%.0f%%)",
+                      (unsigned long long)ctx->spec_accepted,
+                      (unsigned long long)ctx->spec_drafted,
+                      (double)ctx->spec_accepted / (double)ctx->spec_drafted * 100.0);
+    ctx->spec_drafted = 0;
+    ctx->spec_accepted = 0;
+  }
+
   if (ctx->loaded_model_path) {
     free(ctx->loaded_model_path);
     ctx->loaded_model_path = NULL;
   }
-  
+
   backend->is_loaded = false;
   
   ETHERVOX_LOG_INFO("Llama model unloaded");
 #endif
 }
 
-static int llama_backend_generate(ethervox_llm_backend_t* backend,
-                                 const char* prompt,
-                                 const char* language_code,
-                                 ethervox_llm_response_t* response) {
-  if (!backend || !backend->handle || !prompt || !response) {
-    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+#if defined(ETHERVOX_WITH_LLAMA) && LLAMA_HEADER_AVAILABLE
+
+// Release everything held for resident conversations; called whenever the
+// underlying llama context goes away
+static void llama_kv_slots_free(llama_backend_context_t* ctx) {
+  for (int i = 0; i < LLAMA_KV_CACHE_SLOTS; i++) {
+    free(ctx->kv_slots[i].conversation_id);
+    free(ctx->kv_slots[i].tokens);
+    memset(&ctx->kv_slots[i], 0, sizeof(ctx->kv_slots[i]));
   }
-  
+}
+
+// Find the slot for conversation_id, or evict the least recently used one
+static llama_kv_slot_t* llama_kv_slot_acquire(llama_backend_context_t* ctx,
+                                              const char* conversation_id) {
+  llama_kv_slot_t* victim = &ctx->kv_slots[0];
+
+  for (int i = 0; i < LLAMA_KV_CACHE_SLOTS; i++) {
+    llama_kv_slot_t* slot = &ctx->kv_slots[i];
+    if (slot->conversation_id && strcmp(slot->conversation_id, conversation_id) == 0) {
+      slot->last_used = ++ctx->kv_use_counter;
+      return slot;
+    }
+    if (!victim->conversation_id) {
+      continue;  // Already found an empty slot; keep it
+    }
+    if (!slot->conversation_id || slot->last_used < victim->last_used) {
+      victim = slot;
+    }
+  }
+
+  if (victim->conversation_id) {
+    llama_kv_cache_seq_rm(ctx->ctx, (llama_seq_id)((victim - ctx->kv_slots) + 1), -1, -1);
+    free(victim->conversation_id);
+    free(victim->tokens);
+  }
+
+  memset(victim, 0, sizeof(*victim));
+  victim->conversation_id = strdup(conversation_id);
+  victim->last_used = ++ctx->kv_use_counter;
+  return victim;
+}
+
+// Append one decoded token's text to the response buffer and forward it to
+// the streaming callback; shared by the plain and speculative decode loops
+static void llama_emit_token(llama_backend_context_t* ctx, llama_token token,
+                             char* response_text, size_t* response_len,
+                             void (*on_token)(const char* token, void* user_data),
+                             void* user_data) {
+  char piece[256];
+  const int n_piece = llama_token_to_piece(ctx->model, token, piece, sizeof(piece), false);
+  if (n_piece <= 0) {
+    return;
+  }
+
+  if (*response_len + n_piece < LLAMA_MAX_RESPONSE_LENGTH - 1) {
+    memcpy(response_text + *response_len, piece, n_piece);
+    *response_len += n_piece;
+    response_text[*response_len] = '\0';
+  }
+
+  if (on_token) {
+    char token_text[sizeof(piece) + 1];
+    memcpy(token_text, piece, n_piece);
+    token_text[n_piece] = '\0';
+    on_token(token_text, user_data);
+  }
+}
+
+// Speculative decode loop: the draft model proposes up to n_draft tokens,
+// which the main model verifies in a single batched llama_decode instead of
+// one decode per token. Only tokens the main model sampled itself are ever
+// emitted, so the output matches the plain loop exactly; every accepted
+// draft token is a main-model forward pass saved. The draft context runs its
+// own copy of the sequence on seq 0 and is rolled back in lockstep.
+//
+// The caller has already decoded the prompt on both contexts. Returns the
+// number of generated tokens; *finished is true when generation hit
+// end-of-generation rather than the n_predict budget.
+static int llama_speculative_generate(llama_backend_context_t* ctx, llama_seq_id seq_id,
+                                      llama_kv_slot_t** slot_ref, int n_prompt,
+                                      char* response_text, size_t* response_len,
+                                      void (*on_token)(const char* token, void* user_data),
+                                      void* user_data, bool* finished) {
+  int n_generated = 0;
+  int n_past = n_prompt;        // Main-model tokens resident for this turn
+  int draft_past = n_prompt;    // Draft-model tokens resident
+  bool draft_ok = true;         // Cleared when the draft context falls out of step
+
+  llama_batch verify = llama_batch_init((int32_t)ctx->n_draft + 1, 0, 1);
+
+  // The token the main model wants next, sampled from the prompt logits
+  llama_token cur = llama_sampler_sample(llama_sampler_chain_default_params(), ctx->ctx, 0);
+
+  while (n_generated < (int)ctx->n_predict) {
+    if (llama_token_is_eog(ctx->model, cur)) {
+      *finished = true;
+      break;
+    }
+
+    llama_emit_token(ctx, cur, response_text, response_len, on_token, user_data);
+    n_generated++;
+    if (n_generated >= (int)ctx->n_predict) {
+      break;  // Budget exhausted; cur need not become resident
+    }
+
+    // Draft up to k tokens following cur on the small model
+    int k = (int)ctx->n_draft;
+    if (n_past + 1 + k > (int)ctx->n_ctx) {
+      k = (int)ctx->n_ctx - n_past - 1;
+    }
+    if (k > (int)ctx->n_predict - n_generated) {
+      k = (int)ctx->n_predict - n_generated;
+    }
+
+    llama_token draft[LLAMA_MAX_DRAFT_TOKENS];
+    int n_drafted = 0;
+    llama_token d_prev = cur;
+    for (int j = 0; draft_ok && j < k; j++) {
+      if (llama_decode(ctx->draft_ctx,
+                       llama_batch_get_one(&d_prev, 1, draft_past + j, 0)) != 0) {
+        // A draft decode failure leaves the draft context out of step with
+        // the main model; stop drafting for the rest of this turn
+        draft_ok = false;
+        break;
+      }
+      draft[n_drafted] = llama_sampler_sample(llama_sampler_chain_default_params(),
+                                              ctx->draft_ctx, 0);
+      d_prev = draft[n_drafted];
+      n_drafted++;
+    }
+    ctx->spec_drafted += (uint64_t)n_drafted;
+
+    if (n_drafted == 0) {
+      // Drafting unavailable this step (context full or draft decode error);
+      // fall back to a plain single-token decode
+      if (llama_decode(ctx->ctx, llama_batch_get_one(&cur, 1, n_past, seq_id)) != 0) {
+        ETHERVOX_LOG_WARN("Failed to evaluate token at position %d", n_past - n_prompt);
+        *slot_ref = NULL;
+        break;
+      }
+      if (*slot_ref) {
+        (*slot_ref)->tokens[(*slot_ref)->n_tokens++] = cur;
+      }
+      n_past++;
+      cur = llama_sampler_sample(llama_sampler_chain_default_params(), ctx->ctx, 0);
+      continue;
+    }
+
+    // Verify cur plus the draft run in one main-model decode; row i holds the
+    // logits following token i of the batch
+    verify.n_tokens = n_drafted + 1;
+    verify.token[0] = cur;
+    verify.pos[0] = n_past;
+    verify.n_seq_id[0] = 1;
+    verify.seq_id[0][0] = seq_id;
+    verify.logits[0] = true;
+    for (int j = 0; j < n_drafted; j++) {
+      verify.token[j + 1] = draft[j];
+      verify.pos[j + 1] = n_past + 1 + j;
+      verify.n_seq_id[j + 1] = 1;
+      verify.seq_id[j + 1][0] = seq_id;
+      verify.logits[j + 1] = true;
+    }
+
+    if (llama_decode(ctx->ctx, verify) != 0) {
+      ETHERVOX_LOG_WARN("Speculative verify decode failed at position %d", n_past - n_prompt);
+      *slot_ref = NULL;
+      break;
+    }
+
+    // Accept the longest prefix where the main model's own sample agrees
+    // with the draft; its first disagreeing sample becomes the next cur
+    int accepted = 0;
+    llama_token next;
+    for (;;) {
+      next = llama_sampler_sample(llama_sampler_chain_default_params(), ctx->ctx, accepted);
+      if (accepted >= n_drafted || next != draft[accepted]) {
+        break;
+      }
+      accepted++;
+    }
+    ctx->spec_accepted += (uint64_t)accepted;
+
+    // cur and the accepted draft tokens are now legitimately resident;
+    // rejected rows get dropped from the KV cache
+    if (*slot_ref) {
+      (*slot_ref)->tokens[(*slot_ref)->n_tokens++] = cur;
+    }
+    n_past++;
+    for (int j = 0; j < accepted; j++) {
+      if (llama_token_is_eog(ctx->model, draft[j])) {
+        *finished = true;
+        break;
+      }
+      llama_emit_token(ctx, draft[j], response_text, response_len, on_token, user_data);
+      n_generated++;
+      if (*slot_ref) {
+        (*slot_ref)->tokens[(*slot_ref)->n_tokens++] = draft[j];
+      }
+      n_past++;
+    }
+    if (*finished) {
+      break;
+    }
+    if (accepted < n_drafted) {
+      llama_kv_cache_seq_rm(ctx->ctx, seq_id, n_past, -1);
+    }
+
+    // Keep the draft context in lockstep: it decoded cur plus the first
+    // n_drafted - 1 proposals; drop whatever was rejected, and decode the
+    // final proposal if the whole run was accepted
+    if (accepted == n_drafted) {
+      if (llama_decode(ctx->draft_ctx, llama_batch_get_one(&draft[n_drafted - 1], 1,
+                                                           draft_past + n_drafted, 0)) != 0) {
+        llama_kv_cache_seq_rm(ctx->draft_ctx, 0, draft_past + n_drafted, -1);
+      }
+    } else {
+      llama_kv_cache_seq_rm(ctx->draft_ctx, 0, draft_past + 1 + accepted, -1);
+    }
+    draft_past += 1 + accepted;
+
+    cur = next;
+  }
+
+  llama_batch_free(verify);
+  return n_generated;
+}
+
+#endif  // ETHERVOX_WITH_LLAMA && LLAMA_HEADER_AVAILABLE
+
+// Shared decode loop for the blocking and streaming entry points. When
+// on_token is set, each decoded piece is forwarded as soon as it is sampled
+// (before the next llama_decode), so the caller can begin TTS on the first
+// clause while the rest of the response generates. response may be NULL for
+// pure streaming callers.
+//
+// With a conversation_id, the turn runs on that conversation's KV-cache
+// sequence: the longest common prefix between the new prompt and the tokens
+// already resident is skipped, so only the new user utterance (and anything
+// that diverged) is prefilled. Without one, seq 0 is cleared and the whole
+// prompt is evaluated as before.
+static int llama_generate_tokens(ethervox_llm_backend_t* backend,
+                                const char* prompt,
+                                const char* language_code,
+                                const char* conversation_id,
+                                ethervox_llm_response_t* response,
+                                void (*on_token)(const char* token, void* user_data),
+                                void* user_data) {
 #if !defined(ETHERVOX_WITH_LLAMA) || !LLAMA_HEADER_AVAILABLE
+  (void)backend;
+  (void)prompt;
+  (void)language_code;
+  (void)conversation_id;
+  (void)response;
+  (void)on_token;
+  (void)user_data;
   ETHERVOX_LOG_ERROR("Llama backend not available");
   return ETHERVOX_ERROR_NOT_IMPLEMENTED;
 #else
-  
+
   llama_backend_context_t* ctx = (llama_backend_context_t*)backend->handle;
   
   if (!ctx->ctx || !ctx->model) {
@@ -335,7 +754,33 @@ static int llama_backend_generate(ethervox_llm_backend_t* backend,
     free(prompt_tokens);
     return ETHERVOX_ERROR_FAILED;
   }
-  
+
+  // Resolve the KV-cache sequence for this turn
+  llama_seq_id seq_id = 0;
+  llama_kv_slot_t* slot = NULL;
+  int n_cached = 0;
+
+  if (conversation_id) {
+    slot = llama_kv_slot_acquire(ctx, conversation_id);
+    seq_id = (llama_seq_id)((slot - ctx->kv_slots) + 1);
+
+    // Skip the prefix already resident for this conversation (system prompt
+    // and earlier turns); always leave at least one token to decode so the
+    // sampler has fresh logits
+    const int max_common = slot->n_tokens < n_tokens ? slot->n_tokens : n_tokens;
+    while (n_cached < max_common && slot->tokens[n_cached] == prompt_tokens[n_cached]) {
+      n_cached++;
+    }
+    if (n_cached == n_tokens) {
+      n_cached = n_tokens - 1;
+    }
+
+    // Drop whatever diverged beyond the shared prefix
+    llama_kv_cache_seq_rm(ctx->ctx, seq_id, n_cached, -1);
+  } else {
+    llama_kv_cache_seq_rm(ctx->ctx, seq_id, 0, -1);
+  }
+
   // Allocate response buffer
   char* response_text = (char*)malloc(LLAMA_MAX_RESPONSE_LENGTH);
   if (!response_text) {
@@ -347,20 +792,58 @@ static int llama_backend_generate(ethervox_llm_backend_t* backend,
   response_text[0] = '\0';
   size_t response_len = 0;
   
-  // Evaluate prompt
-  if (llama_decode(ctx->ctx, llama_batch_get_one(prompt_tokens, n_tokens, 0, 0)) != 0) {
+  // Evaluate prompt (only the portion not already resident)
+  if (llama_decode(ctx->ctx, llama_batch_get_one(prompt_tokens + n_cached, n_tokens - n_cached,
+                                                 n_cached, seq_id)) != 0) {
     ETHERVOX_LOG_ERROR("Failed to evaluate prompt");
     free(prompt_tokens);
     free(response_text);
     return ETHERVOX_ERROR_FAILED;
   }
-  
+
+  if (slot) {
+    ETHERVOX_LOG_INFO("KV cache: %d/%d prompt tokens already resident for %s", n_cached, n_tokens,
+                      conversation_id);
+
+    // The full prompt is now resident; reserve room for generated tokens too
+    llama_token* resident =
+        (llama_token*)malloc(((size_t)n_tokens + ctx->n_predict) * sizeof(llama_token));
+    if (resident) {
+      memcpy(resident, prompt_tokens, (size_t)n_tokens * sizeof(llama_token));
+      free(slot->tokens);
+      slot->tokens = resident;
+      slot->n_tokens = n_tokens;
+    } else {
+      // Residency can't be tracked; the next turn re-evaluates from scratch
+      free(slot->tokens);
+      slot->tokens = NULL;
+      slot->n_tokens = 0;
+      slot = NULL;
+    }
+  }
+
+  // Prefill the draft context while the prompt tokens are still around. The
+  // draft model is small enough that a full re-prefill per turn is cheaper
+  // than mirroring the main model's cross-turn cache bookkeeping.
+  bool speculative = ctx->draft_ctx != NULL;
+  if (speculative) {
+    llama_kv_cache_seq_rm(ctx->draft_ctx, 0, 0, -1);
+    if (llama_decode(ctx->draft_ctx, llama_batch_get_one(prompt_tokens, n_tokens, 0, 0)) != 0) {
+      ETHERVOX_LOG_WARN("Draft model prompt evaluation failed; decoding without speculation");
+      speculative = false;
+    }
+  }
+
   free(prompt_tokens);
-  
+
   // Generate tokens
   int n_generated = 0;
   bool finished = false;
-  
+
+  if (speculative) {
+    n_generated = llama_speculative_generate(ctx, seq_id, &slot, n_tokens, response_text,
+                                             &response_len, on_token, user_data, &finished);
+  } else {
   for (int i = 0; i < (int)ctx->n_predict && !finished; i++) {
     // Sample next token
     llama_token new_token = llama_sampler_sample(
@@ -368,37 +851,40 @@ static int llama_backend_generate(ethervox_llm_backend_t* backend,
       ctx->ctx,
       0
     );
-    
+
     // Check for end of generation
     if (llama_token_is_eog(ctx->model, new_token)) {
       finished = true;
       break;
     }
-    
-    // Decode token to text
-    char piece[256];
-    int n_piece = llama_token_to_piece(ctx->model, new_token, piece, sizeof(piece), false);
-    
-    if (n_piece > 0) {
-      if (response_len + n_piece < LLAMA_MAX_RESPONSE_LENGTH - 1) {
-        memcpy(response_text + response_len, piece, n_piece);
-        response_len += n_piece;
-        response_text[response_len] = '\0';
-      }
-    }
-    
+
+    llama_emit_token(ctx, new_token, response_text, &response_len, on_token, user_data);
+
     // Evaluate next token
-    if (llama_decode(ctx->ctx, llama_batch_get_one(&new_token, 1, n_tokens + i, 0)) != 0) {
+    if (llama_decode(ctx->ctx, llama_batch_get_one(&new_token, 1, n_tokens + i, seq_id)) != 0) {
       ETHERVOX_LOG_WARN("Failed to evaluate token at position %d", i);
       break;
     }
-    
+
     n_generated++;
+
+    // The decode above made this token resident; keep the bookkeeping in sync
+    if (slot) {
+      slot->tokens[slot->n_tokens++] = new_token;
+    }
+  }
   }
   
   clock_t end_time = clock();
   uint32_t processing_time = (uint32_t)(((double)(end_time - start_time) / CLOCKS_PER_SEC) * 1000);
-  
+
+  // Pure streaming callers already received every piece via on_token
+  if (!response) {
+    free(response_text);
+    ETHERVOX_LOG_INFO("Streamed %d tokens in %u ms", n_generated, processing_time);
+    return ETHERVOX_SUCCESS;
+  }
+
   // Fill response structure
   response->text = response_text;
   response->confidence = 0.9f;  // High confidence for local model
@@ -418,11 +904,233 @@ static int llama_backend_generate(ethervox_llm_backend_t* backend,
   }
   
   ETHERVOX_LOG_INFO("Generated %d tokens in %u ms", n_generated, processing_time);
-  
+
   return ETHERVOX_SUCCESS;
 #endif
 }
 
+static int llama_backend_generate(ethervox_llm_backend_t* backend,
+                                 const char* prompt,
+                                 const char* language_code,
+                                 ethervox_llm_response_t* response) {
+  if (!backend || !backend->handle || !prompt || !response) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  return llama_generate_tokens(backend, prompt, language_code, NULL, response, NULL, NULL);
+}
+
+static int llama_backend_generate_stream(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        void (*callback)(const char* token, void* user_data),
+                                        void* user_data) {
+  if (!backend || !backend->handle || !prompt || !callback) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  return llama_generate_tokens(backend, prompt, language_code, NULL, NULL, callback, user_data);
+}
+
+static int llama_backend_generate_cached(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        const char* conversation_id,
+                                        ethervox_llm_response_t* response) {
+  if (!backend || !backend->handle || !prompt || !response) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  return llama_generate_tokens(backend, prompt, language_code, conversation_id, response,
+                               NULL, NULL);
+}
+
+// Batched multi-session decode: every active request contributes one token
+// per llama_decode call, so N sessions share each forward pass instead of
+// running N full generations back to back. Lanes use sequence ids above the
+// conversation KV slots and are cleared afterwards, so batch turns do not
+// disturb cached conversations (conversation_id is not made resident here).
+static int llama_backend_generate_batch(ethervox_llm_backend_t* backend,
+                                       struct ethervox_llm_batch_request* requests,
+                                       uint32_t request_count) {
+  if (!backend || !backend->handle || !requests || request_count == 0) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+#if !defined(ETHERVOX_WITH_LLAMA) || !LLAMA_HEADER_AVAILABLE
+  ETHERVOX_LOG_ERROR("Llama backend not available");
+  return ETHERVOX_ERROR_NOT_IMPLEMENTED;
+#else
+
+  llama_backend_context_t* ctx = (llama_backend_context_t*)backend->handle;
+
+  if (!ctx->ctx || !ctx->model) {
+    ETHERVOX_LOG_ERROR("Model not loaded");
+    return ETHERVOX_ERROR_NOT_INITIALIZED;
+  }
+
+  typedef struct {
+    llama_seq_id seq_id;
+    int n_tokens;       // Prompt tokens resident so far
+    int logit_index;    // This lane's output row in the last decode
+    bool active;
+  } llama_batch_lane_t;
+
+  llama_batch_lane_t* lanes =
+      (llama_batch_lane_t*)calloc(request_count, sizeof(llama_batch_lane_t));
+  if (!lanes) {
+    ETHERVOX_LOG_ERROR("Failed to allocate batch lanes");
+    return ETHERVOX_ERROR_OUT_OF_MEMORY;
+  }
+
+  // Prefill each prompt on its own sequence. Prompts differ, so prefill is
+  // per lane; the shared batching pays off in the decode loop below.
+  uint32_t n_active = 0;
+  for (uint32_t i = 0; i < request_count; i++) {
+    requests[i].status = ETHERVOX_ERROR_FAILED;
+    lanes[i].seq_id = (llama_seq_id)(LLAMA_KV_CACHE_SLOTS + 1 + i);
+    llama_kv_cache_seq_rm(ctx->ctx, lanes[i].seq_id, -1, -1);
+
+    if (!requests[i].prompt) {
+      requests[i].status = ETHERVOX_ERROR_INVALID_ARGUMENT;
+      continue;
+    }
+
+    const char* prompt = requests[i].prompt;
+    const int n_prompt_tokens = -llama_tokenize(ctx->model, prompt, (int)strlen(prompt),
+                                                NULL, 0, true, true);
+    if (n_prompt_tokens <= 0) {
+      ETHERVOX_LOG_WARN("Failed to tokenize batch prompt %u", i);
+      continue;
+    }
+
+    llama_token* prompt_tokens = (llama_token*)malloc(n_prompt_tokens * sizeof(llama_token));
+    if (!prompt_tokens) {
+      requests[i].status = ETHERVOX_ERROR_OUT_OF_MEMORY;
+      continue;
+    }
+
+    const int n_tokens = llama_tokenize(ctx->model, prompt, (int)strlen(prompt),
+                                        prompt_tokens, n_prompt_tokens, true, true);
+    if (n_tokens <= 0 || n_tokens > n_prompt_tokens ||
+        llama_decode(ctx->ctx, llama_batch_get_one(prompt_tokens, n_tokens, 0,
+                                                   lanes[i].seq_id)) != 0) {
+      ETHERVOX_LOG_WARN("Failed to evaluate batch prompt %u", i);
+      free(prompt_tokens);
+      continue;
+    }
+
+    free(prompt_tokens);
+    lanes[i].n_tokens = n_tokens;
+    lanes[i].logit_index = 0;  // Each prefill decode has one logit row
+    lanes[i].active = true;
+    n_active++;
+  }
+
+  // Shared decode loop: sample one token per active lane, then advance every
+  // lane in a single llama_decode
+  llama_batch batch = llama_batch_init((int32_t)request_count, 0, 1);
+
+  for (int step = 0; step < (int)ctx->n_predict && n_active > 0; step++) {
+    batch.n_tokens = 0;
+
+    for (uint32_t i = 0; i < request_count; i++) {
+      if (!lanes[i].active) {
+        continue;
+      }
+
+      llama_token new_token = llama_sampler_sample(
+        llama_sampler_chain_default_params(),
+        ctx->ctx,
+        lanes[i].logit_index
+      );
+
+      if (llama_token_is_eog(ctx->model, new_token)) {
+        lanes[i].active = false;
+        requests[i].status = ETHERVOX_SUCCESS;
+        n_active--;
+        continue;
+      }
+
+      char piece[256];
+      const int n_piece = llama_token_to_piece(ctx->model, new_token, piece,
+                                               sizeof(piece), false);
+      if (n_piece > 0 && requests[i].on_token) {
+        char token_text[sizeof(piece) + 1];
+        memcpy(token_text, piece, n_piece);
+        token_text[n_piece] = '\0';
+        requests[i].on_token(token_text, requests[i].user_data);
+      }
+
+      const int row = batch.n_tokens;
+      batch.token[row] = new_token;
+      batch.pos[row] = lanes[i].n_tokens + step;
+      batch.n_seq_id[row] = 1;
+      batch.seq_id[row][0] = lanes[i].seq_id;
+      batch.logits[row] = true;
+      batch.n_tokens++;
+      lanes[i].logit_index = row;
+    }
+
+    if (batch.n_tokens == 0) {
+      break;
+    }
+
+    if (llama_decode(ctx->ctx, batch) != 0) {
+      ETHERVOX_LOG_WARN("Batch decode failed at step %d", step);
+      break;
+    }
+  }
+
+  llama_batch_free(batch);
+
+  // Lanes that ran out of n_predict still produced a full (truncated) stream
+  uint32_t n_succeeded = 0;
+  for (uint32_t i = 0; i < request_count; i++) {
+    if (lanes[i].active) {
+      requests[i].status = ETHERVOX_SUCCESS;
+    }
+    if (requests[i].status == ETHERVOX_SUCCESS) {
+      n_succeeded++;
+    }
+    llama_kv_cache_seq_rm(ctx->ctx, lanes[i].seq_id, -1, -1);
+  }
+
+  free(lanes);
+
+  ETHERVOX_LOG_INFO("Batch generation: %u/%u requests completed", n_succeeded, request_count);
+  return n_succeeded == request_count ? ETHERVOX_SUCCESS : ETHERVOX_ERROR_FAILED;
+#endif
+}
+
+// Raw tokenization for prompt-template splicing: no BOS or special tokens,
+// so runs concatenate cleanly regardless of where they land in the prompt
+static int llama_backend_tokenize(ethervox_llm_backend_t* backend,
+                                 const char* text,
+                                 int32_t* tokens,
+                                 uint32_t capacity) {
+  if (!backend || !backend->handle || !text || !tokens) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+#if !defined(ETHERVOX_WITH_LLAMA) || !LLAMA_HEADER_AVAILABLE
+  (void)capacity;
+  ETHERVOX_LOG_ERROR("Llama backend not available");
+  return ETHERVOX_ERROR_NOT_IMPLEMENTED;
+#else
+  llama_backend_context_t* ctx = (llama_backend_context_t*)backend->handle;
+
+  if (!ctx->model) {
+    ETHERVOX_LOG_ERROR("Model not loaded");
+    return ETHERVOX_ERROR_NOT_INITIALIZED;
+  }
+
+  // llama_tokenize already follows the negated-required-count convention
+  return llama_tokenize(ctx->model, text, (int)strlen(text), (llama_token*)tokens, (int)capacity,
+                        false, true);
+#endif
+}
+
 static int llama_backend_get_capabilities(ethervox_llm_backend_t* backend,
                                         ethervox_llm_capabilities_t* capabilities) {
   if (!backend || !capabilities) {
@@ -431,7 +1139,7 @@ static int llama_backend_get_capabilities(ethervox_llm_backend_t* backend,
   
   llama_backend_context_t* ctx = (llama_backend_context_t*)backend->handle;
   
-  capabilities->supports_streaming = false;  // TODO: Implement streaming
+  capabilities->supports_streaming = true;
   capabilities->supports_gpu = true;
   capabilities->supports_quantization = true;
   capabilities->supports_context_caching = true;
@@ -16,10 +16,45 @@
 #include "ethervox/llm.h"
 #include "ethervox/error.h"
 #include "ethervox/logging.h"
+#include "ethervox/platform.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+// The batch scheduler needs a dispatch thread; without pthreads submissions
+// run inline (correct, just unbatched)
+#if defined(__has_include)
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define ETHERVOX_LLM_SCHEDULER_THREAD 1
+#define ETHERVOX_LLM_HAVE_PTHREAD 1
+#endif
+#endif
+#ifndef ETHERVOX_LLM_SCHEDULER_THREAD
+#define ETHERVOX_LLM_SCHEDULER_THREAD 0
+#endif
+#ifndef ETHERVOX_LLM_HAVE_PTHREAD
+#define ETHERVOX_LLM_HAVE_PTHREAD 0
+#endif
+
+// Residency pool sizing: half of system RAM keeps room for the audio
+// pipeline and the OS page cache the mmap'd weights rely on
+static const uint32_t kEthervoxPoolRamFraction = 2U;
+static const uint32_t kEthervoxPoolDefaultMaxResident = 4U;
+static const uint32_t kEthervoxPoolFallbackBudgetMb = 2048U;
+
+// Scheduler: how long the dispatcher holds the first arrival open for
+// companions, and how many submissions can wait at once
+static const uint32_t kEthervoxSchedulerWindowDefaultMs = 15U;
+static const uint32_t kEthervoxSchedulerQueueSlots = 32U;
+static const uint32_t kEthervoxSchedulerFallbackBatch = 4U;
+
+// Failover: how long the primary gets to produce its first token before the
+// request is handed to the warm standby
+static const uint32_t kEthervoxFailoverDeadlineDefaultMs = 2000U;
 
 const char* ethervox_llm_backend_type_to_string(ethervox_llm_backend_type_t type) {
   switch (type) {
@@ -155,3 +190,916 @@ int ethervox_llm_backend_generate(ethervox_llm_backend_t* backend,
   
   return backend->generate(backend, prompt, language_code, response);
 }
+
+int ethervox_llm_backend_generate_stream(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        void (*callback)(const char* token, void* user_data),
+                                        void* user_data) {
+  if (!backend) {
+    ETHERVOX_LOG_ERROR("Backend is NULL");
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (!prompt || !callback) {
+    ETHERVOX_LOG_ERROR("Invalid arguments");
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (!backend->is_loaded) {
+    ETHERVOX_LOG_ERROR("Model not loaded");
+    return ETHERVOX_ERROR_NOT_INITIALIZED;
+  }
+
+  if (!backend->generate_stream) {
+    ETHERVOX_LOG_ERROR("Backend generate_stream function not implemented");
+    return ETHERVOX_ERROR_NOT_IMPLEMENTED;
+  }
+
+  return backend->generate_stream(backend, prompt, language_code, callback, user_data);
+}
+
+int ethervox_llm_backend_generate_cached(ethervox_llm_backend_t* backend,
+                                        const char* prompt,
+                                        const char* language_code,
+                                        const char* conversation_id,
+                                        ethervox_llm_response_t* response) {
+  if (!backend) {
+    ETHERVOX_LOG_ERROR("Backend is NULL");
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  // Context caching is an optional optimization; degrade to full prompt
+  // re-evaluation rather than failing
+  if (!conversation_id || !backend->generate_cached) {
+    return ethervox_llm_backend_generate(backend, prompt, language_code, response);
+  }
+
+  if (!prompt || !response) {
+    ETHERVOX_LOG_ERROR("Invalid arguments");
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (!backend->is_loaded) {
+    ETHERVOX_LOG_ERROR("Model not loaded");
+    return ETHERVOX_ERROR_NOT_INITIALIZED;
+  }
+
+  return backend->generate_cached(backend, prompt, language_code, conversation_id, response);
+}
+
+// Serial fallback for backends without a native batch path: stream each
+// request in turn so callers still get their token callbacks
+static void llm_generate_batch_serial(ethervox_llm_backend_t* backend,
+                                      ethervox_llm_batch_request_t* requests,
+                                      uint32_t request_count) {
+  for (uint32_t i = 0; i < request_count; i++) {
+    ethervox_llm_batch_request_t* request = &requests[i];
+    if (request->on_token) {
+      request->status = ethervox_llm_backend_generate_stream(
+          backend, request->prompt, request->language_code, request->on_token,
+          request->user_data);
+    } else {
+      ethervox_llm_response_t response = {0};
+      request->status = ethervox_llm_backend_generate_cached(
+          backend, request->prompt, request->language_code, request->conversation_id, &response);
+      // Callers without a token callback get no response object either; the
+      // batch path is for streaming sessions, so drop the collected text
+      free(response.text);
+      free(response.model_name);
+      free(response.finish_reason);
+    }
+  }
+}
+
+int ethervox_llm_backend_generate_batch(ethervox_llm_backend_t* backend,
+                                       ethervox_llm_batch_request_t* requests,
+                                       uint32_t request_count) {
+  if (!backend || !requests || request_count == 0) {
+    ETHERVOX_LOG_ERROR("Invalid arguments");
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (!backend->is_loaded) {
+    ETHERVOX_LOG_ERROR("Model not loaded");
+    return ETHERVOX_ERROR_NOT_INITIALIZED;
+  }
+
+  for (uint32_t i = 0; i < request_count; i++) {
+    if (!requests[i].prompt) {
+      ETHERVOX_LOG_ERROR("Batch request %u has no prompt", i);
+      return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+    requests[i].status = ETHERVOX_ERROR_FAILED;
+  }
+
+  // Chunk to the backend's advertised batch width
+  uint32_t max_batch = kEthervoxSchedulerFallbackBatch;
+  ethervox_llm_capabilities_t capabilities;
+  if (backend->get_capabilities &&
+      backend->get_capabilities(backend, &capabilities) == ETHERVOX_SUCCESS &&
+      capabilities.max_batch_size > 0) {
+    max_batch = capabilities.max_batch_size;
+  }
+
+  int result = ETHERVOX_SUCCESS;
+  for (uint32_t offset = 0; offset < request_count; offset += max_batch) {
+    const uint32_t chunk =
+        (request_count - offset) < max_batch ? (request_count - offset) : max_batch;
+
+    if (backend->generate_batch) {
+      const int rc = backend->generate_batch(backend, requests + offset, chunk);
+      if (rc != ETHERVOX_SUCCESS && result == ETHERVOX_SUCCESS) {
+        result = rc;
+      }
+    } else {
+      llm_generate_batch_serial(backend, requests + offset, chunk);
+    }
+  }
+
+  for (uint32_t i = 0; i < request_count; i++) {
+    if (requests[i].status != ETHERVOX_SUCCESS && result == ETHERVOX_SUCCESS) {
+      result = requests[i].status;
+    }
+  }
+
+  return result;
+}
+
+// --- Fair batch scheduler ---
+
+typedef struct {
+  ethervox_llm_batch_request_t request;
+  volatile bool done;
+  bool picked;  // Claimed by the in-flight batch
+} llm_scheduler_slot_t;
+
+struct ethervox_llm_batch_scheduler {
+  ethervox_llm_backend_t* backend;
+  uint32_t window_ms;
+  uint32_t max_batch;
+
+#if ETHERVOX_LLM_SCHEDULER_THREAD
+  llm_scheduler_slot_t* pending[32];
+  uint32_t pending_count;
+  bool running;
+  pthread_t dispatcher;
+  pthread_mutex_t lock;
+  pthread_cond_t arrival_cond;   // Signals the dispatcher
+  pthread_cond_t complete_cond;  // Signals waiting submitters
+#endif
+};
+
+#if ETHERVOX_LLM_SCHEDULER_THREAD
+// Pick a fair batch from the pending queue: first pass admits at most one
+// request per conversation in arrival order, second pass fills what is left
+// FIFO. A session that floods the queue still only beats the others to the
+// leftover slots.
+static uint32_t llm_scheduler_pick_batch(ethervox_llm_batch_scheduler_t* scheduler,
+                                         llm_scheduler_slot_t** batch, uint32_t batch_capacity) {
+  uint32_t picked = 0;
+
+  for (int pass = 0; pass < 2 && picked < batch_capacity; pass++) {
+    for (uint32_t i = 0; i < scheduler->pending_count && picked < batch_capacity; i++) {
+      llm_scheduler_slot_t* slot = scheduler->pending[i];
+      if (slot->picked) {
+        continue;
+      }
+
+      if (pass == 0 && slot->request.conversation_id) {
+        bool duplicate = false;
+        for (uint32_t j = 0; j < picked; j++) {
+          if (batch[j]->request.conversation_id &&
+              strcmp(batch[j]->request.conversation_id, slot->request.conversation_id) == 0) {
+            duplicate = true;
+            break;
+          }
+        }
+        if (duplicate) {
+          continue;  // Leave for the FIFO pass or the next batch
+        }
+      }
+
+      slot->picked = true;
+      batch[picked++] = slot;
+    }
+  }
+
+  // Compact the queue down to what was not claimed
+  uint32_t remaining = 0;
+  for (uint32_t i = 0; i < scheduler->pending_count; i++) {
+    if (!scheduler->pending[i]->picked) {
+      scheduler->pending[remaining++] = scheduler->pending[i];
+    }
+  }
+  scheduler->pending_count = remaining;
+
+  return picked;
+}
+
+static void* llm_scheduler_dispatcher(void* arg) {
+  ethervox_llm_batch_scheduler_t* scheduler = (ethervox_llm_batch_scheduler_t*)arg;
+
+  pthread_mutex_lock(&scheduler->lock);
+  while (scheduler->running) {
+    if (scheduler->pending_count == 0) {
+      pthread_cond_wait(&scheduler->arrival_cond, &scheduler->lock);
+      continue;
+    }
+
+    // Hold the window open so concurrent arrivals can join this batch
+    if (scheduler->window_ms > 0) {
+      struct timespec deadline;
+      clock_gettime(CLOCK_REALTIME, &deadline);
+      deadline.tv_nsec += (long)scheduler->window_ms * 1000000L;
+      deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+      deadline.tv_nsec %= 1000000000L;
+      while (scheduler->running && scheduler->pending_count < scheduler->max_batch &&
+             pthread_cond_timedwait(&scheduler->arrival_cond, &scheduler->lock, &deadline) == 0) {
+      }
+    }
+
+    llm_scheduler_slot_t* batch_slots[32];
+    ethervox_llm_batch_request_t batch_requests[32];
+    const uint32_t batch_capacity =
+        scheduler->max_batch < kEthervoxSchedulerQueueSlots ? scheduler->max_batch
+                                                            : kEthervoxSchedulerQueueSlots;
+    const uint32_t batch_size = llm_scheduler_pick_batch(scheduler, batch_slots, batch_capacity);
+    if (batch_size == 0) {
+      continue;
+    }
+
+    for (uint32_t i = 0; i < batch_size; i++) {
+      batch_requests[i] = batch_slots[i]->request;
+    }
+
+    // Generation runs without the lock so new submissions can queue up
+    pthread_mutex_unlock(&scheduler->lock);
+    ethervox_llm_backend_generate_batch(scheduler->backend, batch_requests, batch_size);
+    pthread_mutex_lock(&scheduler->lock);
+
+    for (uint32_t i = 0; i < batch_size; i++) {
+      batch_slots[i]->request.status = batch_requests[i].status;
+      batch_slots[i]->done = true;
+    }
+    pthread_cond_broadcast(&scheduler->complete_cond);
+  }
+  pthread_mutex_unlock(&scheduler->lock);
+
+  return NULL;
+}
+#endif  // ETHERVOX_LLM_SCHEDULER_THREAD
+
+ethervox_llm_batch_scheduler_t* ethervox_llm_batch_scheduler_create(
+    ethervox_llm_backend_t* backend, uint32_t coalesce_window_ms) {
+  if (!backend) {
+    return NULL;
+  }
+
+  ethervox_llm_batch_scheduler_t* scheduler =
+      (ethervox_llm_batch_scheduler_t*)calloc(1, sizeof(ethervox_llm_batch_scheduler_t));
+  if (!scheduler) {
+    return NULL;
+  }
+
+  scheduler->backend = backend;
+  scheduler->window_ms = coalesce_window_ms ? coalesce_window_ms : kEthervoxSchedulerWindowDefaultMs;
+
+  scheduler->max_batch = kEthervoxSchedulerFallbackBatch;
+  ethervox_llm_capabilities_t capabilities;
+  if (backend->get_capabilities &&
+      backend->get_capabilities(backend, &capabilities) == ETHERVOX_SUCCESS &&
+      capabilities.max_batch_size > 0) {
+    scheduler->max_batch = capabilities.max_batch_size;
+  }
+
+#if ETHERVOX_LLM_SCHEDULER_THREAD
+  pthread_mutex_init(&scheduler->lock, NULL);
+  pthread_cond_init(&scheduler->arrival_cond, NULL);
+  pthread_cond_init(&scheduler->complete_cond, NULL);
+  scheduler->running = true;
+
+  if (pthread_create(&scheduler->dispatcher, NULL, llm_scheduler_dispatcher, scheduler) != 0) {
+    ETHERVOX_LOG_ERROR("Failed to start batch dispatcher thread");
+    pthread_mutex_destroy(&scheduler->lock);
+    pthread_cond_destroy(&scheduler->arrival_cond);
+    pthread_cond_destroy(&scheduler->complete_cond);
+    free(scheduler);
+    return NULL;
+  }
+#endif
+
+  ETHERVOX_LOG_INFO("Batch scheduler created (window: %u ms, max batch: %u)",
+                    scheduler->window_ms, scheduler->max_batch);
+  return scheduler;
+}
+
+int ethervox_llm_batch_scheduler_submit(ethervox_llm_batch_scheduler_t* scheduler,
+                                        const ethervox_llm_batch_request_t* request) {
+  if (!scheduler || !request || !request->prompt) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+#if ETHERVOX_LLM_SCHEDULER_THREAD
+  llm_scheduler_slot_t slot = {.request = *request};
+
+  pthread_mutex_lock(&scheduler->lock);
+  if (!scheduler->running) {
+    pthread_mutex_unlock(&scheduler->lock);
+    ETHERVOX_LOG_WARN("Batch scheduler is shutting down; rejecting submission");
+    return ETHERVOX_ERROR_FAILED;
+  }
+  if (scheduler->pending_count >= kEthervoxSchedulerQueueSlots) {
+    pthread_mutex_unlock(&scheduler->lock);
+    ETHERVOX_LOG_WARN("Batch scheduler queue full; rejecting submission");
+    return ETHERVOX_ERROR_FAILED;
+  }
+  scheduler->pending[scheduler->pending_count++] = &slot;
+  pthread_cond_signal(&scheduler->arrival_cond);
+
+  while (!slot.done) {
+    pthread_cond_wait(&scheduler->complete_cond, &scheduler->lock);
+  }
+  pthread_mutex_unlock(&scheduler->lock);
+
+  return slot.request.status;
+#else
+  // No dispatcher thread: run the submission inline as a batch of one
+  ethervox_llm_batch_request_t single = *request;
+  const int rc = ethervox_llm_backend_generate_batch(scheduler->backend, &single, 1);
+  return rc == ETHERVOX_SUCCESS ? single.status : rc;
+#endif
+}
+
+void ethervox_llm_batch_scheduler_destroy(ethervox_llm_batch_scheduler_t* scheduler) {
+  if (!scheduler) {
+    return;
+  }
+
+#if ETHERVOX_LLM_SCHEDULER_THREAD
+  pthread_mutex_lock(&scheduler->lock);
+  scheduler->running = false;
+
+  // Fail whatever never got dispatched: the dispatcher exits without another
+  // pass over the queue, and submitters blocked on complete_cond would
+  // otherwise wait forever
+  for (uint32_t i = 0; i < scheduler->pending_count; i++) {
+    scheduler->pending[i]->request.status = ETHERVOX_ERROR_FAILED;
+    scheduler->pending[i]->done = true;
+  }
+  scheduler->pending_count = 0;
+
+  pthread_cond_signal(&scheduler->arrival_cond);
+  pthread_cond_broadcast(&scheduler->complete_cond);
+  pthread_mutex_unlock(&scheduler->lock);
+  pthread_join(scheduler->dispatcher, NULL);
+
+  pthread_mutex_destroy(&scheduler->lock);
+  pthread_cond_destroy(&scheduler->arrival_cond);
+  pthread_cond_destroy(&scheduler->complete_cond);
+#endif
+
+  free(scheduler);
+}
+
+// --- Warm-standby failover pool ---
+
+struct ethervox_llm_failover_pool {
+  ethervox_llm_backend_t* primary;   // Caller-owned
+  ethervox_llm_backend_t* standby;   // Pool-owned, initialized at create time
+  uint32_t handovers;                // Requests the standby ended up serving
+};
+
+#if ETHERVOX_LLM_SCHEDULER_THREAD
+// Who won the first-token race. Decided exactly once under the lock: by the
+// primary's worker when its first token lands, or by the waiting caller when
+// the deadline expires (or the primary errors out undecided).
+typedef enum {
+  LLM_RACE_UNDECIDED = 0,
+  LLM_RACE_PRIMARY,
+  LLM_RACE_STANDBY,
+} llm_race_winner_t;
+
+// Shared between the caller and the primary's worker thread; refcounted so
+// an abandoned worker can finish streaming into the void and clean up after
+// itself without the caller having to join it (joining would stall the
+// standby response behind the slow primary we are failing away from).
+typedef struct {
+  ethervox_llm_backend_t* primary;
+  char* prompt;         // Owned copy: the worker may outlive the caller's string
+  char* language_code;  // Owned copy (NULL when the caller passed NULL)
+  void (*callback)(const char* token, void* user_data);
+  void* user_data;
+
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  llm_race_winner_t winner;
+  bool worker_done;
+  int worker_status;
+  int refcount;
+} llm_race_t;
+
+static void llm_race_unref(llm_race_t* race) {
+  pthread_mutex_lock(&race->lock);
+  const int remaining = --race->refcount;
+  pthread_mutex_unlock(&race->lock);
+
+  if (remaining == 0) {
+    pthread_mutex_destroy(&race->lock);
+    pthread_cond_destroy(&race->cond);
+    free(race->prompt);
+    free(race->language_code);
+    free(race);
+  }
+}
+
+// Token callback for the primary's stream: the first token decides the race
+// (if still open); tokens are forwarded only while the primary is the winner
+static void llm_race_on_primary_token(const char* token, void* user_data) {
+  llm_race_t* race = (llm_race_t*)user_data;
+
+  pthread_mutex_lock(&race->lock);
+  if (race->winner == LLM_RACE_UNDECIDED) {
+    race->winner = LLM_RACE_PRIMARY;
+    pthread_cond_broadcast(&race->cond);
+  }
+  const bool forward = race->winner == LLM_RACE_PRIMARY;
+  pthread_mutex_unlock(&race->lock);
+
+  if (forward) {
+    race->callback(token, race->user_data);
+  }
+}
+
+static void* llm_race_worker(void* arg) {
+  llm_race_t* race = (llm_race_t*)arg;
+
+  const int status = ethervox_llm_backend_generate_stream(
+      race->primary, race->prompt, race->language_code, llm_race_on_primary_token, race);
+
+  pthread_mutex_lock(&race->lock);
+  race->worker_status = status;
+  race->worker_done = true;
+  if (status != ETHERVOX_SUCCESS && race->winner == LLM_RACE_UNDECIDED) {
+    // Primary failed before its first token; hand over immediately instead
+    // of letting the caller sit out the rest of the deadline
+    race->winner = LLM_RACE_STANDBY;
+  }
+  pthread_cond_broadcast(&race->cond);
+  pthread_mutex_unlock(&race->lock);
+
+  llm_race_unref(race);
+  return NULL;
+}
+#endif  // ETHERVOX_LLM_SCHEDULER_THREAD
+
+ethervox_llm_failover_pool_t* ethervox_llm_failover_pool_create(
+    ethervox_llm_backend_t* primary, ethervox_llm_backend_t* standby) {
+  if (!primary || !standby) {
+    ETHERVOX_LOG_ERROR("Failover pool needs both a primary and a standby backend");
+    return NULL;
+  }
+
+  if (!standby->is_initialized) {
+    ETHERVOX_LOG_ERROR("Standby backend must be initialized before pooling (warm means warm)");
+    return NULL;
+  }
+
+  ethervox_llm_failover_pool_t* pool =
+      (ethervox_llm_failover_pool_t*)calloc(1, sizeof(ethervox_llm_failover_pool_t));
+  if (!pool) {
+    ETHERVOX_LOG_ERROR("Failed to allocate failover pool");
+    return NULL;
+  }
+
+  pool->primary = primary;
+  pool->standby = standby;
+
+  ETHERVOX_LOG_INFO("Failover pool ready (primary: %s, standby: %s)", primary->name,
+                    standby->name);
+  return pool;
+}
+
+int ethervox_llm_failover_pool_generate(ethervox_llm_failover_pool_t* pool,
+                                       const char* prompt,
+                                       const char* language_code,
+                                       ethervox_llm_response_t* response) {
+  if (!pool || !prompt || !response) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  const int rc = ethervox_llm_backend_generate(pool->primary, prompt, language_code, response);
+  if (rc == ETHERVOX_SUCCESS && !response->requires_external_llm) {
+    return rc;
+  }
+
+  // Primary failed or punted; the standby is already initialized so this is
+  // one call, not a backend bring-up
+  if (rc == ETHERVOX_SUCCESS) {
+    ethervox_llm_response_free(response);
+  }
+  memset(response, 0, sizeof(*response));
+
+  pool->handovers++;
+  ETHERVOX_LOG_INFO("Handing request to standby backend %s", pool->standby->name);
+  return ethervox_llm_backend_generate(pool->standby, prompt, language_code, response);
+}
+
+int ethervox_llm_failover_pool_generate_stream(ethervox_llm_failover_pool_t* pool,
+                                              const char* prompt,
+                                              const char* language_code,
+                                              uint32_t first_token_deadline_ms,
+                                              void (*callback)(const char* token, void* user_data),
+                                              void* user_data) {
+  if (!pool || !prompt || !callback) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (first_token_deadline_ms == 0) {
+    first_token_deadline_ms = kEthervoxFailoverDeadlineDefaultMs;
+  }
+
+#if ETHERVOX_LLM_SCHEDULER_THREAD
+  llm_race_t* race = (llm_race_t*)calloc(1, sizeof(llm_race_t));
+  if (!race) {
+    return ETHERVOX_ERROR_OUT_OF_MEMORY;
+  }
+
+  race->primary = pool->primary;
+  // Copy the strings: nothing requires the caller to keep them alive after
+  // we return, but an abandoned worker reads them until its stream ends
+  race->prompt = strdup(prompt);
+  race->language_code = language_code ? strdup(language_code) : NULL;
+  race->callback = callback;
+  race->user_data = user_data;
+  race->refcount = 2;  // Caller + worker
+  pthread_mutex_init(&race->lock, NULL);
+  pthread_cond_init(&race->cond, NULL);
+
+  pthread_t worker;
+  if (!race->prompt || (language_code && !race->language_code) ||
+      pthread_create(&worker, NULL, llm_race_worker, race) != 0) {
+    pthread_mutex_destroy(&race->lock);
+    pthread_cond_destroy(&race->cond);
+    free(race->prompt);
+    free(race->language_code);
+    free(race);
+    // No thread to race with; stream on the standby directly
+    pool->handovers++;
+    return ethervox_llm_backend_generate_stream(pool->standby, prompt, language_code, callback,
+                                                user_data);
+  }
+  pthread_detach(worker);
+
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_nsec += (long)first_token_deadline_ms * 1000000L;
+  deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+  deadline.tv_nsec %= 1000000000L;
+
+  pthread_mutex_lock(&race->lock);
+  while (race->winner == LLM_RACE_UNDECIDED) {
+    if (pthread_cond_timedwait(&race->cond, &race->lock, &deadline) != 0) {
+      break;  // Deadline expired with the race still open
+    }
+  }
+  if (race->winner == LLM_RACE_UNDECIDED) {
+    race->winner = LLM_RACE_STANDBY;
+  }
+  const llm_race_winner_t winner = race->winner;
+
+  int status;
+  if (winner == LLM_RACE_PRIMARY) {
+    // Tokens are already flowing to the caller; wait out the stream
+    while (!race->worker_done) {
+      pthread_cond_wait(&race->cond, &race->lock);
+    }
+    status = race->worker_status;
+    pthread_mutex_unlock(&race->lock);
+  } else {
+    // The abandoned primary keeps decoding until it finishes (backends have
+    // no cancellation hook); its tokens are dropped by the race callback
+    pthread_mutex_unlock(&race->lock);
+    pool->handovers++;
+    ETHERVOX_LOG_WARN("No first token from %s within %u ms; handing over to %s",
+                      pool->primary->name, first_token_deadline_ms, pool->standby->name);
+    status = ethervox_llm_backend_generate_stream(pool->standby, prompt, language_code, callback,
+                                                  user_data);
+  }
+
+  llm_race_unref(race);
+  return status;
+#else
+  // No pthreads: no race to run, but the warm standby still saves the cold
+  // init after a primary failure
+  (void)first_token_deadline_ms;
+  const int rc = ethervox_llm_backend_generate_stream(pool->primary, prompt, language_code,
+                                                      callback, user_data);
+  if (rc == ETHERVOX_SUCCESS) {
+    return rc;
+  }
+
+  pool->handovers++;
+  return ethervox_llm_backend_generate_stream(pool->standby, prompt, language_code, callback,
+                                              user_data);
+#endif
+}
+
+void ethervox_llm_failover_pool_destroy(ethervox_llm_failover_pool_t* pool) {
+  if (!pool) {
+    return;
+  }
+
+  if (pool->handovers > 0) {
+    ETHERVOX_LOG_INFO("Failover pool served %u requests from the standby", pool->handovers);
+  }
+
+  ethervox_llm_backend_free(pool->standby);
+  free(pool);
+}
+
+// --- Model residency pool ---
+
+typedef struct {
+  char* model_path;
+  ethervox_llm_backend_t* backend;
+  uint64_t size_bytes;  // Budget accounting; approximated by the file size
+  uint64_t last_used;
+  uint32_t refcount;  // Outstanding acquisitions; nonzero pins against eviction
+} llm_pool_entry_t;
+
+struct ethervox_llm_model_pool {
+  llm_pool_entry_t* entries;
+  uint32_t max_resident;
+  uint32_t count;
+  uint64_t ram_budget_bytes;
+  uint64_t resident_bytes;
+  uint64_t use_counter;
+  ethervox_llm_config_t llm_config;  // Template for backends the pool creates
+#if ETHERVOX_LLM_HAVE_PTHREAD
+  pthread_mutex_t lock;
+#endif
+};
+
+#if ETHERVOX_LLM_HAVE_PTHREAD
+#define llm_pool_lock(pool) pthread_mutex_lock(&(pool)->lock)
+#define llm_pool_unlock(pool) pthread_mutex_unlock(&(pool)->lock)
+#else
+#define llm_pool_lock(pool) (void)(pool)
+#define llm_pool_unlock(pool) (void)(pool)
+#endif
+
+ethervox_llm_model_pool_config_t ethervox_llm_model_pool_get_default_config(void) {
+  ethervox_llm_model_pool_config_t config = {
+      .ram_budget_mb = 0,  // Derived from platform capabilities at create time
+      .max_resident = kEthervoxPoolDefaultMaxResident,
+  };
+  return config;
+}
+
+static uint64_t llm_pool_model_file_size(const char* model_path) {
+  struct stat st;
+  if (stat(model_path, &st) != 0) {
+    return 0;
+  }
+  return (uint64_t)st.st_size;
+}
+
+static ethervox_llm_backend_t* llm_pool_create_backend(ethervox_llm_backend_type_t type) {
+  switch (type) {
+    case ETHERVOX_LLM_BACKEND_LLAMA:
+      return ethervox_llm_create_llama_backend();
+    case ETHERVOX_LLM_BACKEND_TINYLLAMA:
+      return ethervox_llm_create_tinyllama_backend();
+    case ETHERVOX_LLM_BACKEND_EXTERNAL:
+      return ethervox_llm_create_external_backend();
+    default:
+      ETHERVOX_LOG_ERROR("Unknown backend type: %d", type);
+      return NULL;
+  }
+}
+
+static void llm_pool_entry_release(ethervox_llm_model_pool_t* pool, uint32_t index) {
+  llm_pool_entry_t* entry = &pool->entries[index];
+
+  ETHERVOX_LOG_INFO("Evicting model from residency: %s (%.1f MB)", entry->model_path,
+                    (double)entry->size_bytes / (1024.0 * 1024.0));
+
+  ethervox_llm_backend_unload_model(entry->backend);
+  ethervox_llm_backend_free(entry->backend);
+  free(entry->model_path);
+
+  pool->resident_bytes -= entry->size_bytes;
+  pool->entries[index] = pool->entries[pool->count - 1];
+  pool->count--;
+}
+
+// Evict least recently used unpinned residents until a model of size_bytes
+// fits. Entries with outstanding acquisitions are never touched, so the loop
+// can give up before the budget is met; the caller re-checks.
+static void llm_pool_make_room(ethervox_llm_model_pool_t* pool, uint64_t size_bytes) {
+  while (pool->count > 0 && (pool->count >= pool->max_resident ||
+                             pool->resident_bytes + size_bytes > pool->ram_budget_bytes)) {
+    uint32_t lru = UINT32_MAX;
+    for (uint32_t i = 0; i < pool->count; i++) {
+      if (pool->entries[i].refcount > 0) {
+        continue;  // A caller is still generating with this backend
+      }
+      if (lru == UINT32_MAX || pool->entries[i].last_used < pool->entries[lru].last_used) {
+        lru = i;
+      }
+    }
+    if (lru == UINT32_MAX) {
+      return;  // Everything resident is pinned
+    }
+    llm_pool_entry_release(pool, lru);
+  }
+}
+
+ethervox_llm_model_pool_t* ethervox_llm_model_pool_create(
+    const ethervox_llm_model_pool_config_t* config, const ethervox_llm_config_t* llm_config) {
+  ethervox_llm_model_pool_config_t pool_config =
+      config ? *config : ethervox_llm_model_pool_get_default_config();
+
+  if (pool_config.max_resident == 0) {
+    pool_config.max_resident = kEthervoxPoolDefaultMaxResident;
+  }
+
+  if (pool_config.ram_budget_mb == 0) {
+    const ethervox_platform_capabilities_t caps = ethervox_platform_get_capabilities();
+    pool_config.ram_budget_mb = caps.ram_size_mb > 0 ? caps.ram_size_mb / kEthervoxPoolRamFraction
+                                                     : kEthervoxPoolFallbackBudgetMb;
+  }
+
+  ethervox_llm_model_pool_t* pool =
+      (ethervox_llm_model_pool_t*)calloc(1, sizeof(ethervox_llm_model_pool_t));
+  if (!pool) {
+    ETHERVOX_LOG_ERROR("Failed to allocate model pool");
+    return NULL;
+  }
+
+  pool->entries =
+      (llm_pool_entry_t*)calloc(pool_config.max_resident, sizeof(llm_pool_entry_t));
+  if (!pool->entries) {
+    free(pool);
+    return NULL;
+  }
+
+  pool->max_resident = pool_config.max_resident;
+  pool->ram_budget_bytes = (uint64_t)pool_config.ram_budget_mb * 1024u * 1024u;
+#if ETHERVOX_LLM_HAVE_PTHREAD
+  pthread_mutex_init(&pool->lock, NULL);
+#endif
+
+  if (llm_config) {
+    pool->llm_config = *llm_config;
+    if (llm_config->model_path) {
+      pool->llm_config.model_path = strdup(llm_config->model_path);
+    }
+    if (llm_config->model_name) {
+      pool->llm_config.model_name = strdup(llm_config->model_name);
+    }
+    if (llm_config->language_code) {
+      pool->llm_config.language_code = strdup(llm_config->language_code);
+    }
+  }
+
+  ETHERVOX_LOG_INFO("Model pool created (budget: %u MB, max resident: %u)",
+                    pool_config.ram_budget_mb, pool->max_resident);
+
+  return pool;
+}
+
+ethervox_llm_backend_t* ethervox_llm_model_pool_acquire(ethervox_llm_model_pool_t* pool,
+                                                        ethervox_llm_backend_type_t type,
+                                                        const char* model_path) {
+  if (!pool || !model_path || !*model_path) {
+    return NULL;
+  }
+
+  llm_pool_lock(pool);
+
+  // Hot path: the model is already resident
+  for (uint32_t i = 0; i < pool->count; i++) {
+    if (strcmp(pool->entries[i].model_path, model_path) == 0) {
+      pool->entries[i].last_used = ++pool->use_counter;
+      pool->entries[i].refcount++;
+      ethervox_llm_backend_t* backend = pool->entries[i].backend;
+      llm_pool_unlock(pool);
+      return backend;
+    }
+  }
+
+  const uint64_t size_bytes = llm_pool_model_file_size(model_path);
+  if (size_bytes > pool->ram_budget_bytes) {
+    ETHERVOX_LOG_ERROR("Model exceeds pool RAM budget: %s (%.1f MB > %.1f MB)", model_path,
+                       (double)size_bytes / (1024.0 * 1024.0),
+                       (double)pool->ram_budget_bytes / (1024.0 * 1024.0));
+    llm_pool_unlock(pool);
+    return NULL;
+  }
+
+  llm_pool_make_room(pool, size_bytes);
+  if (pool->count >= pool->max_resident) {
+    // Every slot is pinned by an in-flight generation; nothing can be evicted
+    ETHERVOX_LOG_ERROR("Model pool full with all residents in use: %s", model_path);
+    llm_pool_unlock(pool);
+    return NULL;
+  }
+
+  ethervox_llm_backend_t* backend = llm_pool_create_backend(type);
+  if (!backend) {
+    llm_pool_unlock(pool);
+    return NULL;
+  }
+
+  if (ethervox_llm_backend_init(backend, &pool->llm_config) != ETHERVOX_SUCCESS ||
+      ethervox_llm_backend_load_model(backend, model_path) != ETHERVOX_SUCCESS) {
+    ethervox_llm_backend_free(backend);
+    llm_pool_unlock(pool);
+    return NULL;
+  }
+
+  llm_pool_entry_t* entry = &pool->entries[pool->count++];
+  entry->model_path = strdup(model_path);
+  entry->backend = backend;
+  entry->size_bytes = size_bytes;
+  entry->last_used = ++pool->use_counter;
+  entry->refcount = 1;
+  pool->resident_bytes += size_bytes;
+
+  ETHERVOX_LOG_INFO("Model resident: %s (%u/%u slots, %.1f MB of budget used)", model_path,
+                    pool->count, pool->max_resident,
+                    (double)pool->resident_bytes / (1024.0 * 1024.0));
+
+  llm_pool_unlock(pool);
+  return backend;
+}
+
+void ethervox_llm_model_pool_release(ethervox_llm_model_pool_t* pool,
+                                     const ethervox_llm_backend_t* backend) {
+  if (!pool || !backend) {
+    return;
+  }
+
+  llm_pool_lock(pool);
+  for (uint32_t i = 0; i < pool->count; i++) {
+    if (pool->entries[i].backend == backend) {
+      if (pool->entries[i].refcount > 0) {
+        pool->entries[i].refcount--;
+      } else {
+        ETHERVOX_LOG_ERROR("Unbalanced model pool release for %s", pool->entries[i].model_path);
+      }
+      llm_pool_unlock(pool);
+      return;
+    }
+  }
+  llm_pool_unlock(pool);
+}
+
+void ethervox_llm_model_pool_evict(ethervox_llm_model_pool_t* pool, const char* model_path) {
+  if (!pool || !model_path) {
+    return;
+  }
+
+  llm_pool_lock(pool);
+  for (uint32_t i = 0; i < pool->count; i++) {
+    if (strcmp(pool->entries[i].model_path, model_path) == 0) {
+      if (pool->entries[i].refcount > 0) {
+        // Still generating somewhere; the LRU sweep picks it up once released
+        ETHERVOX_LOG_WARN("Deferring eviction of in-use model: %s", model_path);
+      } else {
+        llm_pool_entry_release(pool, i);
+      }
+      break;
+    }
+  }
+  llm_pool_unlock(pool);
+}
+
+void ethervox_llm_model_pool_destroy(ethervox_llm_model_pool_t* pool) {
+  if (!pool) {
+    return;
+  }
+
+  while (pool->count > 0) {
+    llm_pool_entry_release(pool, 0);
+  }
+
+#if ETHERVOX_LLM_HAVE_PTHREAD
+  pthread_mutex_destroy(&pool->lock);
+#endif
+
+  if (pool->llm_config.model_path) {
+    free(pool->llm_config.model_path);
+  }
+  if (pool->llm_config.model_name) {
+    free(pool->llm_config.model_name);
+  }
+  if (pool->llm_config.language_code) {
+    free(pool->llm_config.language_code);
+  }
+
+  free(pool->entries);
+  free(pool);
+}
@@ -16,7 +16,9 @@
 #include "ethervox/model_manager.h"
 #include "ethervox/error.h"
 #include "ethervox/logging.h"
+#include "ethervox/platform.h"
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -30,6 +32,7 @@
 #define stat _stat
 #define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
 #else
+#include <strings.h>
 #include <unistd.h>
 #include <sys/statvfs.h>
 #endif
@@ -56,6 +59,34 @@
 #endif
 #endif
 
+/* SHA256 via OpenSSL's EVP interface when available; checksum verification
+ * degrades to a logged warning without it */
+#if __has_include(<openssl/evp.h>)
+#include <openssl/evp.h>
+#define ETHERVOX_SHA256_AVAILABLE 1
+#else
+#ifdef _MSC_VER
+#pragma message("openssl/evp.h not found - model checksum verification disabled")
+#else
+#warning "openssl/evp.h not found - model checksum verification disabled"
+#endif
+#define ETHERVOX_SHA256_AVAILABLE 0
+#endif
+
+/* Streaming zstd decompression for .gguf.zst artifacts; registry entries with
+ * a compressed_url fall back to their raw url without it */
+#if __has_include(<zstd.h>)
+#include <zstd.h>
+#define ETHERVOX_ZSTD_AVAILABLE 1
+#else
+#ifdef _MSC_VER
+#pragma message("zstd.h not found - compressed model transfer disabled")
+#else
+#warning "zstd.h not found - compressed model transfer disabled"
+#endif
+#define ETHERVOX_ZSTD_AVAILABLE 0
+#endif
+
 // Predefined model registry
 const ethervox_model_info_t ETHERVOX_MODEL_TINYLLAMA_1B_Q4 = {
     .name = "TinyLlama-1.1B-Chat-Q4_K_M",
@@ -70,6 +101,19 @@ const ethervox_model_info_t ETHERVOX_MODEL_TINYLLAMA_1B_Q4 = {
     .min_ram_mb = 2048
 };
 
+const ethervox_model_info_t ETHERVOX_MODEL_TINYLLAMA_1B_Q8 = {
+    .name = "TinyLlama-1.1B-Chat-Q8_0",
+    .description = "TinyLlama 1.1B Chat model, Q8_0 quantized (higher quality, more RAM)",
+    .url = "https://huggingface.co/TheBloke/TinyLlama-1.1B-Chat-v1.0-GGUF/resolve/main/tinyllama-1.1b-chat-v1.0.Q8_0.gguf",
+    .filename = "tinyllama-1.1b-chat-v1.0.Q8_0.gguf",
+    .sha256 = NULL,
+    .size_bytes = 1170000000,  // ~1.1 GB
+    .format = "GGUF",
+    .quantization = "Q8_0",
+    .recommended_for_embedded = false,
+    .min_ram_mb = 3072
+};
+
 const ethervox_model_info_t ETHERVOX_MODEL_PHI2_Q4 = {
     .name = "Phi-2-Q4_K_M",
     .description = "Microsoft Phi-2 2.7B model, Q4_K_M quantized",
@@ -96,6 +140,19 @@ const ethervox_model_info_t ETHERVOX_MODEL_MISTRAL_7B_Q4 = {
     .min_ram_mb = 8192
 };
 
+const ethervox_model_info_t ETHERVOX_MODEL_MISTRAL_7B_Q5 = {
+    .name = "Mistral-7B-Instruct-Q5_K_M",
+    .description = "Mistral 7B Instruct model, Q5_K_M quantized (higher quality, more RAM)",
+    .url = "https://huggingface.co/TheBloke/Mistral-7B-Instruct-v0.2-GGUF/resolve/main/mistral-7b-instruct-v0.2.Q5_K_M.gguf",
+    .filename = "mistral-7b-instruct-v0.2.Q5_K_M.gguf",
+    .sha256 = NULL,
+    .size_bytes = 5130000000,  // ~4.8 GB
+    .format = "GGUF",
+    .quantization = "Q5_K_M",
+    .recommended_for_embedded = false,
+    .min_ram_mb = 10240
+};
+
 const ethervox_model_info_t ETHERVOX_MODEL_LLAMA2_7B_Q4 = {
     .name = "Llama-2-7B-Chat-Q4_K_M",
     .description = "Llama 2 7B Chat model, Q4_K_M quantized",
@@ -109,6 +166,45 @@ const ethervox_model_info_t ETHERVOX_MODEL_LLAMA2_7B_Q4 = {
     .min_ram_mb = 8192
 };
 
+// Family tables list each base model's registry variants best-quality-first;
+// selection walks down until one fits the device
+static const ethervox_model_info_t* const kTinyllamaVariants[] = {
+    &ETHERVOX_MODEL_TINYLLAMA_1B_Q8,
+    &ETHERVOX_MODEL_TINYLLAMA_1B_Q4,
+};
+
+static const ethervox_model_info_t* const kPhi2Variants[] = {
+    &ETHERVOX_MODEL_PHI2_Q4,
+};
+
+static const ethervox_model_info_t* const kMistral7bVariants[] = {
+    &ETHERVOX_MODEL_MISTRAL_7B_Q5,
+    &ETHERVOX_MODEL_MISTRAL_7B_Q4,
+};
+
+static const ethervox_model_info_t* const kLlama2_7bVariants[] = {
+    &ETHERVOX_MODEL_LLAMA2_7B_Q4,
+};
+
+typedef struct {
+    const ethervox_model_info_t* const* variants;
+    size_t count;
+} model_family_entry_t;
+
+static const model_family_entry_t kModelFamilies[ETHERVOX_MODEL_FAMILY_COUNT] = {
+    [ETHERVOX_MODEL_FAMILY_TINYLLAMA] = {kTinyllamaVariants,
+                                         sizeof(kTinyllamaVariants) / sizeof(kTinyllamaVariants[0])},
+    [ETHERVOX_MODEL_FAMILY_PHI2] = {kPhi2Variants, sizeof(kPhi2Variants) / sizeof(kPhi2Variants[0])},
+    [ETHERVOX_MODEL_FAMILY_MISTRAL_7B] = {kMistral7bVariants,
+                                          sizeof(kMistral7bVariants) / sizeof(kMistral7bVariants[0])},
+    [ETHERVOX_MODEL_FAMILY_LLAMA2_7B] = {kLlama2_7bVariants,
+                                         sizeof(kLlama2_7bVariants) / sizeof(kLlama2_7bVariants[0])},
+};
+
+// RAM reserved for everything that is not the model (audio buffers, STT, the
+// KV cache growing with context, OS) when no headroom is given
+#define ETHERVOX_MODEL_HEADROOM_DEFAULT_MB 512
+
 // Model manager structure
 struct ethervox_model_manager {
     char* models_dir;
@@ -129,8 +225,110 @@ typedef struct {
     uint64_t downloaded;
     uint64_t total;
     bool cancelled;
+    void* sha_ctx;     // EVP_MD_CTX* when streaming checksum verification is on
+    void* zstd_stream; // ZSTD_DStream* when the transfer is a .zst artifact
+    bool zstd_frame_done;  // The decompression stream ended on a frame boundary
 } download_context_t;
 
+// True when this download should be hash-verified
+static bool checksum_requested(const ethervox_model_manager_t* manager,
+                               const ethervox_model_info_t* model_info) {
+    if (!manager->verify_checksum || !model_info->sha256 || !*model_info->sha256) {
+        return false;
+    }
+#if ETHERVOX_SHA256_AVAILABLE
+    return true;
+#else
+    ETHERVOX_LOG_WARN("Checksum verification requested but no SHA256 implementation available");
+    return false;
+#endif
+}
+
+// True when this model should transfer as its zstd-compressed artifact
+static bool compressed_transfer_requested(const ethervox_model_info_t* model_info) {
+    if (!model_info->compressed_url || !*model_info->compressed_url) {
+        return false;
+    }
+#if ETHERVOX_ZSTD_AVAILABLE
+    return true;
+#else
+    ETHERVOX_LOG_WARN("Model %s has a compressed artifact but zstd is unavailable; "
+                      "fetching uncompressed", model_info->name);
+    return false;
+#endif
+}
+
+#if ETHERVOX_SHA256_AVAILABLE
+static bool sha256_digest_matches(const unsigned char* digest, unsigned int digest_len,
+                                  const char* expected_hex) {
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    if (strlen(expected_hex) != (size_t)digest_len * 2) {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < digest_len; i++) {
+        if (kHexDigits[digest[i] >> 4] != tolower((unsigned char)expected_hex[2 * i]) ||
+            kHexDigits[digest[i] & 0x0F] != tolower((unsigned char)expected_hex[2 * i + 1])) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+// Keep corrupted bytes out of models_dir but preserve them for postmortem
+static void quarantine_corrupted(ethervox_model_manager_t* manager,
+                                 const ethervox_model_info_t* model_info, const char* path) {
+    char corrupt_path[1024];
+    snprintf(corrupt_path, sizeof(corrupt_path), "%s/%s.corrupt", manager->cache_dir,
+             model_info->filename);
+    if (rename(path, corrupt_path) != 0) {
+        unlink(path);
+        corrupt_path[0] = '\0';
+    }
+    ETHERVOX_LOG_ERROR("Model %s is %s: SHA256 mismatch%s%s", model_info->name,
+                       ethervox_model_status_to_string(ETHERVOX_MODEL_STATUS_CORRUPTED),
+                       corrupt_path[0] ? ", bytes kept at " : "", corrupt_path);
+}
+
+#if ETHERVOX_SHA256_AVAILABLE
+// Ranged segments complete out of order, so the parallel download path cannot
+// feed one running hash; it verifies with a single sequential pass instead
+static bool verify_file_sha256(const char* path, const char* expected_hex) {
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        return false;
+    }
+
+    EVP_MD_CTX* md = EVP_MD_CTX_new();
+    if (!md || EVP_DigestInit_ex(md, EVP_sha256(), NULL) != 1) {
+        EVP_MD_CTX_free(md);
+        fclose(fp);
+        return false;
+    }
+
+    unsigned char chunk[64 * 1024];
+    size_t read_bytes;
+    bool ok = true;
+    while ((read_bytes = fread(chunk, 1, sizeof(chunk), fp)) > 0) {
+        if (EVP_DigestUpdate(md, chunk, read_bytes) != 1) {
+            ok = false;
+            break;
+        }
+    }
+    ok = ok && !ferror(fp);
+    fclose(fp);
+
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_len = 0;
+    ok = ok && EVP_DigestFinal_ex(md, digest, &digest_len) == 1;
+    EVP_MD_CTX_free(md);
+
+    return ok && sha256_digest_matches(digest, digest_len, expected_hex);
+}
+#endif
+
 #ifdef USE_LIBCURL
 // libcurl progress callback - renamed to avoid conflict with curl typedef
 static int ethervox_curl_progress_cb(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
@@ -157,7 +355,51 @@ static int ethervox_curl_progress_cb(void* clientp, curl_off_t dltotal, curl_off
 // libcurl write callback - renamed to avoid conflict with curl typedef
 static size_t ethervox_curl_write_cb(void* ptr, size_t size, size_t nmemb, void* userdata) {
     download_context_t* ctx = (download_context_t*)userdata;
+
+#if ETHERVOX_ZSTD_AVAILABLE
+    // Compressed transfer: decompress in-stream so the decompressed bytes go
+    // straight to disk (and into the running hash) with no temp copy or
+    // post-pass over the file
+    if (ctx->zstd_stream) {
+        ZSTD_inBuffer in = {ptr, size * nmemb, 0};
+        unsigned char out_buf[64 * 1024];
+
+        while (in.pos < in.size) {
+            ZSTD_outBuffer out = {out_buf, sizeof(out_buf), 0};
+            const size_t ret =
+                ZSTD_decompressStream((ZSTD_DStream*)ctx->zstd_stream, &out, &in);
+            if (ZSTD_isError(ret)) {
+                ETHERVOX_LOG_ERROR("zstd decompression failed: %s", ZSTD_getErrorName(ret));
+                return 0;  // Abort the transfer
+            }
+            ctx->zstd_frame_done = (ret == 0);
+
+            if (out.pos > 0) {
+                if (fwrite(out_buf, 1, out.pos, ctx->fp) != out.pos) {
+                    return 0;  // Short write (disk full?) aborts the transfer
+                }
+#if ETHERVOX_SHA256_AVAILABLE
+                // Checksums cover the decompressed bytes, never the wire form
+                if (ctx->sha_ctx) {
+                    EVP_DigestUpdate((EVP_MD_CTX*)ctx->sha_ctx, out_buf, out.pos);
+                }
+#endif
+                ctx->downloaded += out.pos;
+            }
+        }
+        return size * nmemb;
+    }
+#endif
+
     size_t written = fwrite(ptr, size, nmemb, ctx->fp);
+
+#if ETHERVOX_SHA256_AVAILABLE
+    // Hash bytes as they arrive so no post-download read pass is needed
+    if (ctx->sha_ctx && written == nmemb) {
+        EVP_DigestUpdate((EVP_MD_CTX*)ctx->sha_ctx, ptr, size * nmemb);
+    }
+#endif
+
     ctx->downloaded += written;
     return written;
 }
@@ -317,9 +559,10 @@ bool ethervox_model_manager_is_available(
 }
 
 #ifdef USE_LIBCURL
-static int download_with_curl(ethervox_model_manager_t* manager,
-                              const ethervox_model_info_t* model_info,
-                              const char* dest_path) {
+// Single-connection fallback for servers without Range support
+static int download_single_with_curl(ethervox_model_manager_t* manager,
+                                     const ethervox_model_info_t* model_info,
+                                     const char* dest_path) {
     CURL* curl;
     CURLcode res;
     
@@ -345,9 +588,42 @@ static int download_with_curl(ethervox_model_manager_t* manager,
     ctx.downloaded = 0;
     ctx.total = model_info->size_bytes;
     ctx.cancelled = false;
-    
+    ctx.sha_ctx = NULL;
+    ctx.zstd_stream = NULL;
+    ctx.zstd_frame_done = false;
+
+    const char* url = model_info->url;
+#if ETHERVOX_ZSTD_AVAILABLE
+    if (compressed_transfer_requested(model_info)) {
+        ctx.zstd_stream = ZSTD_createDStream();
+        if (ctx.zstd_stream) {
+            ZSTD_initDStream((ZSTD_DStream*)ctx.zstd_stream);
+            url = model_info->compressed_url;
+            ETHERVOX_LOG_INFO("Fetching compressed artifact (%.2f MB on the wire)",
+                              (float)model_info->compressed_size_bytes / 1024.0f / 1024.0f);
+        } else {
+            ETHERVOX_LOG_WARN("Failed to create zstd stream; fetching uncompressed");
+        }
+    }
+#endif
+
+#if ETHERVOX_SHA256_AVAILABLE
+    if (checksum_requested(manager, model_info)) {
+        EVP_MD_CTX* md = EVP_MD_CTX_new();
+        if (md && EVP_DigestInit_ex(md, EVP_sha256(), NULL) == 1) {
+            ctx.sha_ctx = md;
+        } else {
+            if (md) {
+                EVP_MD_CTX_free(md);
+            }
+            ETHERVOX_LOG_WARN("Failed to set up streaming SHA256; skipping verification");
+        }
+    }
+#endif
+
+
     // Configure CURL
-    curl_easy_setopt(curl, CURLOPT_URL, model_info->url);
+    curl_easy_setopt(curl, CURLOPT_URL, url);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, ethervox_curl_write_cb);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &ctx);
     curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, ethervox_curl_progress_cb);
@@ -359,20 +635,454 @@ static int download_with_curl(ethervox_model_manager_t* manager,
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
     
-    ETHERVOX_LOG_INFO("Starting download: %s", model_info->url);
-    
+    ETHERVOX_LOG_INFO("Starting download: %s", url);
+
     // Perform download
     res = curl_easy_perform(curl);
-    
+
     fclose(fp);
     curl_easy_cleanup(curl);
-    
-    if (res != CURLE_OK) {
+
+    bool transfer_ok = (res == CURLE_OK);
+    if (!transfer_ok) {
         ETHERVOX_LOG_ERROR("Download failed: %s", curl_easy_strerror(res));
+    }
+
+#if ETHERVOX_ZSTD_AVAILABLE
+    if (ctx.zstd_stream) {
+        ZSTD_freeDStream((ZSTD_DStream*)ctx.zstd_stream);
+        // A transfer that ends mid-frame is truncated even if curl saw EOF
+        if (transfer_ok && !ctx.zstd_frame_done) {
+            ETHERVOX_LOG_ERROR("Compressed transfer ended mid-frame (truncated artifact)");
+            transfer_ok = false;
+        }
+    }
+#endif
+
+    if (!transfer_ok) {
+#if ETHERVOX_SHA256_AVAILABLE
+        if (ctx.sha_ctx) {
+            EVP_MD_CTX_free((EVP_MD_CTX*)ctx.sha_ctx);
+        }
+#endif
         unlink(dest_path);  // Delete partial file
         return ETHERVOX_ERROR_FAILED;
     }
-    
+
+#if ETHERVOX_SHA256_AVAILABLE
+    if (ctx.sha_ctx) {
+        unsigned char digest[EVP_MAX_MD_SIZE];
+        unsigned int digest_len = 0;
+        const int finalized =
+            EVP_DigestFinal_ex((EVP_MD_CTX*)ctx.sha_ctx, digest, &digest_len);
+        EVP_MD_CTX_free((EVP_MD_CTX*)ctx.sha_ctx);
+
+        if (finalized != 1 ||
+            !sha256_digest_matches(digest, digest_len, model_info->sha256)) {
+            quarantine_corrupted(manager, model_info, dest_path);
+            return ETHERVOX_ERROR_FAILED;
+        }
+        ETHERVOX_LOG_INFO("SHA256 verified during download");
+    }
+#endif
+
+    ETHERVOX_LOG_INFO("Download completed successfully");
+    return ETHERVOX_SUCCESS;
+}
+
+// Parallel ranged download: the file is split into up to
+// ETHERVOX_DOWNLOAD_SEGMENTS HTTP ranges fetched by concurrent easy handles
+// into a preallocated sparse .part file in cache_dir. Per-segment progress is
+// persisted to a .resume file so an interrupted multi-GB download continues
+// where it stopped instead of restarting from byte zero, and several
+// connections together can saturate links a single GET cannot.
+#define ETHERVOX_DOWNLOAD_SEGMENTS 4
+#define ETHERVOX_DOWNLOAD_MIN_SEGMENT_BYTES (8ull * 1024ull * 1024ull)
+#define ETHERVOX_DOWNLOAD_STATE_INTERVAL_BYTES (4ull * 1024ull * 1024ull)
+
+typedef struct ranged_download ranged_download_t;
+
+typedef struct {
+    ranged_download_t* owner;
+    FILE* fp;
+    CURL* easy;
+    uint64_t begin;        // Absolute offset of this segment in the file
+    uint64_t length;       // Segment size in bytes
+    uint64_t written;      // Bytes completed (persisted for resume)
+    uint64_t saved_mark;   // written at the last state save
+    uint64_t range_start;  // Absolute offset the current request began at
+    bool done;
+} download_segment_t;
+
+struct ranged_download {
+    ethervox_model_manager_t* manager;
+    const ethervox_model_info_t* model_info;
+    download_segment_t segments[ETHERVOX_DOWNLOAD_SEGMENTS];
+    int segment_count;
+    uint64_t total_size;
+    char part_path[1024];
+    char state_path[1024];
+};
+
+static void ranged_state_save(const ranged_download_t* dl) {
+    FILE* fp = fopen(dl->state_path, "w");
+    if (!fp) {
+        return;  // Best effort; losing the state only costs a re-download
+    }
+
+    fprintf(fp, "total %llu\nsegments %d\n", (unsigned long long)dl->total_size,
+            dl->segment_count);
+    for (int i = 0; i < dl->segment_count; i++) {
+        fprintf(fp, "seg %d %llu\n", i, (unsigned long long)dl->segments[i].written);
+    }
+    fclose(fp);
+}
+
+static void ranged_state_load(ranged_download_t* dl) {
+    FILE* fp = fopen(dl->state_path, "r");
+    if (!fp) {
+        return;
+    }
+
+    unsigned long long total = 0;
+    int count = 0;
+    if (fscanf(fp, "total %llu\nsegments %d\n", &total, &count) == 2 &&
+        total == dl->total_size && count == dl->segment_count) {
+        int index;
+        unsigned long long written;
+        while (fscanf(fp, "seg %d %llu\n", &index, &written) == 2) {
+            if (index >= 0 && index < dl->segment_count &&
+                written <= dl->segments[index].length) {
+                dl->segments[index].written = written;
+                dl->segments[index].saved_mark = written;
+            }
+        }
+    }
+    fclose(fp);
+}
+
+typedef struct {
+    bool accepts_ranges;
+} ranged_probe_result_t;
+
+static size_t ranged_probe_header_cb(char* buffer, size_t size, size_t nitems, void* userdata) {
+    ranged_probe_result_t* probe = (ranged_probe_result_t*)userdata;
+    const size_t len = size * nitems;
+
+    char line[128];
+    const size_t copy_len = len < sizeof(line) - 1 ? len : sizeof(line) - 1;
+    memcpy(line, buffer, copy_len);
+    line[copy_len] = '\0';
+
+    if (strncasecmp(line, "accept-ranges:", 14) == 0 && strstr(line, "bytes")) {
+        probe->accepts_ranges = true;
+    }
+
+    return len;
+}
+
+// HEAD request to learn the content length and whether byte ranges work
+static int ranged_probe(const ranged_download_t* dl, uint64_t* total_out, bool* ranges_out) {
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    ranged_probe_result_t probe = {false};
+
+    curl_easy_setopt(curl, CURLOPT_URL, dl->model_info->url);
+    curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "EthervoxAI-ModelManager/1.0");
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, ranged_probe_header_cb);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &probe);
+
+    CURLcode res = curl_easy_perform(curl);
+
+    curl_off_t length = -1;
+    if (res == CURLE_OK) {
+        curl_easy_getinfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+    }
+    curl_easy_cleanup(curl);
+
+    if (res != CURLE_OK || length <= 0) {
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    *total_out = (uint64_t)length;
+    *ranges_out = probe.accepts_ranges;
+    return ETHERVOX_SUCCESS;
+}
+
+static size_t ranged_write_cb(void* ptr, size_t size, size_t nmemb, void* userdata) {
+    download_segment_t* seg = (download_segment_t*)userdata;
+    size_t bytes = size * nmemb;
+
+    // Never write past the segment even if the server over-delivers
+    const uint64_t remaining = seg->length - seg->written;
+    if ((uint64_t)bytes > remaining) {
+        bytes = (size_t)remaining;
+    }
+
+    const size_t written = fwrite(ptr, 1, bytes, seg->fp);
+    seg->written += written;
+
+    if (written != bytes) {
+        return written;  // Short write (disk full?) aborts the transfer
+    }
+
+    if (seg->written - seg->saved_mark >= ETHERVOX_DOWNLOAD_STATE_INTERVAL_BYTES) {
+        // The state file records seg->written as durable, so the segment data
+        // must actually be on disk first: stdio-buffered bytes lost in a crash
+        // would otherwise leave a silent hole that a resume skips right over
+        if (fflush(seg->fp) != 0) {
+            return 0;  // Treat like a short write: abort the transfer
+        }
+        fsync(fileno(seg->fp));
+        ranged_state_save(seg->owner);
+        seg->saved_mark = seg->written;
+    }
+
+    return size * nmemb;
+}
+
+// One pass of the multi loop over all unfinished segments; returns true when
+// every segment completed its range
+static bool ranged_attempt(ranged_download_t* dl) {
+    CURLM* multi = curl_multi_init();
+    if (!multi) {
+        return false;
+    }
+
+    int active = 0;
+    for (int i = 0; i < dl->segment_count; i++) {
+        download_segment_t* seg = &dl->segments[i];
+        if (seg->written >= seg->length) {
+            seg->done = true;
+            continue;
+        }
+
+        seg->easy = curl_easy_init();
+        if (!seg->easy) {
+            continue;  // Picked up by the retry loop
+        }
+
+        seg->range_start = seg->begin + seg->written;
+        if (fseeko(seg->fp, (off_t)seg->range_start, SEEK_SET) != 0) {
+            curl_easy_cleanup(seg->easy);
+            seg->easy = NULL;
+            continue;
+        }
+
+        char range[64];
+        snprintf(range, sizeof(range), "%llu-%llu", (unsigned long long)seg->range_start,
+                 (unsigned long long)(seg->begin + seg->length - 1));
+
+        curl_easy_setopt(seg->easy, CURLOPT_URL, dl->model_info->url);
+        curl_easy_setopt(seg->easy, CURLOPT_RANGE, range);
+        curl_easy_setopt(seg->easy, CURLOPT_WRITEFUNCTION, ranged_write_cb);
+        curl_easy_setopt(seg->easy, CURLOPT_WRITEDATA, seg);
+        curl_easy_setopt(seg->easy, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(seg->easy, CURLOPT_TIMEOUT, (long)dl->manager->timeout_seconds);
+        curl_easy_setopt(seg->easy, CURLOPT_USERAGENT, "EthervoxAI-ModelManager/1.0");
+        curl_easy_setopt(seg->easy, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(seg->easy, CURLOPT_SSL_VERIFYHOST, 2L);
+
+        curl_multi_add_handle(multi, seg->easy);
+        active++;
+    }
+
+    int still_running = active;
+    while (still_running > 0) {
+        if (curl_multi_perform(multi, &still_running) != CURLM_OK) {
+            break;
+        }
+
+        if (dl->manager->progress_callback) {
+            uint64_t downloaded = 0;
+            for (int i = 0; i < dl->segment_count; i++) {
+                downloaded += dl->segments[i].written;
+            }
+            dl->manager->progress_callback(
+                dl->model_info->name, downloaded, dl->total_size,
+                (float)downloaded / (float)dl->total_size * 100.0f,
+                dl->manager->callback_user_data);
+        }
+
+        if (still_running > 0) {
+            curl_multi_wait(multi, NULL, 0, 500, NULL);
+        }
+    }
+
+    // Judge each finished transfer: a range must come back as 206 (200 is
+    // only acceptable for a whole-file request starting at byte zero)
+    CURLMsg* msg;
+    int queued;
+    while ((msg = curl_multi_info_read(multi, &queued)) != NULL) {
+        if (msg->msg != CURLMSG_DONE) {
+            continue;
+        }
+
+        download_segment_t* seg = NULL;
+        for (int i = 0; i < dl->segment_count; i++) {
+            if (dl->segments[i].easy == msg->easy_handle) {
+                seg = &dl->segments[i];
+                break;
+            }
+        }
+        if (!seg) {
+            continue;
+        }
+
+        long code = 0;
+        curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &code);
+
+        if (msg->data.result == CURLE_OK && seg->written >= seg->length &&
+            (code == 206 || (code == 200 && seg->range_start == 0))) {
+            seg->done = true;
+        } else {
+            ETHERVOX_LOG_WARN("Segment %llu-%llu failed (curl: %s, HTTP %ld)",
+                              (unsigned long long)seg->begin,
+                              (unsigned long long)(seg->begin + seg->length - 1),
+                              curl_easy_strerror(msg->data.result), code);
+        }
+    }
+
+    for (int i = 0; i < dl->segment_count; i++) {
+        if (dl->segments[i].easy) {
+            curl_multi_remove_handle(multi, dl->segments[i].easy);
+            curl_easy_cleanup(dl->segments[i].easy);
+            dl->segments[i].easy = NULL;
+        }
+        fflush(dl->segments[i].fp);
+    }
+    curl_multi_cleanup(multi);
+
+    for (int i = 0; i < dl->segment_count; i++) {
+        if (!dl->segments[i].done) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int download_with_curl(ethervox_model_manager_t* manager,
+                              const ethervox_model_info_t* model_info,
+                              const char* dest_path) {
+    // Ranged segments complete out of order, which cannot feed a sequential
+    // decompression stream; compressed artifacts are already 15-20% smaller
+    // on the wire, so they take the single-connection path
+    if (compressed_transfer_requested(model_info)) {
+        return download_single_with_curl(manager, model_info, dest_path);
+    }
+
+    ranged_download_t dl = {0};
+    dl.manager = manager;
+    dl.model_info = model_info;
+    snprintf(dl.part_path, sizeof(dl.part_path), "%s/%s.part", manager->cache_dir,
+             model_info->filename);
+    snprintf(dl.state_path, sizeof(dl.state_path), "%s/%s.resume", manager->cache_dir,
+             model_info->filename);
+
+    uint64_t total = 0;
+    bool ranges_supported = false;
+    if (ranged_probe(&dl, &total, &ranges_supported) != ETHERVOX_SUCCESS || !ranges_supported ||
+        total < 2 * ETHERVOX_DOWNLOAD_MIN_SEGMENT_BYTES) {
+        ETHERVOX_LOG_INFO("Range download unavailable (or file too small); using single stream");
+        return download_single_with_curl(manager, model_info, dest_path);
+    }
+    dl.total_size = total;
+
+    // Equal split, but never bother with segments too small to be worth a
+    // connection of their own
+    int count = (int)(total / ETHERVOX_DOWNLOAD_MIN_SEGMENT_BYTES);
+    if (count > ETHERVOX_DOWNLOAD_SEGMENTS) {
+        count = ETHERVOX_DOWNLOAD_SEGMENTS;
+    }
+    if (count < 1) {
+        count = 1;
+    }
+    dl.segment_count = count;
+
+    const uint64_t chunk = total / (uint64_t)count;
+    for (int i = 0; i < count; i++) {
+        dl.segments[i].owner = &dl;
+        dl.segments[i].begin = (uint64_t)i * chunk;
+        dl.segments[i].length = (i == count - 1) ? total - dl.segments[i].begin : chunk;
+    }
+
+    // Preallocate the sparse part file; a size change (new model revision)
+    // invalidates any previous partial state
+    struct stat st;
+    if (stat(dl.part_path, &st) != 0 || (uint64_t)st.st_size != total) {
+        int fd = open(dl.part_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || ftruncate(fd, (off_t)total) != 0) {
+            ETHERVOX_LOG_ERROR("Failed to preallocate %s: %s", dl.part_path, strerror(errno));
+            if (fd >= 0) {
+                close(fd);
+            }
+            return download_single_with_curl(manager, model_info, dest_path);
+        }
+        close(fd);
+        unlink(dl.state_path);
+    }
+
+    ranged_state_load(&dl);
+
+    uint64_t resumed = 0;
+    for (int i = 0; i < count; i++) {
+        dl.segments[i].fp = fopen(dl.part_path, "r+b");
+        if (!dl.segments[i].fp) {
+            ETHERVOX_LOG_ERROR("Failed to open %s for writing", dl.part_path);
+            for (int j = 0; j < i; j++) {
+                fclose(dl.segments[j].fp);
+            }
+            return ETHERVOX_ERROR_FAILED;
+        }
+        resumed += dl.segments[i].written;
+    }
+
+    ETHERVOX_LOG_INFO("Starting ranged download: %s (%d segments, %.1f%% resumed)",
+                      model_info->url, count, (double)resumed / (double)total * 100.0);
+
+    bool completed = false;
+    for (uint32_t attempt = 0; attempt <= manager->max_retries && !completed; attempt++) {
+        if (attempt > 0) {
+            ETHERVOX_LOG_WARN("Retrying download (%u/%u)", attempt, manager->max_retries);
+        }
+        completed = ranged_attempt(&dl);
+    }
+
+    ranged_state_save(&dl);
+    for (int i = 0; i < count; i++) {
+        fclose(dl.segments[i].fp);
+    }
+
+    if (!completed) {
+        // Keep the part and state files; the next call resumes from here
+        ETHERVOX_LOG_ERROR("Download failed after %u retries (progress kept for resume)",
+                           manager->max_retries);
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+#if ETHERVOX_SHA256_AVAILABLE
+    if (checksum_requested(manager, model_info) &&
+        !verify_file_sha256(dl.part_path, model_info->sha256)) {
+        quarantine_corrupted(manager, model_info, dl.part_path);
+        unlink(dl.state_path);
+        return ETHERVOX_ERROR_FAILED;
+    }
+#endif
+
+    if (rename(dl.part_path, dest_path) != 0) {
+        ETHERVOX_LOG_ERROR("Failed to move downloaded model into place: %s", strerror(errno));
+        return ETHERVOX_ERROR_FAILED;
+    }
+    unlink(dl.state_path);
+
     ETHERVOX_LOG_INFO("Download completed successfully");
     return ETHERVOX_SUCCESS;
 }
@@ -447,6 +1157,443 @@ static int download_with_wininet(ethervox_model_manager_t* manager,
 }
 #endif
 
+#if defined(USE_LIBCURL) && ETHERVOX_SHA256_AVAILABLE
+
+/* Delta updates: a refreshed fine-tune shares most tensor data byte-for-byte
+ * (and byte-position) with the file already in models_dir, so instead of
+ * re-fetching multi-GB artifacts the server publishes a small chunk-hash
+ * manifest. The local file is hashed chunk by chunk against it and only the
+ * chunks that differ are fetched as ranged requests (consecutive changed
+ * chunks coalesce into one range), written in place, and the result is
+ * verified against the manifest's whole-file SHA256. */
+
+#define ETHERVOX_DELTA_MANIFEST_MAX_BYTES (16u * 1024u * 1024u)
+#define ETHERVOX_DELTA_MIN_CHUNK_BYTES (4u * 1024u)
+#define ETHERVOX_DELTA_MAX_CHUNK_BYTES (64u * 1024u * 1024u)
+#define ETHERVOX_DELTA_MAX_CHUNKS (1u << 20)
+
+typedef struct {
+    char* data;
+    size_t size;
+} delta_manifest_buffer_t;
+
+static size_t delta_manifest_write_cb(void* ptr, size_t size, size_t nmemb, void* userdata) {
+    delta_manifest_buffer_t* buf = (delta_manifest_buffer_t*)userdata;
+    const size_t bytes = size * nmemb;
+
+    if (buf->size + bytes > ETHERVOX_DELTA_MANIFEST_MAX_BYTES) {
+        return 0;  // A manifest this large is not a manifest
+    }
+    char* grown = (char*)realloc(buf->data, buf->size + bytes + 1);
+    if (!grown) {
+        return 0;
+    }
+    memcpy(grown + buf->size, ptr, bytes);
+    buf->data = grown;
+    buf->size += bytes;
+    buf->data[buf->size] = '\0';
+    return bytes;
+}
+
+static int delta_fetch_manifest(const ethervox_model_manager_t* manager, const char* manifest_url,
+                                delta_manifest_buffer_t* buf) {
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    curl_easy_setopt(curl, CURLOPT_URL, manifest_url);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, delta_manifest_write_cb);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, buf);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, (long)manager->timeout_seconds);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "EthervoxAI-ModelManager/1.0");
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+
+    CURLcode res = curl_easy_perform(curl);
+    long code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &code);
+    curl_easy_cleanup(curl);
+
+    if (res != CURLE_OK || code != 200 || buf->size == 0) {
+        ETHERVOX_LOG_ERROR("Failed to fetch delta manifest %s (curl: %s, HTTP %ld)",
+                           manifest_url, curl_easy_strerror(res), code);
+        return ETHERVOX_ERROR_FAILED;
+    }
+    return ETHERVOX_SUCCESS;
+}
+
+typedef struct {
+    uint64_t chunk_size;
+    uint64_t file_size;
+    char sha256[65];          // Whole new file
+    char (*chunk_hashes)[65]; // One per chunk, in order
+    uint32_t chunk_count;
+} delta_manifest_t;
+
+static bool delta_hex64_copy(const char* src, char dest[65]) {
+    for (int i = 0; i < 64; i++) {
+        if (!isxdigit((unsigned char)src[i])) {
+            return false;
+        }
+        dest[i] = (char)tolower((unsigned char)src[i]);
+    }
+    dest[64] = '\0';
+    return src[64] == '\0' || isspace((unsigned char)src[64]);
+}
+
+static const char* delta_next_line(const char* cursor) {
+    const char* nl = cursor ? strchr(cursor, '\n') : NULL;
+    return nl ? nl + 1 : NULL;
+}
+
+static int delta_parse_manifest(const char* text, delta_manifest_t* manifest) {
+    memset(manifest, 0, sizeof(*manifest));
+
+    const char* cursor = text;
+    if (!cursor || strncmp(cursor, "ethervox-chunks 1", 17) != 0) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+
+    unsigned long long chunk_size = 0;
+    unsigned long long file_size = 0;
+    char hex[80];
+
+    cursor = delta_next_line(cursor);
+    if (!cursor || sscanf(cursor, "chunk-size %llu", &chunk_size) != 1) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+    cursor = delta_next_line(cursor);
+    if (!cursor || sscanf(cursor, "file-size %llu", &file_size) != 1) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+    cursor = delta_next_line(cursor);
+    if (!cursor || sscanf(cursor, "sha256 %79s", hex) != 1 ||
+        !delta_hex64_copy(hex, manifest->sha256)) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (chunk_size < ETHERVOX_DELTA_MIN_CHUNK_BYTES ||
+        chunk_size > ETHERVOX_DELTA_MAX_CHUNK_BYTES || file_size == 0) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+
+    const uint64_t count = (file_size + chunk_size - 1) / chunk_size;
+    if (count > ETHERVOX_DELTA_MAX_CHUNKS) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+
+    manifest->chunk_size = chunk_size;
+    manifest->file_size = file_size;
+    manifest->chunk_count = (uint32_t)count;
+    manifest->chunk_hashes = (char(*)[65])malloc(count * sizeof(*manifest->chunk_hashes));
+    if (!manifest->chunk_hashes) {
+        return ETHERVOX_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < manifest->chunk_count; i++) {
+        cursor = delta_next_line(cursor);
+        if (!cursor || sscanf(cursor, "%79s", hex) != 1 ||
+            !delta_hex64_copy(hex, manifest->chunk_hashes[i])) {
+            free(manifest->chunk_hashes);
+            manifest->chunk_hashes = NULL;
+            return ETHERVOX_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    return ETHERVOX_SUCCESS;
+}
+
+static bool sha256_buffer_matches(const unsigned char* data, size_t len,
+                                  const char* expected_hex) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_len = 0;
+
+    EVP_MD_CTX* md = EVP_MD_CTX_new();
+    const bool ok = md && EVP_DigestInit_ex(md, EVP_sha256(), NULL) == 1 &&
+                    EVP_DigestUpdate(md, data, len) == 1 &&
+                    EVP_DigestFinal_ex(md, digest, &digest_len) == 1;
+    EVP_MD_CTX_free(md);
+
+    return ok && sha256_digest_matches(digest, digest_len, expected_hex);
+}
+
+// Progress spans only the changed bytes: that's what goes over the wire
+typedef struct {
+    ethervox_model_manager_t* manager;
+    const ethervox_model_info_t* model_info;
+    uint64_t fetched;
+    uint64_t total_changed;
+} delta_progress_t;
+
+typedef struct {
+    FILE* fp;
+    uint64_t remaining;
+    delta_progress_t* progress;
+} delta_run_t;
+
+static size_t delta_run_write_cb(void* ptr, size_t size, size_t nmemb, void* userdata) {
+    delta_run_t* run = (delta_run_t*)userdata;
+    size_t bytes = size * nmemb;
+
+    // Never write past the run even if the server over-delivers
+    if ((uint64_t)bytes > run->remaining) {
+        bytes = (size_t)run->remaining;
+    }
+
+    const size_t written = fwrite(ptr, 1, bytes, run->fp);
+    run->remaining -= written;
+    run->progress->fetched += written;
+
+    if (written != bytes) {
+        return written;  // Short write (disk full?) aborts the transfer
+    }
+
+    delta_progress_t* progress = run->progress;
+    if (progress->manager->progress_callback && progress->total_changed > 0) {
+        progress->manager->progress_callback(
+            progress->model_info->name, progress->fetched, progress->total_changed,
+            (float)progress->fetched / (float)progress->total_changed * 100.0f,
+            progress->manager->callback_user_data);
+    }
+    return size * nmemb;
+}
+
+// Fetch one coalesced range of changed chunks into the file at its offset
+static bool delta_fetch_run(ethervox_model_manager_t* manager,
+                            const ethervox_model_info_t* model_info, FILE* fp, uint64_t begin,
+                            uint64_t length, delta_progress_t* progress) {
+    if (fseeko(fp, (off_t)begin, SEEK_SET) != 0) {
+        return false;
+    }
+
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        return false;
+    }
+
+    delta_run_t run = {fp, length, progress};
+    char range[64];
+    snprintf(range, sizeof(range), "%llu-%llu", (unsigned long long)begin,
+             (unsigned long long)(begin + length - 1));
+
+    curl_easy_setopt(curl, CURLOPT_URL, model_info->url);
+    curl_easy_setopt(curl, CURLOPT_RANGE, range);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, delta_run_write_cb);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &run);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, (long)manager->timeout_seconds);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "EthervoxAI-ModelManager/1.0");
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+
+    CURLcode res = curl_easy_perform(curl);
+    long code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &code);
+    curl_easy_cleanup(curl);
+
+    // A range must come back as 206 (200 is only acceptable when the run
+    // starts at byte zero, where the capped write still lands correctly)
+    const bool ok =
+        res == CURLE_OK && run.remaining == 0 && (code == 206 || (code == 200 && begin == 0));
+    if (!ok) {
+        ETHERVOX_LOG_WARN("Delta range %s failed (curl: %s, HTTP %ld)", range,
+                          curl_easy_strerror(res), code);
+        progress->fetched -= length - run.remaining;  // Re-counted on retry
+    }
+    fflush(fp);
+    return ok;
+}
+
+static int delta_update_with_curl(ethervox_model_manager_t* manager,
+                                  const ethervox_model_info_t* model_info,
+                                  const char* local_path) {
+    delta_manifest_buffer_t buf = {0};
+    if (delta_fetch_manifest(manager, model_info->manifest_url, &buf) != ETHERVOX_SUCCESS) {
+        free(buf.data);
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    delta_manifest_t manifest;
+    const int parsed = delta_parse_manifest(buf.data, &manifest);
+    free(buf.data);
+    if (parsed != ETHERVOX_SUCCESS) {
+        ETHERVOX_LOG_ERROR("Malformed delta manifest for %s", model_info->name);
+        return parsed;
+    }
+
+    struct stat st;
+    if (stat(local_path, &st) != 0) {
+        free(manifest.chunk_hashes);
+        return ETHERVOX_ERROR_NOT_FOUND;
+    }
+    const uint64_t local_size = (uint64_t)st.st_size;
+
+    // Hash the local file chunk by chunk against the manifest; one sequential
+    // read pass over the file, no network traffic yet
+    bool* changed = (bool*)calloc(manifest.chunk_count, sizeof(bool));
+    unsigned char* chunk_buf = (unsigned char*)malloc(manifest.chunk_size);
+    FILE* fp = fopen(local_path, "rb");
+    if (!changed || !chunk_buf || !fp) {
+        free(changed);
+        free(chunk_buf);
+        free(manifest.chunk_hashes);
+        if (fp) {
+            fclose(fp);
+        }
+        return ETHERVOX_ERROR_OUT_OF_MEMORY;
+    }
+
+    uint32_t changed_count = 0;
+    uint64_t changed_bytes = 0;
+    for (uint32_t i = 0; i < manifest.chunk_count; i++) {
+        const uint64_t begin = (uint64_t)i * manifest.chunk_size;
+        const uint64_t length = (begin + manifest.chunk_size <= manifest.file_size)
+                                    ? manifest.chunk_size
+                                    : manifest.file_size - begin;
+
+        if (begin + length > local_size ||
+            fread(chunk_buf, 1, (size_t)length, fp) != (size_t)length ||
+            !sha256_buffer_matches(chunk_buf, (size_t)length, manifest.chunk_hashes[i])) {
+            changed[i] = true;
+            changed_count++;
+            changed_bytes += length;
+            // The read cursor is only valid while chunks match; reposition
+            if (fseeko(fp, (off_t)(begin + length), SEEK_SET) != 0) {
+                break;
+            }
+        }
+    }
+    fclose(fp);
+    free(chunk_buf);
+
+    if (changed_count == 0 && local_size == manifest.file_size) {
+        ETHERVOX_LOG_INFO("Model %s already matches the published manifest", model_info->name);
+        free(changed);
+        free(manifest.chunk_hashes);
+        return ETHERVOX_SUCCESS;
+    }
+
+    ETHERVOX_LOG_INFO("Delta update %s: %u of %u chunks changed (%.1f of %.1f MB to fetch)",
+                      model_info->name, changed_count, manifest.chunk_count,
+                      (double)changed_bytes / 1024.0 / 1024.0,
+                      (double)manifest.file_size / 1024.0 / 1024.0);
+
+    fp = fopen(local_path, "r+b");
+    if (!fp) {
+        free(changed);
+        free(manifest.chunk_hashes);
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    // Grow first so ranged writes can land anywhere in the new layout
+    if (manifest.file_size > local_size && ftruncate(fileno(fp), (off_t)manifest.file_size) != 0) {
+        ETHERVOX_LOG_ERROR("Failed to grow %s: %s", local_path, strerror(errno));
+        fclose(fp);
+        free(changed);
+        free(manifest.chunk_hashes);
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    delta_progress_t progress = {manager, model_info, 0, changed_bytes};
+    bool fetch_failed = false;
+
+    for (uint32_t i = 0; i < manifest.chunk_count && !fetch_failed;) {
+        if (!changed[i]) {
+            i++;
+            continue;
+        }
+
+        // Coalesce consecutive changed chunks into one ranged request
+        uint32_t j = i;
+        while (j + 1 < manifest.chunk_count && changed[j + 1]) {
+            j++;
+        }
+        const uint64_t begin = (uint64_t)i * manifest.chunk_size;
+        const uint64_t end = ((uint64_t)(j + 1) * manifest.chunk_size < manifest.file_size)
+                                 ? (uint64_t)(j + 1) * manifest.chunk_size
+                                 : manifest.file_size;
+
+        bool ok = false;
+        for (uint32_t attempt = 0; attempt <= manager->max_retries && !ok; attempt++) {
+            if (attempt > 0) {
+                ETHERVOX_LOG_WARN("Retrying delta range (%u/%u)", attempt, manager->max_retries);
+            }
+            ok = delta_fetch_run(manager, model_info, fp, begin, end - begin, &progress);
+        }
+        fetch_failed = !ok;
+        i = j + 1;
+    }
+
+    free(changed);
+
+    if (!fetch_failed && manifest.file_size < local_size &&
+        ftruncate(fileno(fp), (off_t)manifest.file_size) != 0) {
+        fetch_failed = true;
+    }
+    fclose(fp);
+
+    if (fetch_failed) {
+        // The file now mixes old and new chunks; quarantine it rather than
+        // leave a plausible-looking hybrid in models_dir
+        ETHERVOX_LOG_ERROR("Delta update of %s failed mid-patch", model_info->name);
+        quarantine_corrupted(manager, model_info, local_path);
+        free(manifest.chunk_hashes);
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    if (!verify_file_sha256(local_path, manifest.sha256)) {
+        quarantine_corrupted(manager, model_info, local_path);
+        free(manifest.chunk_hashes);
+        return ETHERVOX_ERROR_FAILED;
+    }
+
+    ETHERVOX_LOG_INFO("Delta update complete: %s (%.1f MB fetched instead of %.1f MB)",
+                      model_info->name, (double)changed_bytes / 1024.0 / 1024.0,
+                      (double)manifest.file_size / 1024.0 / 1024.0);
+    free(manifest.chunk_hashes);
+    return ETHERVOX_SUCCESS;
+}
+
+#endif  // USE_LIBCURL && ETHERVOX_SHA256_AVAILABLE
+
+int ethervox_model_manager_update(
+    ethervox_model_manager_t* manager,
+    const ethervox_model_info_t* model_info) {
+
+    if (!manager || !model_info) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+
+    char local_path[1024];
+    snprintf(local_path, sizeof(local_path), "%s/%s", manager->models_dir, model_info->filename);
+
+    struct stat st;
+    if (stat(local_path, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ETHERVOX_LOG_INFO("No local copy of %s; delta update becomes a full download",
+                          model_info->name);
+        return ethervox_model_manager_download(manager, model_info);
+    }
+
+#if defined(USE_LIBCURL) && ETHERVOX_SHA256_AVAILABLE
+    if (model_info->manifest_url && *model_info->manifest_url) {
+        return delta_update_with_curl(manager, model_info, local_path);
+    }
+    ETHERVOX_LOG_WARN("Model %s has no chunk manifest; refreshing with a full download",
+                      model_info->name);
+    return download_with_curl(manager, model_info, local_path);
+#elif defined(USE_LIBCURL)
+    ETHERVOX_LOG_WARN("Delta updates need SHA256 support; refreshing with a full download");
+    return download_with_curl(manager, model_info, local_path);
+#elif defined(USE_WININET)
+    ETHERVOX_LOG_WARN("Delta updates need libcurl; refreshing with a full download");
+    return download_with_wininet(manager, model_info, local_path);
+#else
+    ETHERVOX_LOG_ERROR("No HTTP download support available (missing libcurl or WinINet)");
+    return ETHERVOX_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
 int ethervox_model_manager_download(
     ethervox_model_manager_t* manager,
     const ethervox_model_info_t* model_info) {
@@ -512,6 +1659,74 @@ int ethervox_model_manager_ensure_available(
     return ETHERVOX_ERROR_NOT_FOUND;
 }
 
+const ethervox_model_info_t* ethervox_model_manager_select_variant(
+    ethervox_model_family_t family,
+    uint32_t ram_mb,
+    uint32_t headroom_mb) {
+
+    if (family < 0 || family >= ETHERVOX_MODEL_FAMILY_COUNT || ram_mb == 0) {
+        return NULL;
+    }
+
+    if (headroom_mb == 0) {
+        headroom_mb = ETHERVOX_MODEL_HEADROOM_DEFAULT_MB;
+    }
+
+    const uint32_t budget_mb = ram_mb > headroom_mb ? ram_mb - headroom_mb : 0;
+    const model_family_entry_t* entry = &kModelFamilies[family];
+
+    for (size_t i = 0; i < entry->count; i++) {
+        const ethervox_model_info_t* variant = entry->variants[i];
+        if (variant->min_ram_mb <= budget_mb) {
+            ETHERVOX_LOG_INFO("Selected %s for %u MB RAM (%u MB headroom)",
+                              variant->name, ram_mb, headroom_mb);
+            return variant;
+        }
+    }
+
+    ETHERVOX_LOG_WARN("No variant of family %d fits in %u MB RAM with %u MB headroom "
+                      "(smallest needs %u MB); refusing a model that would swap",
+                      (int)family, ram_mb, headroom_mb,
+                      entry->count > 0 ? entry->variants[entry->count - 1]->min_ram_mb : 0);
+    return NULL;
+}
+
+const ethervox_model_info_t* ethervox_model_manager_select_for_platform(
+    ethervox_model_family_t family,
+    uint32_t headroom_mb) {
+
+    ethervox_platform_capabilities_t caps = ethervox_platform_get_capabilities();
+    if (caps.ram_size_mb == 0) {
+        ETHERVOX_LOG_WARN("Platform RAM size unknown; cannot select a model variant");
+        return NULL;
+    }
+
+    return ethervox_model_manager_select_variant(family, caps.ram_size_mb, headroom_mb);
+}
+
+int ethervox_model_manager_ensure_family_available(
+    ethervox_model_manager_t* manager,
+    ethervox_model_family_t family,
+    uint32_t headroom_mb,
+    const ethervox_model_info_t** selected) {
+
+    if (!manager || family < 0 || family >= ETHERVOX_MODEL_FAMILY_COUNT) {
+        return ETHERVOX_ERROR_INVALID_ARGUMENT;
+    }
+
+    const ethervox_model_info_t* variant =
+        ethervox_model_manager_select_for_platform(family, headroom_mb);
+    if (!variant) {
+        return ETHERVOX_ERROR_NOT_FOUND;
+    }
+
+    if (selected) {
+        *selected = variant;
+    }
+
+    return ethervox_model_manager_ensure_available(manager, variant);
+}
+
 uint64_t ethervox_model_manager_get_available_space(const char* path) {
 #ifdef _WIN32
     ULARGE_INTEGER free_bytes;
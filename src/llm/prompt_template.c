@@ -0,0 +1,325 @@
+/**
+ * @file prompt_template.c
+ * @brief Pre-tokenized prompt template cache for EthervoxAI
+ *
+ * Assembling a turn's prompt by concatenating strings makes the backend
+ * re-tokenize the system preamble and the whole conversation history every
+ * turn. This module tokenizes the fixed segments once, caches per-history-
+ * entry token runs, and splices token arrays so per-turn tokenization work
+ * is just the new utterance.
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+#include "ethervox/llm.h"
+#include "ethervox/error.h"
+#include "ethervox/logging.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// History entries whose token runs stay cached (LRU eviction). Sized to
+// comfortably cover the dialogue engine's history ring.
+#define PROMPT_TEMPLATE_CACHE_SLOTS 16
+
+// One tokenized piece of text
+typedef struct {
+  int32_t* tokens;
+  uint32_t count;
+} prompt_segment_t;
+
+// Cached history entry: the exact turn text and its token run
+typedef struct {
+  char* text;
+  prompt_segment_t segment;
+  uint64_t last_used;
+} prompt_cache_slot_t;
+
+struct ethervox_prompt_template {
+  ethervox_llm_backend_t* backend;
+
+  // Fixed segments, tokenized once at create time
+  prompt_segment_t system_prompt;
+  prompt_segment_t user_prefix;
+  prompt_segment_t assistant_prefix;
+
+  prompt_cache_slot_t cache[PROMPT_TEMPLATE_CACHE_SLOTS];
+  uint64_t use_counter;
+
+  // Output buffer reused across builds (grown, never shrunk)
+  int32_t* out_tokens;
+  uint32_t out_capacity;
+
+  // Scratch for tokenizing the per-turn utterance
+  int32_t* scratch;
+  uint32_t scratch_capacity;
+};
+
+// Tokenize text into a malloc'd buffer via the backend hook, retrying once
+// with the required capacity when the first guess is too small
+static int prompt_tokenize_alloc(ethervox_llm_backend_t* backend, const char* text,
+                                 prompt_segment_t* segment) {
+  segment->tokens = NULL;
+  segment->count = 0;
+
+  if (!text || !*text) {
+    return ETHERVOX_SUCCESS;  // Empty segment splices as nothing
+  }
+
+  uint32_t capacity = (uint32_t)strlen(text) + 8;
+  int32_t* tokens = (int32_t*)malloc(capacity * sizeof(int32_t));
+  if (!tokens) {
+    return ETHERVOX_ERROR_OUT_OF_MEMORY;
+  }
+
+  int count = backend->tokenize(backend, text, tokens, capacity);
+  if (count < 0 && (uint32_t)(-count) > capacity) {
+    capacity = (uint32_t)(-count);
+    int32_t* grown = (int32_t*)realloc(tokens, capacity * sizeof(int32_t));
+    if (!grown) {
+      free(tokens);
+      return ETHERVOX_ERROR_OUT_OF_MEMORY;
+    }
+    tokens = grown;
+    count = backend->tokenize(backend, text, tokens, capacity);
+  }
+
+  if (count < 0) {
+    ETHERVOX_LOG_ERROR("Tokenization failed for prompt segment");
+    free(tokens);
+    return ETHERVOX_ERROR_FAILED;
+  }
+
+  segment->tokens = tokens;
+  segment->count = (uint32_t)count;
+  return ETHERVOX_SUCCESS;
+}
+
+static void prompt_segment_free(prompt_segment_t* segment) {
+  free(segment->tokens);
+  segment->tokens = NULL;
+  segment->count = 0;
+}
+
+// Look up (or tokenize and cache) the token run for one history turn
+static const prompt_segment_t* prompt_cache_lookup(ethervox_prompt_template_t* tmpl,
+                                                   const char* text) {
+  prompt_cache_slot_t* victim = &tmpl->cache[0];
+
+  for (int i = 0; i < PROMPT_TEMPLATE_CACHE_SLOTS; i++) {
+    prompt_cache_slot_t* slot = &tmpl->cache[i];
+    if (slot->text && strcmp(slot->text, text) == 0) {
+      slot->last_used = ++tmpl->use_counter;
+      return &slot->segment;
+    }
+    if (!victim->text) {
+      continue;  // Already found an empty slot; keep it
+    }
+    if (!slot->text || slot->last_used < victim->last_used) {
+      victim = slot;
+    }
+  }
+
+  // Miss: tokenize into the victim slot
+  prompt_segment_t segment;
+  if (prompt_tokenize_alloc(tmpl->backend, text, &segment) != ETHERVOX_SUCCESS) {
+    return NULL;
+  }
+
+  free(victim->text);
+  prompt_segment_free(&victim->segment);
+
+  victim->text = strdup(text);
+  if (!victim->text) {
+    prompt_segment_free(&segment);
+    return NULL;
+  }
+  victim->segment = segment;
+  victim->last_used = ++tmpl->use_counter;
+  return &victim->segment;
+}
+
+ethervox_prompt_template_t* ethervox_prompt_template_create(
+    ethervox_llm_backend_t* backend,
+    const char* system_prompt,
+    const char* user_prefix,
+    const char* assistant_prefix) {
+  if (!backend || !backend->tokenize) {
+    ETHERVOX_LOG_ERROR("Prompt templates need a backend with a tokenize hook");
+    return NULL;
+  }
+
+  ethervox_prompt_template_t* tmpl =
+      (ethervox_prompt_template_t*)calloc(1, sizeof(ethervox_prompt_template_t));
+  if (!tmpl) {
+    ETHERVOX_LOG_ERROR("Failed to allocate prompt template");
+    return NULL;
+  }
+
+  tmpl->backend = backend;
+
+  if (prompt_tokenize_alloc(backend, system_prompt, &tmpl->system_prompt) != ETHERVOX_SUCCESS ||
+      prompt_tokenize_alloc(backend, user_prefix, &tmpl->user_prefix) != ETHERVOX_SUCCESS ||
+      prompt_tokenize_alloc(backend, assistant_prefix, &tmpl->assistant_prefix) !=
+          ETHERVOX_SUCCESS) {
+    ethervox_prompt_template_destroy(tmpl);
+    return NULL;
+  }
+
+  ETHERVOX_LOG_INFO("Prompt template created (%u fixed tokens)",
+                    tmpl->system_prompt.count + tmpl->user_prefix.count +
+                        tmpl->assistant_prefix.count);
+  return tmpl;
+}
+
+// Tokenize the per-turn utterance into the template's reusable scratch
+// buffer so steady-state builds allocate nothing
+static int prompt_tokenize_scratch(ethervox_prompt_template_t* tmpl, const char* text,
+                                   uint32_t* count_out) {
+  *count_out = 0;
+  if (!*text) {
+    return ETHERVOX_SUCCESS;
+  }
+
+  const uint32_t needed = (uint32_t)strlen(text) + 8;
+  if (tmpl->scratch_capacity < needed) {
+    int32_t* grown = (int32_t*)realloc(tmpl->scratch, needed * sizeof(int32_t));
+    if (!grown) {
+      return ETHERVOX_ERROR_OUT_OF_MEMORY;
+    }
+    tmpl->scratch = grown;
+    tmpl->scratch_capacity = needed;
+  }
+
+  int count = tmpl->backend->tokenize(tmpl->backend, text, tmpl->scratch,
+                                      tmpl->scratch_capacity);
+  if (count < 0 && (uint32_t)(-count) > tmpl->scratch_capacity) {
+    int32_t* grown = (int32_t*)realloc(tmpl->scratch, (uint32_t)(-count) * sizeof(int32_t));
+    if (!grown) {
+      return ETHERVOX_ERROR_OUT_OF_MEMORY;
+    }
+    tmpl->scratch = grown;
+    tmpl->scratch_capacity = (uint32_t)(-count);
+    count = tmpl->backend->tokenize(tmpl->backend, text, tmpl->scratch,
+                                    tmpl->scratch_capacity);
+  }
+
+  if (count < 0) {
+    ETHERVOX_LOG_ERROR("Tokenization failed for utterance");
+    return ETHERVOX_ERROR_FAILED;
+  }
+
+  *count_out = (uint32_t)count;
+  return ETHERVOX_SUCCESS;
+}
+
+// Append one segment to the output buffer, growing it as needed
+static int prompt_out_append(ethervox_prompt_template_t* tmpl, uint32_t* out_count,
+                             const int32_t* tokens, uint32_t count) {
+  if (count == 0) {
+    return ETHERVOX_SUCCESS;
+  }
+
+  if (*out_count + count > tmpl->out_capacity) {
+    uint32_t capacity = tmpl->out_capacity ? tmpl->out_capacity : 256;
+    while (*out_count + count > capacity) {
+      capacity *= 2;
+    }
+    int32_t* grown = (int32_t*)realloc(tmpl->out_tokens, capacity * sizeof(int32_t));
+    if (!grown) {
+      return ETHERVOX_ERROR_OUT_OF_MEMORY;
+    }
+    tmpl->out_tokens = grown;
+    tmpl->out_capacity = capacity;
+  }
+
+  memcpy(tmpl->out_tokens + *out_count, tokens, count * sizeof(int32_t));
+  *out_count += count;
+  return ETHERVOX_SUCCESS;
+}
+
+int ethervox_prompt_template_build(ethervox_prompt_template_t* tmpl,
+                                  const char* const* history_turns,
+                                  uint32_t history_count,
+                                  const char* utterance,
+                                  const int32_t** tokens_out,
+                                  uint32_t* token_count_out) {
+  if (!tmpl || !utterance || !tokens_out || !token_count_out) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+  if (history_count > 0 && !history_turns) {
+    return ETHERVOX_ERROR_INVALID_ARGUMENT;
+  }
+
+  uint32_t out_count = 0;
+  int result = prompt_out_append(tmpl, &out_count, tmpl->system_prompt.tokens,
+                                 tmpl->system_prompt.count);
+
+  for (uint32_t i = 0; result == ETHERVOX_SUCCESS && i < history_count; i++) {
+    if (!history_turns[i] || !*history_turns[i]) {
+      continue;
+    }
+    const prompt_segment_t* turn = prompt_cache_lookup(tmpl, history_turns[i]);
+    if (!turn) {
+      result = ETHERVOX_ERROR_FAILED;
+      break;
+    }
+    result = prompt_out_append(tmpl, &out_count, tmpl->user_prefix.tokens,
+                               tmpl->user_prefix.count);
+    if (result == ETHERVOX_SUCCESS) {
+      result = prompt_out_append(tmpl, &out_count, turn->tokens, turn->count);
+    }
+  }
+
+  // Only the new utterance is tokenized fresh
+  if (result == ETHERVOX_SUCCESS) {
+    uint32_t fresh_count = 0;
+    result = prompt_tokenize_scratch(tmpl, utterance, &fresh_count);
+    if (result == ETHERVOX_SUCCESS) {
+      result = prompt_out_append(tmpl, &out_count, tmpl->user_prefix.tokens,
+                                 tmpl->user_prefix.count);
+      if (result == ETHERVOX_SUCCESS) {
+        result = prompt_out_append(tmpl, &out_count, tmpl->scratch, fresh_count);
+      }
+      if (result == ETHERVOX_SUCCESS) {
+        result = prompt_out_append(tmpl, &out_count, tmpl->assistant_prefix.tokens,
+                                   tmpl->assistant_prefix.count);
+      }
+    }
+  }
+
+  if (result != ETHERVOX_SUCCESS) {
+    return result;
+  }
+
+  *tokens_out = tmpl->out_tokens;
+  *token_count_out = out_count;
+  return ETHERVOX_SUCCESS;
+}
+
+void ethervox_prompt_template_destroy(ethervox_prompt_template_t* tmpl) {
+  if (!tmpl) {
+    return;
+  }
+
+  prompt_segment_free(&tmpl->system_prompt);
+  prompt_segment_free(&tmpl->user_prefix);
+  prompt_segment_free(&tmpl->assistant_prefix);
+
+  for (int i = 0; i < PROMPT_TEMPLATE_CACHE_SLOTS; i++) {
+    free(tmpl->cache[i].text);
+    prompt_segment_free(&tmpl->cache[i].segment);
+  }
+
+  free(tmpl->out_tokens);
+  free(tmpl->scratch);
+  free(tmpl);
+}
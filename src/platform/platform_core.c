@@ -25,8 +25,26 @@
 
 #ifdef ETHERVOX_PLATFORM_WINDOWS
 #include <windows.h>
+#elif defined(ETHERVOX_PLATFORM_DESKTOP)
+#include <unistd.h>  // sysconf core-count probe
+#endif
+
+// The telemetry refresher needs a thread; without pthreads the snapshot is
+// refreshed lazily from ethervox_platform_get_telemetry() instead
+#if defined(__has_include)
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define ETHERVOX_PLATFORM_TELEMETRY_THREAD 1
+#endif
+#endif
+#ifndef ETHERVOX_PLATFORM_TELEMETRY_THREAD
+#define ETHERVOX_PLATFORM_TELEMETRY_THREAD 0
 #endif
 
+static const uint32_t kTelemetryPeriodDefaultMs = 1000U;
+
+static void platform_sample_telemetry(ethervox_platform_t* platform);
+
 // Forward declarations ONLY (no function bodies)
 #ifdef ETHERVOX_PLATFORM_RPI
 #pragma message("-----Compiling with ETHERVOX_PLATFORM_RPI")
@@ -80,8 +98,13 @@ const char* ethervox_platform_get_name(void) {
 #endif
 }
 
-// Get platform capabilities
-ethervox_platform_capabilities_t ethervox_platform_get_capabilities(void) {
+// Get platform capabilities. The answers cannot change while the process
+// runs, so the snapshot is built once and every later call (including the
+// has_capability lookups below) is a struct copy with no probing.
+static ethervox_platform_capabilities_t g_capability_snapshot;
+static bool g_capability_snapshot_valid = false;
+
+static ethervox_platform_capabilities_t platform_probe_capabilities(void) {
   ethervox_platform_capabilities_t caps = {0};
 
 #ifdef ETHERVOX_PLATFORM_ESP32
@@ -102,6 +125,7 @@ ethervox_platform_capabilities_t ethervox_platform_get_capabilities(void) {
   caps.gpio_pin_count = 34;
   caps.ram_size_mb = 8;
   caps.flash_size_mb = 16;
+  caps.cpu_core_count = 2;  // Xtensa LX7 dual core
 
 #elif defined(ETHERVOX_PLATFORM_RPI)
   caps.has_audio_input = true;
@@ -121,6 +145,7 @@ ethervox_platform_capabilities_t ethervox_platform_get_capabilities(void) {
   caps.gpio_pin_count = 40;
   caps.ram_size_mb = 8192;  // 8GB for Pi 5
   caps.flash_size_mb = 0;   // SD card storage
+  caps.cpu_core_count = 4;  // Every Pi since the 2 has four cores
 
 #elif defined(ETHERVOX_PLATFORM_DESKTOP)
   caps.has_audio_input = true;
@@ -140,6 +165,14 @@ ethervox_platform_capabilities_t ethervox_platform_get_capabilities(void) {
   caps.gpio_pin_count = 0;
   caps.ram_size_mb = 16384;  // 16GB typical
   caps.flash_size_mb = 0;    // SSD storage
+#ifdef ETHERVOX_PLATFORM_WINDOWS
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+  caps.cpu_core_count = (uint32_t)system_info.dwNumberOfProcessors;
+#else
+  const long online_cores = sysconf(_SC_NPROCESSORS_ONLN);
+  caps.cpu_core_count = online_cores > 0 ? (uint32_t)online_cores : 0;
+#endif
 #else
   // Safe defaultim_spec for unknown platforms
   caps.has_audio_input = false;
@@ -164,6 +197,14 @@ ethervox_platform_capabilities_t ethervox_platform_get_capabilities(void) {
   return caps;
 }
 
+ethervox_platform_capabilities_t ethervox_platform_get_capabilities(void) {
+  if (!g_capability_snapshot_valid) {
+    g_capability_snapshot = platform_probe_capabilities();
+    g_capability_snapshot_valid = true;
+  }
+  return g_capability_snapshot;
+}
+
 // Check if platform has specific capability
 bool ethervox_platform_has_capability(const char* capability) {
   if (!capability) {
@@ -269,6 +310,10 @@ int ethervox_platform_init(ethervox_platform_t* platform) {
 
   platform->is_initialized = true;
 
+  // Seed the telemetry cache so the snapshot is never empty, even before
+  // (or without) the background refresher
+  platform_sample_telemetry(platform);
+
   printf("Platform initialized: %s (%s)\n", platform->info.platform_name,
          platform->info.hardware_revision);
 
@@ -281,6 +326,10 @@ void ethervox_platform_cleanup(ethervox_platform_t* platform) {
     return;
   }
 
+  if (platform->telemetry_running) {
+    ethervox_platform_stop_telemetry(platform);
+  }
+
   if (platform->hal.cleanup) {
     platform->hal.cleanup(&platform->info);
   }
@@ -298,6 +347,114 @@ uint64_t ethervox_platform_get_uptime_ms(ethervox_platform_t* platform) {
   return (current_time - platform->boot_time) / 1000;
 }
 
+// Take one telemetry sample through the HAL getters. This is the only place
+// that pays the file-I/O cost; everything else reads the cached struct.
+static void platform_sample_telemetry(ethervox_platform_t* platform) {
+  ethervox_platform_telemetry_t sample = {0};
+
+  if (platform->hal.get_cpu_temperature) {
+    sample.cpu_temperature_c = platform->hal.get_cpu_temperature();
+  }
+  if (platform->hal.get_free_heap_size) {
+    sample.free_heap_kb = platform->hal.get_free_heap_size();
+  }
+  sample.cpu_frequency_mhz = platform->info.cpu_frequency_mhz;
+  sample.sampled_at_us = get_system_timestamp_us();
+
+  // Whole-struct store; readers may see a snapshot mid-update but each field
+  // is individually coherent, which is all a metrics loop needs
+  platform->telemetry = sample;
+}
+
+#if ETHERVOX_PLATFORM_TELEMETRY_THREAD
+static void* platform_telemetry_thread(void* arg) {
+  ethervox_platform_t* platform = (ethervox_platform_t*)arg;
+
+  while (platform->telemetry_running) {
+    platform_sample_telemetry(platform);
+
+    // Sleep in short slices so stop_telemetry never waits a full period
+    uint32_t remaining_ms = platform->telemetry_period_ms;
+    while (remaining_ms > 0 && platform->telemetry_running) {
+      const uint32_t slice_ms = remaining_ms < 100 ? remaining_ms : 100;
+      struct timespec ts = {.tv_sec = 0, .tv_nsec = (long)slice_ms * 1000000L};
+      nanosleep(&ts, NULL);
+      remaining_ms -= slice_ms;
+    }
+  }
+
+  return NULL;
+}
+#endif
+
+int ethervox_platform_start_telemetry(ethervox_platform_t* platform, uint32_t period_ms) {
+  if (!platform || !platform->is_initialized || platform->telemetry_running) {
+    return -1;
+  }
+
+  platform->telemetry_period_ms = period_ms ? period_ms : kTelemetryPeriodDefaultMs;
+
+#if ETHERVOX_PLATFORM_TELEMETRY_THREAD
+  pthread_t* thread = (pthread_t*)malloc(sizeof(pthread_t));
+  if (!thread) {
+    return -1;
+  }
+
+  platform->telemetry_running = true;
+  if (pthread_create(thread, NULL, platform_telemetry_thread, platform) != 0) {
+    platform->telemetry_running = false;
+    free(thread);
+    snprintf(platform->last_error, sizeof(platform->last_error),
+             "Failed to start telemetry thread");
+    return -1;
+  }
+
+  platform->telemetry_thread = thread;
+  return 0;
+#else
+  snprintf(platform->last_error, sizeof(platform->last_error),
+           "Telemetry thread unavailable on this platform");
+  return -1;
+#endif
+}
+
+int ethervox_platform_stop_telemetry(ethervox_platform_t* platform) {
+  if (!platform || !platform->telemetry_running) {
+    return -1;
+  }
+
+#if ETHERVOX_PLATFORM_TELEMETRY_THREAD
+  platform->telemetry_running = false;
+  pthread_join(*(pthread_t*)platform->telemetry_thread, NULL);
+  free(platform->telemetry_thread);
+  platform->telemetry_thread = NULL;
+  return 0;
+#else
+  return -1;
+#endif
+}
+
+ethervox_platform_telemetry_t ethervox_platform_get_telemetry(ethervox_platform_t* platform) {
+  ethervox_platform_telemetry_t empty = {0};
+  if (!platform || !platform->is_initialized) {
+    return empty;
+  }
+
+  // Lazy fallback: with no refresher running, re-sample inline once the
+  // snapshot goes stale so callers still see current values
+  if (!platform->telemetry_running) {
+    const uint32_t period_ms =
+        platform->telemetry_period_ms ? platform->telemetry_period_ms : kTelemetryPeriodDefaultMs;
+    const uint64_t age_us = get_system_timestamp_us() - platform->telemetry.sampled_at_us;
+    if (platform->telemetry.sampled_at_us == 0 ||
+        age_us > (uint64_t)period_ms * ETHERVOX_PLATFORM_US_PER_MS) {
+      platform_sample_telemetry(platform);
+    }
+  }
+
+  return platform->telemetry;
+}
+
 // GPIO configuration helper
 int ethervox_gpio_configure_pin(ethervox_platform_t* platform,
                                 const ethervox_gpio_config_t* config) {
@@ -19,6 +19,7 @@
 #include <time.h>
 
 #include "ethervox/plugins.h"
+#include "ethervox/scheduler.h"
 
 // Dynamic library loading not supported on ESP32
 #if !defined(ETHERVOX_PLATFORM_ESP32) && !defined(PLATFORM_EMBEDDED)
@@ -29,6 +30,18 @@
 #endif
 #endif
 
+// Async execution needs a thread pool; platforms without pthreads fall back
+// to synchronous execution in ethervox_plugin_execute_async()
+#if defined(__has_include)
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define ETHERVOX_PLUGIN_ASYNC_AVAILABLE 1
+#endif
+#endif
+#ifndef ETHERVOX_PLUGIN_ASYNC_AVAILABLE
+#define ETHERVOX_PLUGIN_ASYNC_AVAILABLE 0
+#endif
+
 // Plugin type to string mapping
 const char* ethervox_plugin_type_to_string(ethervox_plugin_type_t type) {
   switch (type) {
@@ -67,6 +80,52 @@ const char* ethervox_plugin_status_to_string(ethervox_plugin_status_t status) {
   }
 }
 
+// FNV-1a over the plugin name for the open-addressed slot index
+static uint32_t plugin_name_hash(const char* name) {
+  uint32_t hash = 2166136261U;
+  while (*name) {
+    hash ^= (unsigned char)*name++;
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+// Rebuild the per-type dispatch lists and the name hash from the plugin
+// array. Called whenever the plugin set or a priority changes; dispatch and
+// lookup paths then never touch unloaded slots or scan the full array.
+static void plugin_index_rebuild(ethervox_plugin_manager_t* manager) {
+  const uint32_t mask = (uint32_t)(sizeof(manager->name_index) / sizeof(manager->name_index[0])) - 1;
+
+  memset(manager->dispatch_counts, 0, sizeof(manager->dispatch_counts));
+  memset(manager->name_index, 0, sizeof(manager->name_index));
+
+  for (uint32_t i = 0; i < manager->max_plugins && i < ETHERVOX_MAX_PLUGINS; i++) {
+    ethervox_plugin_t* plugin = &manager->plugins[i];
+    if (plugin->status == ETHERVOX_PLUGIN_STATUS_UNLOADED ||
+        plugin->metadata.type >= ETHERVOX_PLUGIN_COUNT) {
+      continue;
+    }
+
+    // Insert into the type list keeping descending priority order (stable)
+    uint8_t* list = manager->dispatch_lists[plugin->metadata.type];
+    uint8_t count = manager->dispatch_counts[plugin->metadata.type];
+    uint8_t pos = count;
+    while (pos > 0 && manager->plugins[list[pos - 1]].priority < plugin->priority) {
+      list[pos] = list[pos - 1];
+      pos--;
+    }
+    list[pos] = (uint8_t)i;
+    manager->dispatch_counts[plugin->metadata.type] = (uint8_t)(count + 1);
+
+    // Index the name for O(1) find
+    uint32_t probe = plugin_name_hash(plugin->metadata.name) & mask;
+    while (manager->name_index[probe] != 0) {
+      probe = (probe + 1) & mask;
+    }
+    manager->name_index[probe] = (uint8_t)(i + 1);
+  }
+}
+
 // Initialize plugin manager
 int ethervox_plugin_manager_init(ethervox_plugin_manager_t* manager, const char* plugin_dir) {
   if (!manager) {
@@ -101,6 +160,8 @@ int ethervox_plugin_manager_init(ethervox_plugin_manager_t* manager, const char*
   ethervox_plugin_register_builtin_huggingface(manager);
   ethervox_plugin_register_builtin_local_rag(manager);
 
+  plugin_index_rebuild(manager);
+
   return 0;
 }
 
@@ -110,6 +171,8 @@ void ethervox_plugin_manager_cleanup(ethervox_plugin_manager_t* manager) {
     return;
   }
 
+  ethervox_plugin_executor_stop(manager);
+
   // Unload all plugins
   for (size_t i = 0; i < manager->plugin_count; i++) {
     ethervox_plugin_t* plugin = &manager->plugins[i];
@@ -127,26 +190,65 @@ void ethervox_plugin_manager_cleanup(ethervox_plugin_manager_t* manager) {
 
   manager->plugin_count = 0;
   manager->is_initialized = false;
+  memset(manager->dispatch_counts, 0, sizeof(manager->dispatch_counts));
+  memset(manager->name_index, 0, sizeof(manager->name_index));
 }
 
-// Find plugin by name
+// Find plugin by name through the hash index
 ethervox_plugin_t* ethervox_plugin_find(ethervox_plugin_manager_t* manager,
                                         const char* plugin_name) {
   if (!manager || !plugin_name) {
     return NULL;
   }
 
-  for (uint32_t i = 0; i < manager->max_plugins; i++) {
-    ethervox_plugin_t* plugin = &manager->plugins[i];
+  const uint32_t mask = (uint32_t)(sizeof(manager->name_index) / sizeof(manager->name_index[0])) - 1;
+  uint32_t probe = plugin_name_hash(plugin_name) & mask;
+
+  while (manager->name_index[probe] != 0) {
+    ethervox_plugin_t* plugin = &manager->plugins[manager->name_index[probe] - 1];
     if (plugin->status != ETHERVOX_PLUGIN_STATUS_UNLOADED &&
         strcmp(plugin->metadata.name, plugin_name) == 0) {
       return plugin;
     }
+    probe = (probe + 1) & mask;
   }
 
   return NULL;
 }
 
+uint32_t ethervox_plugin_count_of_type(const ethervox_plugin_manager_t* manager,
+                                       ethervox_plugin_type_t type) {
+  if (!manager || type >= ETHERVOX_PLUGIN_COUNT) {
+    return 0;
+  }
+  return manager->dispatch_counts[type];
+}
+
+ethervox_plugin_t* ethervox_plugin_of_type_at(ethervox_plugin_manager_t* manager,
+                                              ethervox_plugin_type_t type, uint32_t index) {
+  if (!manager || type >= ETHERVOX_PLUGIN_COUNT || index >= manager->dispatch_counts[type]) {
+    return NULL;
+  }
+  return &manager->plugins[manager->dispatch_lists[type][index]];
+}
+
+ethervox_plugin_t* ethervox_plugin_first_of_type(ethervox_plugin_manager_t* manager,
+                                                 ethervox_plugin_type_t type) {
+  return ethervox_plugin_of_type_at(manager, type, 0);
+}
+
+int ethervox_plugin_set_priority(ethervox_plugin_manager_t* manager, const char* plugin_name,
+                                 int priority) {
+  ethervox_plugin_t* plugin = ethervox_plugin_find(manager, plugin_name);
+  if (!plugin) {
+    return -1;
+  }
+
+  plugin->priority = priority;
+  plugin_index_rebuild(manager);
+  return 0;
+}
+
 // Load plugin (placeholder implementation)
 int ethervox_plugin_load(ethervox_plugin_manager_t* manager, const char* plugin_name) {
   if (!manager || !plugin_name) {
@@ -176,6 +278,8 @@ int ethervox_plugin_load(ethervox_plugin_manager_t* manager, const char* plugin_
       plugin->load_time = time(NULL);
       manager->loaded_plugins++;
 
+      plugin_index_rebuild(manager);
+
       printf("Plugin loaded: %s\n", plugin_name);
       return 0;
     }
@@ -202,23 +306,504 @@ static int local_rag_execute_wrapper(const void* input, void* output) {
                                        (ethervox_llm_response_t*)output, NULL);
 }
 
+// Atomic helpers for the reload epoch/refcount (see ethervox_plugin_reload)
+#if defined(_WIN32) && !defined(__GNUC__)
+#define plugin_atomic_inc(p) InterlockedIncrement((volatile LONG*)(p))
+#define plugin_atomic_dec(p) InterlockedDecrement((volatile LONG*)(p))
+#define plugin_atomic_load(p) (*(p))
+#define plugin_atomic_fence() MemoryBarrier()
+#else
+#define plugin_atomic_inc(p) __atomic_add_fetch((p), 1U, __ATOMIC_ACQ_REL)
+#define plugin_atomic_dec(p) __atomic_sub_fetch((p), 1U, __ATOMIC_ACQ_REL)
+#define plugin_atomic_load(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define plugin_atomic_fence() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
 int ethervox_plugin_execute(ethervox_plugin_t* plugin, const void* input, void* output) {
   if (!plugin || plugin->status != ETHERVOX_PLUGIN_STATUS_LOADED) {
     return -1;
   }
 
+  // Count this dispatch into the current reload epoch so a concurrent
+  // ethervox_plugin_reload() can wait for us before closing the old library.
+  // The epoch is re-validated after the increment: a reload flipping it
+  // between the read and the increment would have seen our bucket already
+  // drained, so an unvalidated count could execute inside a dlclose'd
+  // library. On mismatch, back out and retry into the new bucket.
+  uint32_t epoch;
+  for (;;) {
+    epoch = plugin_atomic_load(&plugin->reload_epoch) & 1U;
+    plugin_atomic_inc(&plugin->inflight[epoch]);
+    // Full fence: the re-read must not float above the increment, or both
+    // sides of the handshake could miss each other (store-load reordering)
+    plugin_atomic_fence();
+    if ((plugin_atomic_load(&plugin->reload_epoch) & 1U) == epoch) {
+      break;
+    }
+    plugin_atomic_dec(&plugin->inflight[epoch]);
+  }
+
   plugin->last_used = time(NULL);
   plugin->usage_count++;
 
-  if (plugin->plugin_interface.process) {
-    return plugin->plugin_interface.process(plugin, input, output);
+  // Read the dispatch pointers once; reload may swap them underneath us
+  int (*process)(struct ethervox_plugin*, const void*, void*) = plugin->plugin_interface.process;
+  int (*execute)(const void*, void*) = plugin->execute;
+
+  int result = -1;
+  if (process) {
+    result = process(plugin, input, output);
+  } else if (execute) {
+    result = execute(input, output);
+  }
+
+  plugin_atomic_dec(&plugin->inflight[epoch]);
+  return result;
+}
+
+// Hot reload: the new library version is loaded into a shadow handle while
+// the old one keeps serving dispatches, then the dispatch pointers are
+// swapped and the epoch flipped. dlclose of the old handle is deferred until
+// every dispatch that started under the old epoch has drained, so in-flight
+// executions never touch a closed library and the pipeline never pauses.
+int ethervox_plugin_reload(ethervox_plugin_manager_t* manager, const char* plugin_name) {
+  ethervox_plugin_t* plugin = ethervox_plugin_find(manager, plugin_name);
+  if (!plugin) {
+    return -1;
   }
 
-  if (plugin->execute) {
-    return plugin->execute(input, output);
+#if !defined(ETHERVOX_PLATFORM_ESP32) && !defined(PLATFORM_EMBEDDED)
+  if (!plugin->handle) {
+    fprintf(stderr, "Plugin %s is built in; nothing to reload\n", plugin_name);
+    return -1;
   }
 
+  char path[576];
+#ifdef _WIN32
+  snprintf(path, sizeof(path), "%s\\%s.dll", manager->plugin_directory, plugin_name);
+  HMODULE new_handle = LoadLibraryA(path);
+  if (!new_handle) {
+    fprintf(stderr, "Failed to load new version of plugin %s\n", plugin_name);
+    return -1;
+  }
+  int (*new_execute)(const void*, void*) =
+      (int (*)(const void*, void*))GetProcAddress(new_handle, "ethervox_plugin_execute");
+  int (*new_process)(struct ethervox_plugin*, const void*, void*) =
+      (int (*)(struct ethervox_plugin*, const void*, void*))GetProcAddress(
+          new_handle, "ethervox_plugin_process");
+#else
+  snprintf(path, sizeof(path), "%s/%s.so", manager->plugin_directory, plugin_name);
+  void* new_handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  if (!new_handle) {
+    fprintf(stderr, "Failed to load new version of plugin %s: %s\n", plugin_name, dlerror());
+    return -1;
+  }
+  int (*new_execute)(const void*, void*) =
+      (int (*)(const void*, void*))dlsym(new_handle, "ethervox_plugin_execute");
+  int (*new_process)(struct ethervox_plugin*, const void*, void*) =
+      (int (*)(struct ethervox_plugin*, const void*, void*))dlsym(new_handle,
+                                                                  "ethervox_plugin_process");
+#endif
+
+  if (!new_execute && !new_process) {
+    fprintf(stderr, "New version of plugin %s exports no entry point\n", plugin_name);
+#ifdef _WIN32
+    FreeLibrary(new_handle);
+#else
+    dlclose(new_handle);
+#endif
+    return -1;
+  }
+
+  // Publish the new version: dispatch pointers first, then the epoch flip.
+  // Dispatches that read the old epoch may still pick up new pointers, which
+  // is safe - both versions are valid during the grace period.
+  void* old_handle = plugin->handle;
+  const uint32_t old_epoch = plugin->reload_epoch & 1U;
+
+  plugin->plugin_interface.process = new_process;
+  plugin->execute = new_execute;
+  plugin->handle = (void*)new_handle;
+#if defined(_WIN32) && !defined(__GNUC__)
+  MemoryBarrier();
+  plugin->reload_epoch++;
+#else
+  __atomic_store_n(&plugin->reload_epoch, plugin->reload_epoch + 1U, __ATOMIC_RELEASE);
+#endif
+  // Mirror of the fence in ethervox_plugin_execute: the drain loop's reads
+  // must not start before the epoch flip is visible
+  plugin_atomic_fence();
+
+  // Grace period: wait for dispatches that started under the old epoch
+  while (plugin_atomic_load(&plugin->inflight[old_epoch]) != 0) {
+#ifdef _WIN32
+    Sleep(1);
+#else
+    struct timespec pause = {0, 1000000L};  // 1 ms
+    nanosleep(&pause, NULL);
+#endif
+  }
+
+#ifdef _WIN32
+  FreeLibrary((HMODULE)old_handle);
+#else
+  dlclose(old_handle);
+#endif
+
+  plugin->load_time = time(NULL);
+  printf("Plugin reloaded: %s\n", plugin_name);
+  return 0;
+#else
+  (void)manager;
+  fprintf(stderr, "Plugin reload not supported on this platform\n");
   return -1;
+#endif
+}
+
+#if ETHERVOX_PLUGIN_ASYNC_AVAILABLE
+
+// Asynchronous plugin execution on the shared scheduler. Jobs live in a
+// fixed slot array; each enqueue submits one interactive-priority task to
+// the process-wide pool (no dedicated workers here - five subsystem pools
+// would oversubscribe a Pi's four cores). A watchdog thread enforces
+// deadlines: a job whose deadline fires (or that is cancelled) while a task
+// is still inside the plugin is marked orphaned - the caller is notified
+// immediately and the task discards the result when the plugin eventually
+// returns, so a hung plugin costs one shared worker, not the whole pipeline.
+#define PLUGIN_EXEC_QUEUE_SLOTS 16
+
+static const uint32_t kPluginWatchdogIntervalMs = 20U;
+
+typedef enum {
+  PLUGIN_JOB_FREE = 0,
+  PLUGIN_JOB_QUEUED,
+  PLUGIN_JOB_RUNNING,
+  PLUGIN_JOB_ORPHANED  // Timed out or cancelled while running; result discarded
+} plugin_job_state_t;
+
+typedef struct {
+  plugin_job_state_t state;
+  int64_t id;
+  ethervox_plugin_t* plugin;
+  const void* input;
+  void* output;
+  uint64_t deadline_ms;  // Monotonic; 0 = no deadline
+  ethervox_plugin_exec_callback_t callback;
+  void* user_data;
+} plugin_exec_job_t;
+
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t work_available;
+  ethervox_scheduler_t* scheduler;  // Shared process-wide pool (acquired)
+  pthread_t watchdog;
+  uint32_t inflight_tasks;  // Scheduler tasks submitted but not yet finished
+  bool running;
+  plugin_exec_job_t jobs[PLUGIN_EXEC_QUEUE_SLOTS];
+  int64_t next_job_id;
+} plugin_executor_t;
+
+static uint64_t plugin_monotonic_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)(ts.tv_nsec / 1000000L);
+}
+
+// One scheduler task runs one job. The task picks the oldest queued job
+// rather than a specific one so FIFO order holds even when the pool runs
+// tasks out of submission order.
+static void plugin_executor_run_one(void* arg) {
+  plugin_executor_t* exec = (plugin_executor_t*)arg;
+
+  pthread_mutex_lock(&exec->lock);
+  plugin_exec_job_t* job = NULL;
+  if (exec->running) {
+    for (int i = 0; i < PLUGIN_EXEC_QUEUE_SLOTS; i++) {
+      plugin_exec_job_t* candidate = &exec->jobs[i];
+      if (candidate->state == PLUGIN_JOB_QUEUED && (!job || candidate->id < job->id)) {
+        job = candidate;
+      }
+    }
+  }
+
+  if (job) {
+    job->state = PLUGIN_JOB_RUNNING;
+    ethervox_plugin_t* plugin = job->plugin;
+    const void* input = job->input;
+    void* output = job->output;
+    pthread_mutex_unlock(&exec->lock);
+
+    const int result = ethervox_plugin_execute(plugin, input, output);
+
+    pthread_mutex_lock(&exec->lock);
+    if (job->state == PLUGIN_JOB_RUNNING) {
+      ethervox_plugin_exec_callback_t callback = job->callback;
+      void* user_data = job->user_data;
+      job->state = PLUGIN_JOB_FREE;
+      job->id = 0;
+      if (callback) {
+        pthread_mutex_unlock(&exec->lock);
+        callback(plugin, result == 0 ? ETHERVOX_PLUGIN_EXEC_OK : ETHERVOX_PLUGIN_EXEC_FAILED,
+                 result, output, user_data);
+        pthread_mutex_lock(&exec->lock);
+      }
+    } else {
+      // Orphaned while running; the caller was already notified
+      job->state = PLUGIN_JOB_FREE;
+      job->id = 0;
+    }
+  }
+
+  // Stop waits for this count to hit zero before freeing the executor
+  exec->inflight_tasks--;
+  pthread_cond_broadcast(&exec->work_available);
+  pthread_mutex_unlock(&exec->lock);
+}
+
+static void* plugin_executor_watchdog(void* arg) {
+  plugin_executor_t* exec = (plugin_executor_t*)arg;
+
+  pthread_mutex_lock(&exec->lock);
+  while (exec->running) {
+    const uint64_t now = plugin_monotonic_ms();
+
+    for (int i = 0; i < PLUGIN_EXEC_QUEUE_SLOTS; i++) {
+      plugin_exec_job_t* job = &exec->jobs[i];
+      if ((job->state != PLUGIN_JOB_QUEUED && job->state != PLUGIN_JOB_RUNNING) ||
+          job->deadline_ms == 0 || now < job->deadline_ms) {
+        continue;
+      }
+
+      ethervox_plugin_exec_callback_t callback = job->callback;
+      void* user_data = job->user_data;
+      ethervox_plugin_t* plugin = job->plugin;
+      void* output = job->output;
+
+      if (job->state == PLUGIN_JOB_QUEUED) {
+        job->state = PLUGIN_JOB_FREE;
+        job->id = 0;
+      } else {
+        job->state = PLUGIN_JOB_ORPHANED;  // Worker frees the slot on return
+      }
+
+      if (callback) {
+        pthread_mutex_unlock(&exec->lock);
+        callback(plugin, ETHERVOX_PLUGIN_EXEC_TIMEOUT, -1, output, user_data);
+        pthread_mutex_lock(&exec->lock);
+      }
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += (long)kPluginWatchdogIntervalMs * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(&exec->work_available, &exec->lock, &deadline);
+  }
+  pthread_mutex_unlock(&exec->lock);
+  return NULL;
+}
+
+#endif  // ETHERVOX_PLUGIN_ASYNC_AVAILABLE
+
+int ethervox_plugin_executor_start(ethervox_plugin_manager_t* manager, uint32_t worker_count) {
+  if (!manager) {
+    return -1;
+  }
+#if ETHERVOX_PLUGIN_ASYNC_AVAILABLE
+  if (manager->executor) {
+    return 0;  // Executor already running
+  }
+  (void)worker_count;  // Sizing now belongs to the shared scheduler
+
+  plugin_executor_t* exec = (plugin_executor_t*)calloc(1, sizeof(plugin_executor_t));
+  if (!exec) {
+    return -1;
+  }
+
+  exec->scheduler = ethervox_scheduler_acquire();
+  if (!exec->scheduler) {
+    free(exec);
+    return -1;
+  }
+
+  pthread_mutex_init(&exec->lock, NULL);
+  pthread_cond_init(&exec->work_available, NULL);
+  exec->running = true;
+  exec->next_job_id = 1;
+
+  // The watchdog is a service loop, not a task: parking it in the pool
+  // would pin a shared worker forever
+  if (pthread_create(&exec->watchdog, NULL, plugin_executor_watchdog, exec) != 0) {
+    pthread_mutex_destroy(&exec->lock);
+    pthread_cond_destroy(&exec->work_available);
+    ethervox_scheduler_release(exec->scheduler);
+    free(exec);
+    return -1;
+  }
+
+  manager->executor = exec;
+  printf("Plugin executor started on shared scheduler (%u worker(s))\n",
+         ethervox_scheduler_worker_count(exec->scheduler));
+  return 0;
+#else
+  (void)worker_count;
+  return 0;  // Synchronous fallback needs no pool
+#endif
+}
+
+void ethervox_plugin_executor_stop(ethervox_plugin_manager_t* manager) {
+#if ETHERVOX_PLUGIN_ASYNC_AVAILABLE
+  if (!manager || !manager->executor) {
+    return;
+  }
+  plugin_executor_t* exec = (plugin_executor_t*)manager->executor;
+
+  pthread_mutex_lock(&exec->lock);
+  exec->running = false;
+  pthread_cond_broadcast(&exec->work_available);
+
+  // Submitted tasks still reference exec; wait for them to finish (a task
+  // inside a hung plugin blocks here, exactly as joining a worker used to)
+  while (exec->inflight_tasks > 0) {
+    pthread_cond_wait(&exec->work_available, &exec->lock);
+  }
+  pthread_mutex_unlock(&exec->lock);
+
+  pthread_join(exec->watchdog, NULL);
+
+  // Notify callers whose jobs never ran
+  for (int i = 0; i < PLUGIN_EXEC_QUEUE_SLOTS; i++) {
+    plugin_exec_job_t* job = &exec->jobs[i];
+    if (job->state == PLUGIN_JOB_QUEUED && job->callback) {
+      job->callback(job->plugin, ETHERVOX_PLUGIN_EXEC_CANCELLED, -1, job->output,
+                    job->user_data);
+    }
+  }
+
+  pthread_mutex_destroy(&exec->lock);
+  pthread_cond_destroy(&exec->work_available);
+  ethervox_scheduler_release(exec->scheduler);
+  free(exec);
+  manager->executor = NULL;
+#else
+  (void)manager;
+#endif
+}
+
+int64_t ethervox_plugin_execute_async(ethervox_plugin_manager_t* manager,
+                                      ethervox_plugin_t* plugin, const void* input, void* output,
+                                      uint32_t timeout_ms,
+                                      ethervox_plugin_exec_callback_t callback, void* user_data) {
+  if (!manager || !plugin) {
+    return -1;
+  }
+
+#if ETHERVOX_PLUGIN_ASYNC_AVAILABLE
+  if (!manager->executor && ethervox_plugin_executor_start(manager, 0) != 0) {
+    return -1;
+  }
+  plugin_executor_t* exec = (plugin_executor_t*)manager->executor;
+
+  pthread_mutex_lock(&exec->lock);
+
+  plugin_exec_job_t* job = NULL;
+  for (int i = 0; i < PLUGIN_EXEC_QUEUE_SLOTS; i++) {
+    if (exec->jobs[i].state == PLUGIN_JOB_FREE) {
+      job = &exec->jobs[i];
+      break;
+    }
+  }
+  if (!job) {
+    pthread_mutex_unlock(&exec->lock);
+    return -1;  // Queue full; caller may retry or run synchronously
+  }
+
+  job->state = PLUGIN_JOB_QUEUED;
+  job->id = exec->next_job_id++;
+  job->plugin = plugin;
+  job->input = input;
+  job->output = output;
+  job->deadline_ms = timeout_ms > 0 ? plugin_monotonic_ms() + timeout_ms : 0;
+  job->callback = callback;
+  job->user_data = user_data;
+  const int64_t id = job->id;
+
+  // Plugin calls answer a user's utterance: interactive class, ahead of
+  // downloads but never ahead of audio-adjacent work
+  exec->inflight_tasks++;
+  pthread_mutex_unlock(&exec->lock);
+
+  if (ethervox_scheduler_submit(exec->scheduler, ETHERVOX_SCHED_PRIORITY_INTERACTIVE,
+                                plugin_executor_run_one, exec) != 0) {
+    pthread_mutex_lock(&exec->lock);
+    exec->inflight_tasks--;
+    if (job->id == id && job->state == PLUGIN_JOB_QUEUED) {
+      job->state = PLUGIN_JOB_FREE;
+      job->id = 0;
+    }
+    pthread_mutex_unlock(&exec->lock);
+    return -1;
+  }
+
+  pthread_mutex_lock(&exec->lock);
+  pthread_cond_broadcast(&exec->work_available);  // Wake the watchdog's timer
+  pthread_mutex_unlock(&exec->lock);
+  return id;
+#else
+  // No threads on this platform: run inline; timeout cannot be enforced
+  (void)timeout_ms;
+  const int result = ethervox_plugin_execute(plugin, input, output);
+  if (callback) {
+    callback(plugin, result == 0 ? ETHERVOX_PLUGIN_EXEC_OK : ETHERVOX_PLUGIN_EXEC_FAILED, result,
+             output, user_data);
+  }
+  return 0;
+#endif
+}
+
+int ethervox_plugin_cancel(ethervox_plugin_manager_t* manager, int64_t job_id) {
+#if ETHERVOX_PLUGIN_ASYNC_AVAILABLE
+  if (!manager || !manager->executor || job_id <= 0) {
+    return -1;
+  }
+  plugin_executor_t* exec = (plugin_executor_t*)manager->executor;
+
+  pthread_mutex_lock(&exec->lock);
+  for (int i = 0; i < PLUGIN_EXEC_QUEUE_SLOTS; i++) {
+    plugin_exec_job_t* job = &exec->jobs[i];
+    if (job->id != job_id ||
+        (job->state != PLUGIN_JOB_QUEUED && job->state != PLUGIN_JOB_RUNNING)) {
+      continue;
+    }
+
+    ethervox_plugin_exec_callback_t callback = job->callback;
+    void* user_data = job->user_data;
+    ethervox_plugin_t* plugin = job->plugin;
+    void* output = job->output;
+
+    if (job->state == PLUGIN_JOB_QUEUED) {
+      job->state = PLUGIN_JOB_FREE;
+      job->id = 0;
+    } else {
+      job->state = PLUGIN_JOB_ORPHANED;
+    }
+    pthread_mutex_unlock(&exec->lock);
+
+    if (callback) {
+      callback(plugin, ETHERVOX_PLUGIN_EXEC_CANCELLED, -1, output, user_data);
+    }
+    return 0;
+  }
+  pthread_mutex_unlock(&exec->lock);
+  return -1;
+#else
+  (void)manager;
+  (void)job_id;
+  return -1;  // Synchronous fallback completes before the id is returned
+#endif
 }
 
 // OpenAI plugin implementation (keep only ONE definition)
@@ -306,12 +891,15 @@ int ethervox_plugin_register_builtin_openai(ethervox_plugin_manager_t* manager)
 
   snprintf(plugin->name, sizeof(plugin->name), "%s", "openai");
   snprintf(plugin->version, sizeof(plugin->version), "%s", "1.0.0");
+  snprintf(plugin->metadata.name, sizeof(plugin->metadata.name), "%s", "openai");
+  plugin->metadata.type = ETHERVOX_PLUGIN_LLM;
   plugin->type = ETHERVOX_PLUGIN_LLM;
   plugin->status = ETHERVOX_PLUGIN_STATUS_LOADED;
   plugin->execute = openai_execute_wrapper;  // Use wrapper instead of direct assignment
   plugin->user_data = NULL;
 
   manager->plugin_count++;
+  plugin_index_rebuild(manager);
   return 0;
 }
 
@@ -325,12 +913,15 @@ int ethervox_plugin_register_builtin_huggingface(ethervox_plugin_manager_t* mana
 
   snprintf(plugin->name, sizeof(plugin->name), "%s", "huggingface");
   snprintf(plugin->version, sizeof(plugin->version), "%s", "1.0.0");
+  snprintf(plugin->metadata.name, sizeof(plugin->metadata.name), "%s", "huggingface");
+  plugin->metadata.type = ETHERVOX_PLUGIN_LLM;
   plugin->type = ETHERVOX_PLUGIN_LLM;
   plugin->status = ETHERVOX_PLUGIN_STATUS_LOADED;
   plugin->execute = huggingface_execute_wrapper;  // Use wrapper
   plugin->user_data = NULL;
 
   manager->plugin_count++;
+  plugin_index_rebuild(manager);
   return 0;
 }
 
@@ -344,12 +935,15 @@ int ethervox_plugin_register_builtin_local_rag(ethervox_plugin_manager_t* manage
 
   snprintf(plugin->name, sizeof(plugin->name), "%s", "local_rag");
   snprintf(plugin->version, sizeof(plugin->version), "%s", "1.0.0");
+  snprintf(plugin->metadata.name, sizeof(plugin->metadata.name), "%s", "local_rag");
+  plugin->metadata.type = ETHERVOX_PLUGIN_LLM;
   plugin->type = ETHERVOX_PLUGIN_LLM;
   plugin->status = ETHERVOX_PLUGIN_STATUS_LOADED;
   plugin->execute = local_rag_execute_wrapper;  // Use wrapper
   plugin->user_data = NULL;
 
   manager->plugin_count++;
+  plugin_index_rebuild(manager);
   return 0;
 }
 
@@ -19,6 +19,65 @@ typedef struct {
   char* last_result;
 } vosk_context_t;
 
+// Round up to the next power of two so ring indices reduce to a mask
+static uint32_t stt_next_pow2(uint32_t value) {
+  uint32_t pow2 = 1;
+  while (pow2 < value) {
+    pow2 <<= 1;
+  }
+  return pow2;
+}
+
+uint32_t ethervox_stt_accumulator_available(const ethervox_stt_runtime_t* runtime) {
+  if (!runtime) {
+    return 0;
+  }
+  return runtime->accumulator_write_pos - runtime->accumulator_read_pos;
+}
+
+uint32_t ethervox_stt_accumulator_peek(ethervox_stt_runtime_t* runtime, const float** chunk) {
+  if (!runtime || !chunk) {
+    return 0;
+  }
+
+  const uint32_t mask = runtime->accumulator_size - 1;
+  const uint32_t available = runtime->accumulator_write_pos - runtime->accumulator_read_pos;
+  const uint32_t index = runtime->accumulator_read_pos & mask;
+
+  // Clamp to the end of the underlying array; the caller peeks again for the
+  // wrapped remainder instead of forcing a copy
+  const uint32_t contiguous = runtime->accumulator_size - index;
+  *chunk = runtime->audio_accumulator + index;
+  return available < contiguous ? available : contiguous;
+}
+
+void ethervox_stt_accumulator_consume(ethervox_stt_runtime_t* runtime, uint32_t sample_count) {
+  if (!runtime) {
+    return;
+  }
+
+  const uint32_t available = runtime->accumulator_write_pos - runtime->accumulator_read_pos;
+  runtime->accumulator_read_pos += (sample_count < available) ? sample_count : available;
+}
+
+// Append converted samples, overwriting the oldest unconsumed audio when the
+// ring is full so the capture thread never blocks or shifts memory
+static void stt_accumulator_write(ethervox_stt_runtime_t* runtime, const int16_t* samples,
+                                  uint32_t sample_count) {
+  const uint32_t mask = runtime->accumulator_size - 1;
+
+  for (uint32_t i = 0; i < sample_count; i++) {
+    runtime->audio_accumulator[runtime->accumulator_write_pos & mask] =
+        (float)samples[i] / 32768.0f;
+    runtime->accumulator_write_pos++;
+
+    if (runtime->accumulator_write_pos - runtime->accumulator_read_pos >
+        runtime->accumulator_size) {
+      runtime->accumulator_read_pos = runtime->accumulator_write_pos - runtime->accumulator_size;
+    }
+  }
+}
+
 // Default configuration
 ethervox_stt_config_t ethervox_stt_get_default_config(void) {
   ethervox_stt_config_t config = {.backend = ETHERVOX_STT_BACKEND_VOSK,
@@ -52,8 +111,9 @@ int ethervox_stt_init(ethervox_stt_runtime_t* runtime, const ethervox_stt_config
     runtime->config = ethervox_stt_get_default_config();
   }
 
-  // Allocate audio accumulator (5 seconds)
-  runtime->accumulator_size = runtime->config.sample_rate * 5;
+  // Allocate audio accumulator (at least 5 seconds, rounded to a power of
+  // two for mask-based ring indexing)
+  runtime->accumulator_size = stt_next_pow2(runtime->config.sample_rate * 5);
   runtime->audio_accumulator = (float*)calloc(runtime->accumulator_size, sizeof(float));
   if (!runtime->audio_accumulator) {
     return -1;
@@ -79,9 +139,11 @@ int ethervox_stt_init(ethervox_stt_runtime_t* runtime, const ethervox_stt_config
     }
 
     case ETHERVOX_STT_BACKEND_WHISPER:
-      printf("Whisper.cpp backend not yet implemented\n");
-      free(runtime->audio_accumulator);
-      return -1;
+      if (ethervox_stt_whisper_init(runtime) != 0) {
+        free(runtime->audio_accumulator);
+        return -1;
+      }
+      break;
 
     default:
       free(runtime->audio_accumulator);
@@ -100,6 +162,11 @@ int ethervox_stt_start(ethervox_stt_runtime_t* runtime) {
 
   runtime->is_processing = true;
   runtime->accumulator_write_pos = 0;
+  runtime->accumulator_read_pos = 0;
+
+  if (runtime->config.backend == ETHERVOX_STT_BACKEND_WHISPER) {
+    ethervox_stt_whisper_start(runtime);
+  }
 
   printf("STT: Processing started\n");
   return 0;
@@ -119,17 +186,22 @@ int ethervox_stt_process(ethervox_stt_runtime_t* runtime,
   const int16_t* samples = (const int16_t*)audio_buffer->data;
   uint32_t sample_count = audio_buffer->size / sizeof(int16_t);
 
-  for (uint32_t i = 0;
-       i < sample_count && runtime->accumulator_write_pos < runtime->accumulator_size; i++) {
-  runtime->audio_accumulator[runtime->accumulator_write_pos++] =
-    (float)samples[i] / 32768.0f;
+  if (runtime->config.backend == ETHERVOX_STT_BACKEND_WHISPER) {
+    // The whisper worker owns its own utterance buffer; hand the samples
+    // over and surface whatever partial transcript the last hop produced
+    if (ethervox_stt_whisper_feed(runtime, samples, sample_count) != 0) {
+      return -1;
+    }
+    return ethervox_stt_whisper_poll(runtime, result);
   }
 
+  stt_accumulator_write(runtime, samples, sample_count);
+
   // For demo: simple word detection based on audio patterns
   // In production, this would call Vosk/Whisper
 
-  // Placeholder logic: detect if we have enough audio
-  if (runtime->accumulator_write_pos > runtime->config.sample_rate * 2) {
+  // Placeholder logic: detect if we have enough unconsumed audio
+  if (ethervox_stt_accumulator_available(runtime) > runtime->config.sample_rate * 2) {
     // Simulate recognition result
     result->text = strdup("[Placeholder STT] Detected speech");
     result->confidence = 0.85f;
@@ -139,6 +211,9 @@ int ethervox_stt_process(ethervox_stt_runtime_t* runtime,
     result->end_time_us = audio_buffer->timestamp_us;
     result->language = runtime->config.language;
 
+    // The recognized window is consumed; capture keeps writing behind it
+    ethervox_stt_accumulator_consume(runtime, ethervox_stt_accumulator_available(runtime));
+
     return 0;  // Have result
   }
 
@@ -153,7 +228,15 @@ int ethervox_stt_finalize(ethervox_stt_runtime_t* runtime, ethervox_stt_result_t
 
   memset(result, 0, sizeof(ethervox_stt_result_t));
 
-  // TODO: Get final result from Vosk/Whisper
+  if (runtime->config.backend == ETHERVOX_STT_BACKEND_WHISPER) {
+    if (ethervox_stt_whisper_finalize(runtime, result) != 0) {
+      return -1;
+    }
+    printf("STT: Final result: %s (confidence: %.2f)\n", result->text, result->confidence);
+    return 0;
+  }
+
+  // TODO: Get final result from Vosk
   result->text = strdup("[Placeholder STT] Final transcription");
   result->confidence = 0.90f;
   result->is_partial = false;
@@ -173,6 +256,7 @@ void ethervox_stt_stop(ethervox_stt_runtime_t* runtime) {
 
   runtime->is_processing = false;
   runtime->accumulator_write_pos = 0;
+  runtime->accumulator_read_pos = 0;
 
   printf("STT: Processing stopped\n");
 }
@@ -183,10 +267,11 @@ void ethervox_stt_result_free(ethervox_stt_result_t* result) {
     return;
   }
 
-  if (result->text) {
+  if (result->text && !result->text_is_view) {
     free(result->text);
-    result->text = NULL;
   }
+  result->text = NULL;
+  result->text_is_view = false;
 }
 
 // Cleanup
@@ -208,13 +293,17 @@ void ethervox_stt_cleanup(ethervox_stt_runtime_t* runtime) {
   }
 
   if (runtime->backend_context) {
-    if (runtime->config.backend == ETHERVOX_STT_BACKEND_VOSK) {
-      vosk_context_t* ctx = (vosk_context_t*)runtime->backend_context;
-      if (ctx->last_result) {
-        free(ctx->last_result);
+    if (runtime->config.backend == ETHERVOX_STT_BACKEND_WHISPER) {
+      ethervox_stt_whisper_cleanup(runtime);  // Joins the worker, frees context
+    } else {
+      if (runtime->config.backend == ETHERVOX_STT_BACKEND_VOSK) {
+        vosk_context_t* ctx = (vosk_context_t*)runtime->backend_context;
+        if (ctx->last_result) {
+          free(ctx->last_result);
+        }
       }
+      free(runtime->backend_context);
     }
-    free(runtime->backend_context);
   }
 
   runtime->is_initialized = false;
@@ -0,0 +1,416 @@
+/**
+ * @file whisper_backend.c
+ * @brief Streaming whisper.cpp backend for EthervoxAI STT
+ *
+ * Decode runs on a dedicated worker thread: capture keeps feeding 1-second
+ * hops while the worker re-decodes the growing utterance and publishes
+ * partial transcripts, so the dialogue engine sees text before
+ * ethervox_stt_finalize().
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ethervox/audio.h"
+#include "ethervox/stt.h"
+
+// Include whisper.cpp headers if available
+#if __has_include(<whisper.h>)
+#include <whisper.h>
+#define WHISPER_HEADER_AVAILABLE 1
+#else
+/* MSVC doesn't support #warning, use #pragma message instead */
+#ifdef _MSC_VER
+#pragma message("whisper.h not found - whisper backend will use stub implementation")
+#else
+#warning "whisper.h not found - whisper backend will use stub implementation"
+#endif
+#define WHISPER_HEADER_AVAILABLE 0
+#endif
+
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#define WHISPER_HAVE_PTHREAD 1
+#else
+#define WHISPER_HAVE_PTHREAD 0
+#endif
+
+#define WHISPER_AUDIO_SECONDS 30
+#define WHISPER_HOP_SECONDS 1
+#define WHISPER_WINDOW_SECONDS 10
+#define WHISPER_DEFAULT_THREADS 4
+
+// Whisper backend context
+typedef struct {
+#if WHISPER_HEADER_AVAILABLE
+  struct whisper_context* ctx;
+#endif
+#if WHISPER_HAVE_PTHREAD
+  pthread_t worker;
+  pthread_mutex_t mutex;
+  pthread_cond_t audio_ready;
+  pthread_cond_t result_ready;
+  bool worker_running;
+#endif
+
+  // Utterance audio (float, 16 kHz), reset on ethervox_stt_start()
+  float* audio;
+  uint32_t audio_capacity;
+  uint32_t audio_count;      // Samples written by the capture side
+  uint32_t decoded_count;    // Samples covered by the last decode
+
+  // Latest transcript published by the worker
+  char* partial_text;
+  // Transcript last handed to the caller as a zero-copy view; stable until
+  // the next poll/finalize/start, which is exactly the view lifetime the
+  // public API promises
+  char* view_text;
+  bool partial_pending;
+  bool flush_requested;
+  bool final_ready;
+  bool stop_requested;
+
+  uint32_t sample_rate;
+  uint32_t hop_samples;
+  uint32_t generation;  // Bumped on session start so stale decodes are dropped
+} whisper_context_data_t;
+
+// Decode the current utterance (or its trailing window) into text. Returns a
+// malloc'd transcript the caller owns.
+static char* whisper_decode_window(whisper_context_data_t* data, uint32_t sample_count) {
+#if WHISPER_HEADER_AVAILABLE
+  const uint32_t window_limit = data->sample_rate * WHISPER_WINDOW_SECONDS;
+  const uint32_t offset = (sample_count > window_limit) ? sample_count - window_limit : 0;
+  const uint32_t count = sample_count - offset;
+
+  struct whisper_full_params params = whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
+  params.n_threads = WHISPER_DEFAULT_THREADS;
+  params.print_progress = false;
+  params.print_realtime = false;
+  params.no_context = true;
+  params.single_segment = false;
+
+  if (whisper_full(data->ctx, params, data->audio + offset, (int)count) != 0) {
+    return NULL;
+  }
+
+  size_t total_len = 1;
+  const int segments = whisper_full_n_segments(data->ctx);
+  for (int i = 0; i < segments; i++) {
+    total_len += strlen(whisper_full_get_segment_text(data->ctx, i));
+  }
+
+  char* text = (char*)malloc(total_len);
+  if (!text) {
+    return NULL;
+  }
+  text[0] = '\0';
+  for (int i = 0; i < segments; i++) {
+    strcat(text, whisper_full_get_segment_text(data->ctx, i));
+  }
+  return text;
+#else
+  // Stub: report how much speech the decode covered so the pipeline shape
+  // (partials streaming in while capture continues) is still exercised
+  char buffer[96];
+  snprintf(buffer, sizeof(buffer), "[Whisper STT] decoded %.1f s of speech",
+           (float)sample_count / (float)data->sample_rate);
+  return strdup(buffer);
+#endif
+}
+
+#if WHISPER_HAVE_PTHREAD
+static void* whisper_worker_main(void* arg) {
+  whisper_context_data_t* data = (whisper_context_data_t*)arg;
+
+  pthread_mutex_lock(&data->mutex);
+  while (!data->stop_requested) {
+    const bool hop_ready = data->audio_count >= data->decoded_count + data->hop_samples;
+    const bool flush = data->flush_requested && data->audio_count > data->decoded_count;
+
+    if (!hop_ready && !flush) {
+      if (data->flush_requested) {
+        // Nothing left to decode; the flush is already satisfied
+        data->final_ready = true;
+        pthread_cond_signal(&data->result_ready);
+        data->flush_requested = false;
+      }
+      pthread_cond_wait(&data->audio_ready, &data->mutex);
+      continue;
+    }
+
+    const uint32_t snapshot = data->audio_count;
+    const uint32_t generation = data->generation;
+    const bool finalizing = data->flush_requested;
+    pthread_mutex_unlock(&data->mutex);
+
+    // Decode outside the lock so capture keeps flowing during inference
+    char* text = whisper_decode_window(data, snapshot);
+
+    pthread_mutex_lock(&data->mutex);
+    if (generation != data->generation) {
+      free(text);  // A new session started mid-decode; drop the stale result
+      continue;
+    }
+    data->decoded_count = snapshot;
+    if (text) {
+      free(data->partial_text);
+      data->partial_text = text;
+      data->partial_pending = true;
+    }
+    if (finalizing) {
+      data->final_ready = true;
+      data->flush_requested = false;
+      pthread_cond_signal(&data->result_ready);
+    }
+  }
+  pthread_mutex_unlock(&data->mutex);
+  return NULL;
+}
+#endif  // WHISPER_HAVE_PTHREAD
+
+int ethervox_stt_whisper_init(ethervox_stt_runtime_t* runtime) {
+  if (!runtime) {
+    return -1;
+  }
+
+  whisper_context_data_t* data =
+      (whisper_context_data_t*)calloc(1, sizeof(whisper_context_data_t));
+  if (!data) {
+    return -1;
+  }
+
+  data->sample_rate = runtime->config.sample_rate;
+  data->hop_samples = data->sample_rate * WHISPER_HOP_SECONDS;
+  data->audio_capacity = data->sample_rate * WHISPER_AUDIO_SECONDS;
+  data->audio = (float*)malloc(data->audio_capacity * sizeof(float));
+  if (!data->audio) {
+    free(data);
+    return -1;
+  }
+
+#if WHISPER_HEADER_AVAILABLE
+  struct whisper_context_params cparams = whisper_context_default_params();
+  data->ctx = whisper_init_from_file_with_params(runtime->config.model_path, cparams);
+  if (!data->ctx) {
+    fprintf(stderr, "Whisper: failed to load model from %s\n", runtime->config.model_path);
+    free(data->audio);
+    free(data);
+    return -1;
+  }
+  printf("STT: Whisper backend initialized (model: %s)\n", runtime->config.model_path);
+#else
+  printf("STT: Whisper backend initialized (stub - requires whisper.cpp)\n");
+#endif
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_init(&data->mutex, NULL);
+  pthread_cond_init(&data->audio_ready, NULL);
+  pthread_cond_init(&data->result_ready, NULL);
+  if (pthread_create(&data->worker, NULL, whisper_worker_main, data) != 0) {
+    fprintf(stderr, "Whisper: failed to start decode worker\n");
+#if WHISPER_HEADER_AVAILABLE
+    whisper_free(data->ctx);
+#endif
+    free(data->audio);
+    free(data);
+    return -1;
+  }
+  data->worker_running = true;
+#else
+  printf("STT: Whisper running synchronously (no pthread support)\n");
+#endif
+
+  runtime->backend_context = data;
+  return 0;
+}
+
+// Reset utterance state for a new session (ethervox_stt_start())
+void ethervox_stt_whisper_start(ethervox_stt_runtime_t* runtime) {
+  if (!runtime || !runtime->backend_context) {
+    return;
+  }
+
+  whisper_context_data_t* data = (whisper_context_data_t*)runtime->backend_context;
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_lock(&data->mutex);
+#endif
+  data->audio_count = 0;
+  data->decoded_count = 0;
+  data->partial_pending = false;
+  data->flush_requested = false;
+  data->final_ready = false;
+  data->generation++;
+  free(data->partial_text);
+  data->partial_text = NULL;
+  free(data->view_text);
+  data->view_text = NULL;
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_unlock(&data->mutex);
+#endif
+}
+
+int ethervox_stt_whisper_feed(ethervox_stt_runtime_t* runtime, const int16_t* samples,
+                              uint32_t sample_count) {
+  if (!runtime || !runtime->backend_context || !samples) {
+    return -1;
+  }
+
+  whisper_context_data_t* data = (whisper_context_data_t*)runtime->backend_context;
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_lock(&data->mutex);
+#endif
+
+  uint32_t space = data->audio_capacity - data->audio_count;
+  if (sample_count > space) {
+    sample_count = space;  // Utterances longer than the window are truncated
+  }
+  ethervox_audio_convert_int16_to_float(samples, data->audio + data->audio_count, sample_count);
+  data->audio_count += sample_count;
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_cond_signal(&data->audio_ready);
+  pthread_mutex_unlock(&data->mutex);
+#else
+  // Synchronous fallback: decode once per hop on the caller's thread
+  if (data->audio_count >= data->decoded_count + data->hop_samples) {
+    char* text = whisper_decode_window(data, data->audio_count);
+    data->decoded_count = data->audio_count;
+    if (text) {
+      free(data->partial_text);
+      data->partial_text = text;
+      data->partial_pending = true;
+    }
+  }
+#endif
+
+  return 0;
+}
+
+int ethervox_stt_whisper_poll(ethervox_stt_runtime_t* runtime, ethervox_stt_result_t* result) {
+  if (!runtime || !runtime->backend_context || !result) {
+    return -1;
+  }
+
+  whisper_context_data_t* data = (whisper_context_data_t*)runtime->backend_context;
+  int rc = 1;
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_lock(&data->mutex);
+#endif
+
+  if (data->partial_pending && runtime->config.enable_partial_results) {
+    // Zero-copy publish: take over the worker's transcript buffer and hand
+    // the caller a view of it. No per-partial strdup/free; the previous view
+    // is retired here, honouring the valid-until-next-call contract.
+    free(data->view_text);
+    data->view_text = data->partial_text;
+    data->partial_text = NULL;
+    result->text = data->view_text;
+    result->text_is_view = true;
+    result->confidence = 0.0f;  // Whisper does not score partial hypotheses
+    result->is_partial = true;
+    result->is_final = false;
+    result->language = runtime->config.language;
+    data->partial_pending = false;
+    rc = result->text ? 0 : -1;
+  }
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_unlock(&data->mutex);
+#endif
+
+  return rc;
+}
+
+int ethervox_stt_whisper_finalize(ethervox_stt_runtime_t* runtime, ethervox_stt_result_t* result) {
+  if (!runtime || !runtime->backend_context || !result) {
+    return -1;
+  }
+
+  whisper_context_data_t* data = (whisper_context_data_t*)runtime->backend_context;
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_lock(&data->mutex);
+  data->final_ready = false;
+  data->flush_requested = true;
+  pthread_cond_signal(&data->audio_ready);
+  while (!data->final_ready && !data->stop_requested) {
+    pthread_cond_wait(&data->result_ready, &data->mutex);
+  }
+#else
+  if (data->audio_count > data->decoded_count) {
+    char* text = whisper_decode_window(data, data->audio_count);
+    data->decoded_count = data->audio_count;
+    if (text) {
+      free(data->partial_text);
+      data->partial_text = text;
+    }
+  }
+#endif
+
+  // The final result is an owned copy: the flush may have produced no new
+  // decode, in which case the freshest transcript is the one last viewed
+  const char* transcript =
+      data->partial_text ? data->partial_text : (data->view_text ? data->view_text : "");
+  result->text = strdup(transcript);
+  result->confidence = 0.90f;
+  result->is_partial = false;
+  result->is_final = true;
+  result->language = runtime->config.language;
+  data->partial_pending = false;
+
+#if WHISPER_HAVE_PTHREAD
+  pthread_mutex_unlock(&data->mutex);
+#endif
+
+  return result->text ? 0 : -1;
+}
+
+void ethervox_stt_whisper_cleanup(ethervox_stt_runtime_t* runtime) {
+  if (!runtime || !runtime->backend_context) {
+    return;
+  }
+
+  whisper_context_data_t* data = (whisper_context_data_t*)runtime->backend_context;
+
+#if WHISPER_HAVE_PTHREAD
+  if (data->worker_running) {
+    pthread_mutex_lock(&data->mutex);
+    data->stop_requested = true;
+    pthread_cond_signal(&data->audio_ready);
+    pthread_cond_signal(&data->result_ready);
+    pthread_mutex_unlock(&data->mutex);
+    pthread_join(data->worker, NULL);
+  }
+  pthread_mutex_destroy(&data->mutex);
+  pthread_cond_destroy(&data->audio_ready);
+  pthread_cond_destroy(&data->result_ready);
+#endif
+
+#if WHISPER_HEADER_AVAILABLE
+  if (data->ctx) {
+    whisper_free(data->ctx);
+  }
+#endif
+
+  free(data->partial_text);
+  free(data->view_text);
+  free(data->audio);
+  free(data);
+  runtime->backend_context = NULL;
+}
@@ -0,0 +1,611 @@
+/**
+ * @file keyword_detector.c
+ * @brief MFCC/DTW keyword spotting front-end for wake word detection
+ *
+ * Copyright (c) 2024-2025 EthervoxAI Team
+ *
+ * This file is part of EthervoxAI, licensed under CC BY-NC-SA 4.0.
+ * You are free to share and adapt this work under the following terms:
+ * - Attribution: Credit the original authors
+ * - NonCommercial: Not for commercial use
+ * - ShareAlike: Distribute under same license
+ *
+ * For full license terms, see: https://creativecommons.org/licenses/by-nc-sa/4.0/
+ * SPDX-License-Identifier: CC-BY-NC-SA-4.0
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ethervox/keyword_detector.h"
+
+#define KEYWORD_FFT_SIZE 512
+#define KEYWORD_MEL_FILTERS 20
+#define KEYWORD_MFCC_COEFFS 13
+#define KEYWORD_MAX_SEGMENT_FRAMES 64   // ~2 s of 32 ms frames
+#define KEYWORD_MAX_TEMPLATE_FRAMES 64
+#define KEYWORD_DTW_BAND 8              // Sakoe-Chiba band half-width
+#define KEYWORD_MAX_KEYWORDS 8
+
+static const float kKeywordMelLowHz = 100.0f;
+static const float kKeywordMelHighHz = 7000.0f;
+static const float kKeywordEnergyGate = 0.012f;       // Normalized RMS speech gate
+static const float kKeywordEnergyRelease = 0.006f;    // Segment end hysteresis
+static const uint32_t kKeywordMinSegmentFrames = 6U;  // ~190 ms
+static const float kKeywordSyllableMsMin = 110.0f;
+static const float kKeywordSyllableMsMax = 320.0f;
+static const float kKeywordMinSpectralMotion = 1.2f;  // Mean MFCC delta magnitude
+static const float kKeywordDtwScale = 12.0f;          // Distance -> confidence falloff
+static const float kKeywordTwoPi = 6.283185307f;
+static const float kKeywordInt16Scale = 32768.0f;
+
+// Per-keyword matcher: everything that is cheap enough to multiply with the
+// keyword count. The MFCC front-end and segment tracking stay shared.
+typedef struct {
+  const char* word;        // Borrowed from the creating config
+  float* template_frames;  // Optional enrolled template
+  uint32_t template_count;
+  uint32_t expected_syllables;
+} keyword_matcher_t;
+
+struct ethervox_keyword_detector {
+  ethervox_wake_config_t config;
+
+  // Precomputed front-end tables
+  float window[KEYWORD_FFT_SIZE];             // Hann window
+  float twiddle_re[KEYWORD_FFT_SIZE / 2];
+  float twiddle_im[KEYWORD_FFT_SIZE / 2];
+  uint16_t mel_bin_lo[KEYWORD_MEL_FILTERS];   // Triangle support per filter
+  uint16_t mel_bin_mid[KEYWORD_MEL_FILTERS];
+  uint16_t mel_bin_hi[KEYWORD_MEL_FILTERS];
+
+  // Frame assembly (config.frame_length samples per analysis frame)
+  int16_t frame_buffer[KEYWORD_FFT_SIZE];
+  uint32_t frame_fill;
+
+  // Current speech segment as MFCC trajectory
+  float segment[KEYWORD_MAX_SEGMENT_FRAMES][KEYWORD_MFCC_COEFFS];
+  uint32_t segment_frames;
+  bool in_segment;
+  uint32_t release_frames;  // Quiet frames since last voiced frame
+
+  // Per-keyword matchers evaluated against each completed segment
+  keyword_matcher_t matchers[KEYWORD_MAX_KEYWORDS];
+  uint32_t matcher_count;
+};
+
+// --- FFT -------------------------------------------------------------------
+
+#ifdef ETHERVOX_PLATFORM_ESP32
+// Q15 block-float FFT for the ESP32 path: int16 butterflies with a per-stage
+// right shift keep the transform inside the 512-sample frame budget without
+// touching the FPU in the inner loop.
+static void keyword_fft_q15(const ethervox_keyword_detector_t* detector, int16_t* re, int16_t* im,
+                            int* block_exp) {
+  const uint32_t n = KEYWORD_FFT_SIZE;
+  *block_exp = 0;
+
+  for (uint32_t i = 1, j = 0; i < n; i++) {
+    uint32_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      int16_t tmp = re[i];
+      re[i] = re[j];
+      re[j] = tmp;
+      tmp = im[i];
+      im[i] = im[j];
+      im[j] = tmp;
+    }
+  }
+
+  for (uint32_t len = 2; len <= n; len <<= 1) {
+    const uint32_t stride = n / len;
+    for (uint32_t i = 0; i < n; i += len) {
+      for (uint32_t k = 0; k < len / 2; k++) {
+        const uint32_t a = i + k;
+        const uint32_t b = i + k + len / 2;
+        const int32_t w_re = (int32_t)(detector->twiddle_re[k * stride] * 32767.0f);
+        const int32_t w_im = (int32_t)(detector->twiddle_im[k * stride] * 32767.0f);
+        const int32_t t_re = (re[b] * w_re - im[b] * w_im) >> 15;
+        const int32_t t_im = (re[b] * w_im + im[b] * w_re) >> 15;
+        // Scale every stage by 1/2 so the accumulators never leave Q15
+        re[b] = (int16_t)((re[a] - t_re) >> 1);
+        im[b] = (int16_t)((im[a] - t_im) >> 1);
+        re[a] = (int16_t)((re[a] + t_re) >> 1);
+        im[a] = (int16_t)((im[a] + t_im) >> 1);
+      }
+    }
+    (*block_exp)++;
+  }
+}
+#endif  // ETHERVOX_PLATFORM_ESP32
+
+// Float radix-2 FFT with the detector's precomputed twiddle table
+static void keyword_fft(const ethervox_keyword_detector_t* detector, float* re, float* im) {
+  const uint32_t n = KEYWORD_FFT_SIZE;
+
+  for (uint32_t i = 1, j = 0; i < n; i++) {
+    uint32_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      float tmp = re[i];
+      re[i] = re[j];
+      re[j] = tmp;
+      tmp = im[i];
+      im[i] = im[j];
+      im[j] = tmp;
+    }
+  }
+
+  for (uint32_t len = 2; len <= n; len <<= 1) {
+    const uint32_t stride = n / len;
+    for (uint32_t i = 0; i < n; i += len) {
+      for (uint32_t k = 0; k < len / 2; k++) {
+        const uint32_t a = i + k;
+        const uint32_t b = i + k + len / 2;
+        const float w_re = detector->twiddle_re[k * stride];
+        const float w_im = detector->twiddle_im[k * stride];
+        const float t_re = re[b] * w_re - im[b] * w_im;
+        const float t_im = re[b] * w_im + im[b] * w_re;
+        re[b] = re[a] - t_re;
+        im[b] = im[a] - t_im;
+        re[a] += t_re;
+        im[a] += t_im;
+      }
+    }
+  }
+}
+
+// --- Mel / MFCC ------------------------------------------------------------
+
+static float keyword_hz_to_mel(float hz) { return 2595.0f * log10f(1.0f + hz / 700.0f); }
+
+static float keyword_mel_to_hz(float mel) {
+  return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+static void keyword_build_tables(ethervox_keyword_detector_t* detector) {
+  for (uint32_t i = 0; i < KEYWORD_FFT_SIZE; i++) {
+    detector->window[i] =
+        0.5f - 0.5f * cosf(kKeywordTwoPi * (float)i / (float)(KEYWORD_FFT_SIZE - 1));
+  }
+
+  for (uint32_t i = 0; i < KEYWORD_FFT_SIZE / 2; i++) {
+    const float angle = -kKeywordTwoPi * (float)i / (float)KEYWORD_FFT_SIZE;
+    detector->twiddle_re[i] = cosf(angle);
+    detector->twiddle_im[i] = sinf(angle);
+  }
+
+  // Triangular mel filters on FFT bins
+  const float mel_lo = keyword_hz_to_mel(kKeywordMelLowHz);
+  const float mel_hi = keyword_hz_to_mel(kKeywordMelHighHz);
+  const float bin_hz = (float)detector->config.sample_rate / (float)KEYWORD_FFT_SIZE;
+
+  for (uint32_t m = 0; m < KEYWORD_MEL_FILTERS; m++) {
+    const float lo_hz =
+        keyword_mel_to_hz(mel_lo + (mel_hi - mel_lo) * (float)m / (KEYWORD_MEL_FILTERS + 1));
+    const float mid_hz =
+        keyword_mel_to_hz(mel_lo + (mel_hi - mel_lo) * (float)(m + 1) / (KEYWORD_MEL_FILTERS + 1));
+    const float hi_hz =
+        keyword_mel_to_hz(mel_lo + (mel_hi - mel_lo) * (float)(m + 2) / (KEYWORD_MEL_FILTERS + 1));
+
+    detector->mel_bin_lo[m] = (uint16_t)(lo_hz / bin_hz);
+    detector->mel_bin_mid[m] = (uint16_t)(mid_hz / bin_hz);
+    detector->mel_bin_hi[m] = (uint16_t)(hi_hz / bin_hz);
+    if (detector->mel_bin_hi[m] >= KEYWORD_FFT_SIZE / 2) {
+      detector->mel_bin_hi[m] = KEYWORD_FFT_SIZE / 2 - 1;
+    }
+  }
+}
+
+// Compute 13 MFCCs for one windowed frame; returns normalized frame RMS so
+// the caller can run segment gating from the same pass
+static float keyword_compute_mfcc(ethervox_keyword_detector_t* detector, const int16_t* samples,
+                                  float* mfcc_out) {
+  float power[KEYWORD_FFT_SIZE / 2];
+  uint64_t energy_acc = 0;
+
+#ifdef ETHERVOX_PLATFORM_ESP32
+  int16_t re[KEYWORD_FFT_SIZE];
+  int16_t im[KEYWORD_FFT_SIZE];
+  for (uint32_t i = 0; i < KEYWORD_FFT_SIZE; i++) {
+    // Window in Q15; input already int16
+    re[i] = (int16_t)(((int32_t)samples[i] * (int32_t)(detector->window[i] * 32767.0f)) >> 15);
+    im[i] = 0;
+    energy_acc += (uint64_t)((int32_t)samples[i] * (int32_t)samples[i]);
+  }
+  int block_exp = 0;
+  keyword_fft_q15(detector, re, im, &block_exp);
+  const float undo = (float)(1 << block_exp) / kKeywordInt16Scale;
+  for (uint32_t i = 0; i < KEYWORD_FFT_SIZE / 2; i++) {
+    const float fre = (float)re[i] * undo;
+    const float fim = (float)im[i] * undo;
+    power[i] = fre * fre + fim * fim;
+  }
+#else
+  float re[KEYWORD_FFT_SIZE];
+  float im[KEYWORD_FFT_SIZE];
+  for (uint32_t i = 0; i < KEYWORD_FFT_SIZE; i++) {
+    re[i] = ((float)samples[i] / kKeywordInt16Scale) * detector->window[i];
+    im[i] = 0.0f;
+    energy_acc += (uint64_t)((int32_t)samples[i] * (int32_t)samples[i]);
+  }
+  keyword_fft(detector, re, im);
+  for (uint32_t i = 0; i < KEYWORD_FFT_SIZE / 2; i++) {
+    power[i] = re[i] * re[i] + im[i] * im[i];
+  }
+#endif
+
+  // Log mel filterbank energies
+  float mel_energy[KEYWORD_MEL_FILTERS];
+  for (uint32_t m = 0; m < KEYWORD_MEL_FILTERS; m++) {
+    float acc = 0.0f;
+    const uint32_t lo = detector->mel_bin_lo[m];
+    const uint32_t mid = detector->mel_bin_mid[m];
+    const uint32_t hi = detector->mel_bin_hi[m];
+    for (uint32_t b = lo; b < mid; b++) {
+      acc += power[b] * (float)(b - lo) / (float)(mid - lo > 0 ? mid - lo : 1);
+    }
+    for (uint32_t b = mid; b <= hi; b++) {
+      acc += power[b] * (float)(hi - b) / (float)(hi - mid > 0 ? hi - mid : 1);
+    }
+    mel_energy[m] = logf(acc + 1e-10f);
+  }
+
+  // DCT-II down to the cepstral coefficients
+  for (uint32_t c = 0; c < KEYWORD_MFCC_COEFFS; c++) {
+    float acc = 0.0f;
+    for (uint32_t m = 0; m < KEYWORD_MEL_FILTERS; m++) {
+      acc += mel_energy[m] *
+             cosf((float)M_PI * (float)c * ((float)m + 0.5f) / (float)KEYWORD_MEL_FILTERS);
+    }
+    mfcc_out[c] = acc;
+  }
+
+  const float mean_square = (float)energy_acc / ((float)KEYWORD_FFT_SIZE * kKeywordInt16Scale *
+                                                 kKeywordInt16Scale);
+  return sqrtf(mean_square);
+}
+
+// --- Matching --------------------------------------------------------------
+
+static float keyword_frame_distance(const float* a, const float* b) {
+  float acc = 0.0f;
+  // Skip c0 (raw energy) so loudness differences do not dominate the match
+  for (uint32_t c = 1; c < KEYWORD_MFCC_COEFFS; c++) {
+    const float d = a[c] - b[c];
+    acc += d * d;
+  }
+  return sqrtf(acc);
+}
+
+// Band-constrained DTW between the captured segment and one keyword's
+// enrolled template; returns the per-step normalized path distance
+static float keyword_dtw_distance(const ethervox_keyword_detector_t* detector,
+                                  const keyword_matcher_t* matcher) {
+  const uint32_t rows = detector->segment_frames;
+  const uint32_t cols = matcher->template_count;
+  float dtw_prev[KEYWORD_MAX_TEMPLATE_FRAMES + 1];
+  float dtw_cur[KEYWORD_MAX_TEMPLATE_FRAMES + 1];
+
+  for (uint32_t j = 0; j <= cols; j++) {
+    dtw_prev[j] = HUGE_VALF;
+  }
+  dtw_prev[0] = 0.0f;
+
+  for (uint32_t i = 1; i <= rows; i++) {
+    for (uint32_t j = 0; j <= cols; j++) {
+      dtw_cur[j] = HUGE_VALF;
+    }
+
+    // Sakoe-Chiba band around the diagonal keeps the match near-linear time
+    const int32_t diag = (int32_t)(i * cols / rows);
+    int32_t j_lo = diag - KEYWORD_DTW_BAND;
+    int32_t j_hi = diag + KEYWORD_DTW_BAND;
+    if (j_lo < 1) {
+      j_lo = 1;
+    }
+    if (j_hi > (int32_t)cols) {
+      j_hi = (int32_t)cols;
+    }
+
+    for (int32_t j = j_lo; j <= j_hi; j++) {
+      const float cost = keyword_frame_distance(
+          detector->segment[i - 1], matcher->template_frames + (size_t)(j - 1) *
+                                                                   KEYWORD_MFCC_COEFFS);
+      float best = dtw_prev[j];  // Insertion
+      if (dtw_cur[j - 1] < best) {
+        best = dtw_cur[j - 1];  // Deletion
+      }
+      if (dtw_prev[j - 1] < best) {
+        best = dtw_prev[j - 1];  // Match
+      }
+      dtw_cur[j] = cost + best;
+    }
+
+    memcpy(dtw_prev, dtw_cur, sizeof(dtw_prev));
+  }
+
+  return dtw_prev[cols] / (float)(rows + cols);
+}
+
+// Rough syllable estimate from the wake word text (vowel groups)
+static uint32_t keyword_estimate_syllables(const char* word) {
+  uint32_t count = 0;
+  bool in_vowel = false;
+
+  for (const char* p = word; p && *p; p++) {
+    const char c = (char)((*p >= 'A' && *p <= 'Z') ? *p + 32 : *p);
+    const bool vowel = (c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u' || c == 'y');
+    if (vowel && !in_vowel) {
+      count++;
+    }
+    in_vowel = vowel;
+  }
+
+  return count > 0 ? count : 1;
+}
+
+// Template-free fallback: accept segments whose duration matches the
+// keyword's syllable count and whose spectra actually move like speech
+static float keyword_segment_score(const ethervox_keyword_detector_t* detector,
+                                   const keyword_matcher_t* matcher) {
+  const float frame_ms =
+      1000.0f * (float)detector->config.frame_length / (float)detector->config.sample_rate;
+  const float duration_ms = (float)detector->segment_frames * frame_ms;
+  const float min_ms = (float)matcher->expected_syllables * kKeywordSyllableMsMin;
+  const float max_ms = (float)matcher->expected_syllables * kKeywordSyllableMsMax;
+
+  if (duration_ms < min_ms || duration_ms > max_ms) {
+    return 0.0f;
+  }
+
+  // Mean MFCC frame-to-frame motion; stationary noise scores near zero
+  float motion = 0.0f;
+  for (uint32_t i = 1; i < detector->segment_frames; i++) {
+    motion += keyword_frame_distance(detector->segment[i - 1], detector->segment[i]);
+  }
+  motion /= (float)(detector->segment_frames - 1);
+
+  if (motion < kKeywordMinSpectralMotion) {
+    return 0.0f;
+  }
+
+  // Center of the duration window scores highest
+  const float center = (min_ms + max_ms) / 2.0f;
+  const float spread = (max_ms - min_ms) / 2.0f;
+  return 1.0f - fabsf(duration_ms - center) / spread;
+}
+
+static int keyword_load_template(keyword_matcher_t* matcher, const char* path) {
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return -1;
+  }
+
+  fseek(file, 0, SEEK_END);
+  const long bytes = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  const uint32_t frame_bytes = KEYWORD_MFCC_COEFFS * sizeof(float);
+  if (bytes <= 0 || (bytes % frame_bytes) != 0 ||
+      (uint32_t)(bytes / frame_bytes) > KEYWORD_MAX_TEMPLATE_FRAMES) {
+    fclose(file);
+    return -1;
+  }
+
+  matcher->template_frames = (float*)malloc((size_t)bytes);
+  if (!matcher->template_frames) {
+    fclose(file);
+    return -1;
+  }
+
+  if (fread(matcher->template_frames, 1, (size_t)bytes, file) != (size_t)bytes) {
+    free(matcher->template_frames);
+    matcher->template_frames = NULL;
+    fclose(file);
+    return -1;
+  }
+
+  matcher->template_count = (uint32_t)(bytes / frame_bytes);
+  fclose(file);
+  return 0;
+}
+
+// Set up one matcher for a keyword, loading its template when given
+static void keyword_matcher_init(keyword_matcher_t* matcher, const char* word,
+                                 const char* template_path) {
+  matcher->word = word;
+  matcher->expected_syllables = keyword_estimate_syllables(word);
+
+  if (template_path && keyword_load_template(matcher, template_path) == 0) {
+    printf("Keyword detector: loaded %u-frame template for '%s' from %s\n",
+           matcher->template_count, word, template_path);
+  } else if (template_path) {
+    printf("Keyword detector: could not load template '%s' for '%s', using syllable gate\n",
+           template_path, word);
+  }
+}
+
+// --- Public API ------------------------------------------------------------
+
+ethervox_keyword_detector_t* ethervox_keyword_detector_create(
+    const ethervox_wake_config_t* config) {
+  if (!config || config->frame_length == 0 || config->frame_length > KEYWORD_FFT_SIZE) {
+    return NULL;
+  }
+
+  const bool multi = config->wake_words && config->wake_word_count > 0;
+  if (!multi && !config->wake_word) {
+    return NULL;
+  }
+  if (multi && config->wake_word_count > KEYWORD_MAX_KEYWORDS) {
+    fprintf(stderr, "Keyword detector: at most %d keywords supported (got %u)\n",
+            KEYWORD_MAX_KEYWORDS, config->wake_word_count);
+    return NULL;
+  }
+
+  ethervox_keyword_detector_t* detector =
+      (ethervox_keyword_detector_t*)calloc(1, sizeof(ethervox_keyword_detector_t));
+  if (!detector) {
+    return NULL;
+  }
+
+  detector->config = *config;
+  keyword_build_tables(detector);
+
+  if (multi) {
+    for (uint32_t i = 0; i < config->wake_word_count; i++) {
+      if (!config->wake_words[i]) {
+        ethervox_keyword_detector_destroy(detector);
+        return NULL;
+      }
+      keyword_matcher_init(&detector->matchers[i], config->wake_words[i],
+                           config->model_paths ? config->model_paths[i] : NULL);
+    }
+    detector->matcher_count = config->wake_word_count;
+  } else {
+    keyword_matcher_init(&detector->matchers[0], config->wake_word, config->model_path);
+    detector->matcher_count = 1;
+  }
+
+  return detector;
+}
+
+int ethervox_keyword_detector_process(ethervox_keyword_detector_t* detector,
+                                      const int16_t* samples, uint32_t sample_count,
+                                      float* confidence, uint32_t* keyword_index) {
+  if (!detector || !samples || !confidence) {
+    return -1;
+  }
+
+  *confidence = 0.0f;
+  if (keyword_index) {
+    *keyword_index = 0;
+  }
+  const uint32_t frame_length = detector->config.frame_length;
+  int detected = 0;
+
+  for (uint32_t consumed = 0; consumed < sample_count;) {
+    const uint32_t want = frame_length - detector->frame_fill;
+    const uint32_t take = (sample_count - consumed < want) ? sample_count - consumed : want;
+    memcpy(detector->frame_buffer + detector->frame_fill, samples + consumed,
+           take * sizeof(int16_t));
+    detector->frame_fill += take;
+    consumed += take;
+
+    if (detector->frame_fill < frame_length) {
+      break;
+    }
+    detector->frame_fill = 0;
+
+    // Zero-pad up to the FFT size when frame_length < 512
+    if (frame_length < KEYWORD_FFT_SIZE) {
+      memset(detector->frame_buffer + frame_length, 0,
+             (KEYWORD_FFT_SIZE - frame_length) * sizeof(int16_t));
+    }
+
+    float mfcc[KEYWORD_MFCC_COEFFS];
+    const float rms = keyword_compute_mfcc(detector, detector->frame_buffer, mfcc);
+
+    const bool voiced = detector->in_segment ? (rms >= kKeywordEnergyRelease)
+                                             : (rms >= kKeywordEnergyGate);
+
+    if (voiced) {
+      if (!detector->in_segment) {
+        detector->in_segment = true;
+        detector->segment_frames = 0;
+      }
+      detector->release_frames = 0;
+      if (detector->segment_frames < KEYWORD_MAX_SEGMENT_FRAMES) {
+        memcpy(detector->segment[detector->segment_frames], mfcc, sizeof(mfcc));
+        detector->segment_frames++;
+      }
+      continue;
+    }
+
+    if (!detector->in_segment) {
+      continue;
+    }
+
+    // Allow one quiet frame inside an utterance before closing the segment
+    if (++detector->release_frames < 2) {
+      continue;
+    }
+
+    detector->in_segment = false;
+    if (detector->segment_frames < kKeywordMinSegmentFrames) {
+      detector->segment_frames = 0;
+      continue;
+    }
+
+    // One feature pass bought this segment; now run every keyword's cheap
+    // matcher against it and keep the best scorer
+    float best_score = 0.0f;
+    uint32_t best_index = 0;
+    for (uint32_t m = 0; m < detector->matcher_count; m++) {
+      const keyword_matcher_t* matcher = &detector->matchers[m];
+      float score;
+      if (matcher->template_frames) {
+        const float distance = keyword_dtw_distance(detector, matcher);
+        score = expf(-distance / kKeywordDtwScale);
+      } else {
+        score = keyword_segment_score(detector, matcher);
+      }
+      if (score > best_score) {
+        best_score = score;
+        best_index = m;
+      }
+    }
+    detector->segment_frames = 0;
+
+    const float threshold = 1.0f - detector->config.sensitivity * 0.7f;
+    if (best_score >= threshold) {
+      *confidence = best_score;
+      if (keyword_index) {
+        *keyword_index = best_index;
+      }
+      detected = 1;
+    }
+  }
+
+  return detected;
+}
+
+const char* ethervox_keyword_detector_keyword_at(const ethervox_keyword_detector_t* detector,
+                                                 uint32_t index) {
+  if (!detector || index >= detector->matcher_count) {
+    return NULL;
+  }
+  return detector->matchers[index].word;
+}
+
+void ethervox_keyword_detector_reset(ethervox_keyword_detector_t* detector) {
+  if (!detector) {
+    return;
+  }
+
+  detector->frame_fill = 0;
+  detector->segment_frames = 0;
+  detector->in_segment = false;
+  detector->release_frames = 0;
+}
+
+void ethervox_keyword_detector_destroy(ethervox_keyword_detector_t* detector) {
+  if (!detector) {
+    return;
+  }
+
+  for (uint32_t m = 0; m < KEYWORD_MAX_KEYWORDS; m++) {
+    free(detector->matchers[m].template_frames);
+  }
+  free(detector);
+}
@@ -11,10 +11,56 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "ethervox/keyword_detector.h"
 #include "ethervox/wake_word.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #define DEFAULT_WAKE_WORD "hey ethervox"
 
+// Sum of |sample| over a block; widened integer accumulation with one float
+// normalization at the caller instead of a double divide per sample
+static uint64_t wake_abs_sum(const int16_t* samples, uint32_t count) {
+  uint64_t acc = 0;
+  uint32_t i = 0;
+
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ones = _mm_set1_epi16(1);
+  __m128i acc_v = _mm_setzero_si128();
+  for (; i + 8 <= count; i += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(samples + i));
+    // Saturating negate so INT16_MIN cannot wrap back to itself
+    __m128i abs_v = _mm_max_epi16(v, _mm_subs_epi16(zero, v));
+    __m128i pair_sums = _mm_madd_epi16(abs_v, ones);  // 4 x int32
+    acc_v = _mm_add_epi64(acc_v, _mm_unpacklo_epi32(pair_sums, zero));
+    acc_v = _mm_add_epi64(acc_v, _mm_unpackhi_epi32(pair_sums, zero));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128((__m128i*)lanes, acc_v);
+  acc = lanes[0] + lanes[1];
+#elif defined(__ARM_NEON)
+  int64x2_t acc_v = vdupq_n_s64(0);
+  for (; i + 8 <= count; i += 8) {
+    int16x8_t v = vld1q_s16(samples + i);
+    int16x8_t abs_v = vabsq_s16(v);
+    acc_v = vpadalq_s32(acc_v, vpaddlq_s16(abs_v));
+  }
+  acc = (uint64_t)(vgetq_lane_s64(acc_v, 0) + vgetq_lane_s64(acc_v, 1));
+#endif
+
+  for (; i < count; i++) {
+    const int32_t s = samples[i];
+    acc += (uint64_t)(s < 0 ? -s : s);
+  }
+
+  return acc;
+}
+
 ethervox_wake_config_t ethervox_wake_get_default_config(void) {
   ethervox_wake_config_t config = {.method = ETHERVOX_WAKE_METHOD_KEYWORD_SPOTTING,
                                    .wake_word = DEFAULT_WAKE_WORD,
@@ -35,8 +81,12 @@ int ethervox_wake_init(ethervox_wake_runtime_t* runtime, const ethervox_wake_con
   memset(runtime, 0, sizeof(*runtime));
 
   runtime->config = config ? *config : ethervox_wake_get_default_config();
+  if (runtime->config.wake_words && runtime->config.wake_word_count == 0) {
+    runtime->config.wake_words = NULL;  // Empty list means single-keyword mode
+  }
   if (!runtime->config.wake_word) {
-    runtime->config.wake_word = DEFAULT_WAKE_WORD;
+    runtime->config.wake_word =
+        runtime->config.wake_words ? runtime->config.wake_words[0] : DEFAULT_WAKE_WORD;
   }
 
   runtime->buffer_size = runtime->config.sample_rate / 2;  // 500ms of audio at 16kHz
@@ -45,6 +95,15 @@ int ethervox_wake_init(ethervox_wake_runtime_t* runtime, const ethervox_wake_con
     return -1;
   }
 
+  // Keyword spotting runs through the MFCC/DTW detector; other methods keep
+  // the legacy energy threshold until their backends land
+  if (runtime->config.method == ETHERVOX_WAKE_METHOD_KEYWORD_SPOTTING) {
+    runtime->detector_context = ethervox_keyword_detector_create(&runtime->config);
+    if (!runtime->detector_context) {
+      fprintf(stderr, "Failed to create keyword detector, using energy threshold\n");
+    }
+  }
+
   runtime->is_initialized = true;
   runtime->write_index = 0;
   runtime->wake_detected = false;
@@ -69,12 +128,44 @@ int ethervox_wake_process(ethervox_wake_runtime_t* runtime,
     return 1;
   }
 
-  double energy_sum = 0.0;
-  for (uint32_t i = 0; i < sample_count; ++i) {
-    energy_sum += fabs((double)samples[i]) / 32768.0;
+  if (runtime->detector_context) {
+    float confidence = 0.0f;
+    uint32_t keyword_index = 0;
+    const int rc = ethervox_keyword_detector_process(
+        (ethervox_keyword_detector_t*)runtime->detector_context, samples, sample_count,
+        &confidence, &keyword_index);
+    if (rc < 0) {
+      return -1;
+    }
+
+    if (rc == 1 && !runtime->wake_detected) {
+      runtime->wake_detected = true;
+      runtime->last_detection_time = audio_buffer->timestamp_us;
+
+      result->detected = true;
+      result->confidence = confidence;
+      result->timestamp_us = audio_buffer->timestamp_us;
+      result->start_index = 0;
+      result->end_index = sample_count;
+
+      const char* fired = ethervox_keyword_detector_keyword_at(
+          (const ethervox_keyword_detector_t*)runtime->detector_context, keyword_index);
+      if (fired) {
+        result->wake_word = fired;
+      }
+
+      printf("Wake word '%s' detected (keyword spotting) with confidence %.2f\n",
+             result->wake_word, confidence);
+      return 0;
+    }
+
+    return 1;
   }
 
-  const double average_energy = energy_sum / sample_count;
+  // Whole buffers (one or more capture periods) go through the vectorized
+  // absolute-sum; normalization happens once per call
+  const uint64_t abs_sum = wake_abs_sum(samples, sample_count);
+  const double average_energy = (double)abs_sum / ((double)sample_count * 32768.0);
   const double threshold = 0.15 + (0.5 * (1.0 - runtime->config.sensitivity));
 
   if (average_energy >= threshold && !runtime->wake_detected) {
@@ -105,6 +196,10 @@ void ethervox_wake_reset(ethervox_wake_runtime_t* runtime) {
 
   runtime->wake_detected = false;
   runtime->last_detection_time = 0;
+
+  if (runtime->detector_context) {
+    ethervox_keyword_detector_reset((ethervox_keyword_detector_t*)runtime->detector_context);
+  }
 }
 
 void ethervox_wake_cleanup(ethervox_wake_runtime_t* runtime) {
@@ -112,6 +207,11 @@ void ethervox_wake_cleanup(ethervox_wake_runtime_t* runtime) {
     return;
   }
 
+  if (runtime->detector_context) {
+    ethervox_keyword_detector_destroy((ethervox_keyword_detector_t*)runtime->detector_context);
+    runtime->detector_context = NULL;
+  }
+
   if (runtime->audio_buffer) {
     free(runtime->audio_buffer);
     runtime->audio_buffer = NULL;
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: CC-BY-NC-SA-4.0
+//
+// Microbenchmarks for the per-turn hot paths. Each benchmark warms up, then
+// runs timed batches until it has a stable sample, reporting ns/op and
+// (net) heap bytes/op. Run with --csv <file> to append machine-readable
+// results for CI tracking:
+//
+//     benchmark,iterations,ns_per_op,bytes_per_op
+
+#include "ethervox/audio.h"
+#include "ethervox/audio_buffer.h"
+#include "ethervox/dialogue.h"
+#include "ethervox/plugins.h"
+#include "ethervox/stt.h"
+#include "ethervox/wake_word.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Net allocation tracking via glibc's mallinfo2; other libcs report 0
+#if defined(__has_include)
+#if __has_include(<malloc.h>) && defined(__GLIBC__)
+#include <malloc.h>
+#define BENCH_HAVE_MALLINFO 1
+#endif
+#endif
+#ifndef BENCH_HAVE_MALLINFO
+#define BENCH_HAVE_MALLINFO 0
+#endif
+
+static const uint32_t kBenchWarmupOps = 1000;
+static const uint64_t kBenchTargetNs = 200000000ULL;  // 200 ms of timed work
+static const uint32_t kBenchBatchOps = 1000;
+
+static uint64_t bench_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int64_t bench_heap_bytes(void) {
+#if BENCH_HAVE_MALLINFO
+  struct mallinfo2 info = mallinfo2();
+  return (int64_t)info.uordblks;
+#else
+  return 0;
+#endif
+}
+
+typedef void (*bench_op_fn)(void* state);
+
+static void bench_run(const char* name, bench_op_fn op, void* state, FILE* csv) {
+  for (uint32_t i = 0; i < kBenchWarmupOps; i++) {
+    op(state);
+  }
+
+  const int64_t heap_before = bench_heap_bytes();
+  uint64_t total_ops = 0;
+  uint64_t elapsed_ns = 0;
+  while (elapsed_ns < kBenchTargetNs) {
+    const uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < kBenchBatchOps; i++) {
+      op(state);
+    }
+    elapsed_ns += bench_now_ns() - start;
+    total_ops += kBenchBatchOps;
+  }
+  const int64_t heap_after = bench_heap_bytes();
+
+  const double ns_per_op = (double)elapsed_ns / (double)total_ops;
+  const double bytes_per_op = (double)(heap_after - heap_before) / (double)total_ops;
+
+  printf("%-24s %12llu ops %12.1f ns/op %10.1f B/op\n", name,
+         (unsigned long long)total_ops, ns_per_op, bytes_per_op);
+  if (csv) {
+    fprintf(csv, "%s,%llu,%.1f,%.1f\n", name, (unsigned long long)total_ops, ns_per_op,
+            bytes_per_op);
+  }
+}
+
+// Shared 512-sample frame of synthetic speech-band audio
+#define BENCH_FRAME_SAMPLES 512
+
+static float g_frame[BENCH_FRAME_SAMPLES];
+static ethervox_audio_buffer_t g_frame_buffer;
+
+static void bench_fill_frame(void) {
+  for (uint32_t i = 0; i < BENCH_FRAME_SAMPLES; i++) {
+    g_frame[i] = 0.1f * sinf((float)i * 0.12f) + 0.05f * sinf((float)i * 0.31f);
+  }
+  g_frame_buffer.data = g_frame;
+  g_frame_buffer.size = BENCH_FRAME_SAMPLES;
+  g_frame_buffer.channels = 1;
+  g_frame_buffer.timestamp_us = 0;
+}
+
+// --- wake_process ---
+
+static void op_wake_process(void* state) {
+  ethervox_wake_runtime_t* runtime = (ethervox_wake_runtime_t*)state;
+  ethervox_wake_result_t result;
+  ethervox_wake_process(runtime, &g_frame_buffer, &result);
+}
+
+// --- stt_accumulate ---
+
+static void op_stt_accumulate(void* state) {
+  ethervox_stt_runtime_t* runtime = (ethervox_stt_runtime_t*)state;
+  ethervox_stt_result_t result = {0};
+  if (ethervox_stt_process(runtime, &g_frame_buffer, &result) == 0) {
+    ethervox_stt_result_free(&result);
+  }
+  // Steady state: drain what we just wrote so the ring never fills
+  ethervox_stt_accumulator_consume(runtime, ethervox_stt_accumulator_available(runtime));
+}
+
+// --- parse_intent ---
+
+static const char* kIntentCorpus[] = {
+    "hello there how are you doing today",
+    "what is the weather forecast for tomorrow afternoon in the city",
+    "please turn on the living room lights and set them to half brightness",
+    "yes that is exactly right thank you",
+    "goodbye see you later tonight",
+    "can you help me figure out how this thing works",
+    "the quick brown fox jumps over the lazy dog with no intent at all",
+};
+
+typedef struct {
+  ethervox_dialogue_engine_t* engine;
+  uint32_t next;
+} bench_intent_state_t;
+
+static void op_parse_intent(void* state) {
+  bench_intent_state_t* s = (bench_intent_state_t*)state;
+  ethervox_dialogue_intent_request_t request = {
+      .text = kIntentCorpus[s->next % (sizeof(kIntentCorpus) / sizeof(kIntentCorpus[0]))],
+      .language_code = "en",
+  };
+  s->next++;
+
+  ethervox_intent_t intent = {0};
+  ethervox_dialogue_parse_intent(s->engine, &request, &intent);
+  ethervox_dialogue_reset_turn_arena(s->engine);
+}
+
+// --- context_lookup ---
+
+#define BENCH_CONTEXT_COUNT 64
+
+typedef struct {
+  ethervox_dialogue_engine_t* engine;
+  char* ids[BENCH_CONTEXT_COUNT];
+  uint32_t next;
+} bench_context_state_t;
+
+static void op_context_lookup(void* state) {
+  bench_context_state_t* s = (bench_context_state_t*)state;
+  ethervox_dialogue_context_t* context = NULL;
+  ethervox_dialogue_get_context(s->engine, s->ids[s->next % BENCH_CONTEXT_COUNT], &context);
+  s->next++;
+}
+
+// --- plugin_dispatch ---
+
+static void op_plugin_dispatch(void* state) {
+  ethervox_plugin_manager_t* manager = (ethervox_plugin_manager_t*)state;
+  ethervox_plugin_first_of_type(manager, ETHERVOX_PLUGIN_LLM);
+  ethervox_plugin_find(manager, "openai");
+}
+
+// --- pool_acquire_release ---
+
+static void op_pool_acquire_release(void* state) {
+  ethervox_audio_buffer_pool_t* pool = (ethervox_audio_buffer_pool_t*)state;
+  ethervox_audio_buffer_t buffer = {0};
+  if (ethervox_audio_buffer_pool_acquire(pool, BENCH_FRAME_SAMPLES * sizeof(float), &buffer) ==
+      0) {
+    ethervox_audio_buffer_pool_release(pool, &buffer);
+  }
+}
+
+int main(int argc, char** argv) {
+  FILE* csv = NULL;
+  for (int i = 1; i < argc - 1; i++) {
+    if (strcmp(argv[i], "--csv") == 0) {
+      csv = fopen(argv[i + 1], "a");
+      if (!csv) {
+        fprintf(stderr, "Cannot open %s for append\n", argv[i + 1]);
+        return 1;
+      }
+    }
+  }
+
+  bench_fill_frame();
+  printf("EthervoxAI microbenchmarks (%u-op batches, %.0f ms per benchmark)\n\n", kBenchBatchOps,
+         (double)kBenchTargetNs / 1e6);
+
+  // Wake word detection on one capture frame
+  ethervox_wake_runtime_t wake = {0};
+  if (ethervox_wake_init(&wake, NULL) == 0) {
+    bench_run("wake_process", op_wake_process, &wake, csv);
+    ethervox_wake_cleanup(&wake);
+  }
+
+  // STT ring accumulation (placeholder backend: measures the audio path).
+  // Pass the defaults explicitly so init copies the config strings.
+  ethervox_stt_runtime_t stt = {0};
+  ethervox_stt_config_t stt_config = ethervox_stt_get_default_config();
+  if (ethervox_stt_init(&stt, &stt_config) == 0 && ethervox_stt_start(&stt) == 0) {
+    bench_run("stt_accumulate", op_stt_accumulate, &stt, csv);
+    ethervox_stt_stop(&stt);
+    ethervox_stt_cleanup(&stt);
+  }
+
+  // Intent parsing over a mixed corpus against the built-in patterns
+  ethervox_dialogue_engine_t engine = {0};
+  ethervox_llm_config_t llm_config = ethervox_dialogue_get_default_llm_config();
+  if (ethervox_dialogue_init(&engine, &llm_config) == 0) {
+    bench_intent_state_t intent_state = {.engine = &engine};
+    bench_run("parse_intent", op_parse_intent, &intent_state, csv);
+
+    // Context lookup across a populated table
+    bench_context_state_t context_state = {.engine = &engine};
+    ethervox_dialogue_set_max_contexts(&engine, BENCH_CONTEXT_COUNT);
+    bool contexts_ok = true;
+    for (uint32_t i = 0; i < BENCH_CONTEXT_COUNT; i++) {
+      char user_id[32];
+      snprintf(user_id, sizeof(user_id), "bench-user-%u", i);
+      ethervox_dialogue_context_request_t request = {.user_id = user_id, .language_code = "en"};
+      char* context_id = NULL;
+      if (ethervox_dialogue_create_context(&engine, &request, &context_id) != 0) {
+        contexts_ok = false;
+        break;
+      }
+      context_state.ids[i] = context_id;
+    }
+    if (contexts_ok) {
+      bench_run("context_lookup", op_context_lookup, &context_state, csv);
+    }
+    for (uint32_t i = 0; i < BENCH_CONTEXT_COUNT; i++) {
+      free(context_state.ids[i]);
+    }
+    ethervox_dialogue_cleanup(&engine);
+  }
+
+  // Plugin lookup + type dispatch against the built-in registrations
+  ethervox_plugin_manager_t* manager =
+      (ethervox_plugin_manager_t*)calloc(1, sizeof(ethervox_plugin_manager_t));
+  if (manager && ethervox_plugin_manager_init(manager, "./plugins") == 0) {
+    ethervox_plugin_register_builtin_openai(manager);
+    ethervox_plugin_register_builtin_local_rag(manager);
+    bench_run("plugin_dispatch", op_plugin_dispatch, manager, csv);
+    ethervox_plugin_manager_cleanup(manager);
+  }
+  free(manager);
+
+  // Audio buffer pool churn at capture-frame size
+  ethervox_audio_buffer_pool_t pool;
+  if (ethervox_audio_buffer_pool_init(&pool, 8, BENCH_FRAME_SAMPLES * sizeof(float)) == 0) {
+    bench_run("pool_acquire_release", op_pool_acquire_release, &pool, csv);
+    ethervox_audio_buffer_pool_cleanup(&pool);
+  }
+
+  if (csv) {
+    fclose(csv);
+  }
+  return 0;
+}